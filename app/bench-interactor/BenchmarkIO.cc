@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-interactor/BenchmarkIO.cc
+//---------------------------------------------------------------------------//
+#include "BenchmarkIO.hh"
+
+namespace bench_interactor
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! I/O routines for JSON
+void to_json(nlohmann::json& j, BenchmarkInput const& v)
+{
+    j = nlohmann::json{{"physics_filename", v.physics_filename},
+                       {"num_samples", v.num_samples},
+                       {"seed", v.seed},
+                       {"energies", v.energies},
+                       {"materials", v.materials},
+                       {"models", v.models}};
+}
+
+void from_json(nlohmann::json const& j, BenchmarkInput& v)
+{
+    j.at("physics_filename").get_to(v.physics_filename);
+    j.at("energies").get_to(v.energies);
+    if (j.contains("num_samples"))
+    {
+        j.at("num_samples").get_to(v.num_samples);
+    }
+    if (j.contains("seed"))
+    {
+        j.at("seed").get_to(v.seed);
+    }
+    if (j.contains("materials"))
+    {
+        j.at("materials").get_to(v.materials);
+    }
+    if (j.contains("models"))
+    {
+        j.at("models").get_to(v.models);
+    }
+}
+
+void to_json(nlohmann::json& j, BenchmarkResult const& v)
+{
+    double num_samples = v.num_samples;
+    j = nlohmann::json{
+        {"model", v.model},
+        {"particle", v.particle},
+        {"material", v.material},
+        {"energy", v.energy},
+        {"num_samples", v.num_samples},
+        {"num_secondaries", v.num_secondaries},
+        {"num_failed", v.num_failed},
+        {"time", v.time},
+        {"interactions_per_s", v.time > 0 ? num_samples / v.time : 0.0},
+        {"secondaries_per_interaction",
+         v.num_samples > 0 ? v.num_secondaries / num_samples : 0.0},
+    };
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+}  // namespace bench_interactor
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-interactor/BenchmarkIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Types.hh"
+
+namespace bench_interactor
+{
+//---------------------------------------------------------------------------//
+// Classes
+//---------------------------------------------------------------------------//
+//! Input for a benchmark run
+struct BenchmarkInput
+{
+    using size_type = celeritas::size_type;
+    using VecString = std::vector<std::string>;
+
+    std::string physics_filename;  //!< ROOT or GDML file with physics data
+    size_type num_samples{100000};  //!< Interactions per case
+    unsigned int seed{12345};
+    std::vector<double> energies;  //!< Incident energies [MeV]
+    VecString materials;  //!< Material names (empty for all)
+    VecString models;  //!< Model labels (empty for all)
+};
+
+//! Timing and yield for one model, particle, material, and energy
+struct BenchmarkResult
+{
+    using size_type = celeritas::size_type;
+
+    std::string model;
+    std::string particle;
+    std::string material;
+    double energy{0};  //!< Incident energy [MeV]
+    size_type num_samples{0};
+    size_type num_secondaries{0};  //!< Total over all samples
+    size_type num_failed{0};  //!< Interactions that ran out of storage
+    double time{0};  //!< Wall time [s]
+};
+
+//---------------------------------------------------------------------------//
+// JSON I/O functions
+//---------------------------------------------------------------------------//
+
+void to_json(nlohmann::json& j, BenchmarkInput const& value);
+void from_json(nlohmann::json const& j, BenchmarkInput& value);
+
+void to_json(nlohmann::json& j, BenchmarkResult const& value);
+
+//---------------------------------------------------------------------------//
+}  // namespace bench_interactor
@@ -0,0 +1,563 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-interactor/InteractorBenchmark.cc
+//---------------------------------------------------------------------------//
+#include "InteractorBenchmark.hh"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/data/StackAllocator.hh"
+#include "corecel/data/StackAllocatorData.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/em/AtomicRelaxationParams.hh"
+#include "celeritas/em/interactor/AtomicRelaxationHelper.hh"
+#include "celeritas/em/interactor/BetheHeitlerInteractor.hh"
+#include "celeritas/em/interactor/CombinedBremInteractor.hh"
+#include "celeritas/em/interactor/EPlusGGInteractor.hh"
+#include "celeritas/em/interactor/KleinNishinaInteractor.hh"
+#include "celeritas/em/interactor/LivermorePEInteractor.hh"
+#include "celeritas/em/interactor/MollerBhabhaInteractor.hh"
+#include "celeritas/em/interactor/MuBremsstrahlungInteractor.hh"
+#include "celeritas/em/interactor/RayleighInteractor.hh"
+#include "celeritas/em/interactor/RelativisticBremInteractor.hh"
+#include "celeritas/em/interactor/SeltzerBergerInteractor.hh"
+#include "celeritas/em/model/BetheHeitlerModel.hh"
+#include "celeritas/em/model/CombinedBremModel.hh"
+#include "celeritas/em/model/EPlusGGModel.hh"
+#include "celeritas/em/model/KleinNishinaModel.hh"
+#include "celeritas/em/model/LivermorePEModel.hh"
+#include "celeritas/em/model/MollerBhabhaModel.hh"
+#include "celeritas/em/model/MuBremsstrahlungModel.hh"
+#include "celeritas/em/model/RayleighModel.hh"
+#include "celeritas/em/model/RelativisticBremModel.hh"
+#include "celeritas/em/model/SeltzerBergerModel.hh"
+#include "celeritas/io/ImportData.hh"
+#include "celeritas/io/ImportProcess.hh"
+#include "celeritas/io/ImportedElementalMapLoader.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/mat/MaterialView.hh"
+#include "celeritas/phys/CutoffParams.hh"
+#include "celeritas/phys/CutoffView.hh"
+#include "celeritas/phys/ImportedProcessAdapter.hh"
+#include "celeritas/phys/Interaction.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/ParticleTrackView.hh"
+#include "celeritas/phys/Secondary.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+
+namespace bench_interactor
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using SecondaryStackData
+    = StackAllocatorData<Secondary, Ownership::value, MemSpace::host>;
+using SecondaryStackRef
+    = StackAllocatorData<Secondary, Ownership::reference, MemSpace::host>;
+
+//---------------------------------------------------------------------------//
+//! Single-track storage owned by one CPU thread
+struct ThreadState
+{
+    HostVal<ParticleStateData> particle;
+    HostVal<AtomicRelaxStateData> relaxation;
+    SecondaryStackData secondaries;
+    std::mt19937 rng;
+};
+
+//---------------------------------------------------------------------------//
+//! Get the index of the calling OpenMP thread
+size_type thread_id()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Get the number of OpenMP threads used for sampling
+size_type num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+//! Particle, material, and energy to sample
+struct InteractorBenchmark::Case
+{
+    ParticleId particle;
+    MaterialId material;
+    units::MevEnergy energy;
+    size_type num_samples;
+    unsigned int seed;
+};
+
+//---------------------------------------------------------------------------//
+//! Thread-local views used to construct an interactor
+struct InteractorBenchmark::Sampler
+{
+    ParticleTrackView const& particle;
+    MaterialView const& material;
+    CutoffView const& cutoffs;
+    StackAllocator<Secondary>& allocate;
+    AtomicRelaxParamsRef const& relax_params;
+    AtomicRelaxStateRef const& relax_states;
+    Real3 const& direction;
+    std::mt19937& rng;
+
+    //! Get the relaxation helper for the target element
+    AtomicRelaxationHelper relaxation(ElementId el_id) const
+    {
+        return {relax_params, relax_states, el_id, ThreadId{0}};
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct models from imported data.
+ */
+InteractorBenchmark::InteractorBenchmark(ImportData const& data)
+{
+    CELER_EXPECT(data);
+
+    particles_ = ParticleParams::from_import(data);
+    materials_ = MaterialParams::from_import(data);
+    cutoffs_ = CutoffParams::from_import(data, particles_, materials_);
+    auto imported = ImportedProcesses::from_import(data, particles_);
+    auto has_process = [&imported](PDGNumber pdg, ImportProcessClass ipc) {
+        return static_cast<bool>(imported->find({pdg, ipc}));
+    };
+
+    if (!data.atomic_relaxation_data.empty())
+    {
+        AtomicRelaxationParams::Input inp;
+        inp.cutoffs = cutoffs_;
+        inp.materials = materials_;
+        inp.particles = particles_;
+        inp.load_data
+            = make_imported_element_loader(data.atomic_relaxation_data);
+        inp.is_auger_enabled = data.em_params.auger;
+        auto relaxation = std::make_shared<AtomicRelaxationParams>(inp);
+
+        // Reserve space for the photoelectron and all relaxation products
+        auto const& elements = relaxation->host_ref().elements;
+        for (auto el_id : range(ElementId(elements.size())))
+        {
+            secondary_capacity_ = std::max<size_type>(
+                secondary_capacity_, elements[el_id].max_secondary + 1);
+        }
+        relaxation_ = std::move(relaxation);
+    }
+
+    ActionId::size_type next_id = 0;
+    auto next_action = [&next_id] { return ActionId{next_id++}; };
+    auto const& particles = *particles_;
+    auto const& materials = *materials_;
+    bool const lpm = data.em_params.lpm;
+
+    // Photon models
+    add_model(std::make_shared<KleinNishinaModel>(next_action(), particles),
+              [](KleinNishinaData const& model, Sampler& s, ElementComponentId) {
+                  KleinNishinaInteractor interact(
+                      model, s.particle, s.direction, s.allocate);
+                  return interact(s.rng);
+              });
+    if (has_process(pdg::gamma(), ImportProcessClass::conversion))
+    {
+        add_model(std::make_shared<BetheHeitlerModel>(
+                      next_action(), particles, imported, lpm),
+                  [](BetheHeitlerData const& model,
+                     Sampler& s,
+                     ElementComponentId elcomp_id) {
+                      BetheHeitlerInteractor interact(
+                          model,
+                          s.particle,
+                          s.direction,
+                          s.allocate,
+                          s.material,
+                          s.material.make_element_view(elcomp_id));
+                      return interact(s.rng);
+                  });
+    }
+    if (!data.livermore_pe_data.empty())
+    {
+        add_model(std::make_shared<LivermorePEModel>(
+                      next_action(),
+                      particles,
+                      materials,
+                      make_imported_element_loader(data.livermore_pe_data)),
+                  [](LivermorePERef const& model,
+                     Sampler& s,
+                     ElementComponentId elcomp_id) {
+                      auto el_id = s.material.element_id(elcomp_id);
+                      LivermorePEInteractor interact(model,
+                                                     s.relaxation(el_id),
+                                                     el_id,
+                                                     s.particle,
+                                                     s.cutoffs,
+                                                     s.direction,
+                                                     s.allocate);
+                      return interact(s.rng);
+                  });
+    }
+    if (has_process(pdg::gamma(), ImportProcessClass::rayleigh))
+    {
+        add_model(std::make_shared<RayleighModel>(
+                      next_action(), particles, materials, imported),
+                  [](RayleighRef const& model,
+                     Sampler& s,
+                     ElementComponentId elcomp_id) {
+                      RayleighInteractor interact(
+                          model,
+                          s.particle,
+                          s.direction,
+                          s.material.element_id(elcomp_id));
+                      return interact(s.rng);
+                  });
+    }
+
+    // Electron and positron models
+    add_model(std::make_shared<MollerBhabhaModel>(next_action(), particles),
+              [](MollerBhabhaData const& model, Sampler& s, ElementComponentId) {
+                  MollerBhabhaInteractor interact(
+                      model, s.particle, s.cutoffs, s.direction, s.allocate);
+                  return interact(s.rng);
+              });
+    add_model(std::make_shared<EPlusGGModel>(next_action(), particles),
+              [](EPlusGGData const& model, Sampler& s, ElementComponentId) {
+                  EPlusGGInteractor interact(
+                      model, s.particle, s.direction, s.allocate);
+                  return interact(s.rng);
+              });
+    if (has_process(pdg::electron(), ImportProcessClass::e_brems)
+        && has_process(pdg::positron(), ImportProcessClass::e_brems))
+    {
+        if (!data.sb_data.empty())
+        {
+            add_model(std::make_shared<SeltzerBergerModel>(
+                          next_action(),
+                          particles,
+                          materials,
+                          imported,
+                          make_imported_element_loader(data.sb_data)),
+                      [](SeltzerBergerRef const& model,
+                         Sampler& s,
+                         ElementComponentId elcomp_id) {
+                          SeltzerBergerInteractor interact(model,
+                                                           s.particle,
+                                                           s.direction,
+                                                           s.cutoffs,
+                                                           s.allocate,
+                                                           s.material,
+                                                           elcomp_id);
+                          return interact(s.rng);
+                      });
+            add_model(std::make_shared<CombinedBremModel>(
+                          next_action(),
+                          particles,
+                          materials,
+                          imported,
+                          make_imported_element_loader(data.sb_data),
+                          lpm),
+                      [](CombinedBremRef const& model,
+                         Sampler& s,
+                         ElementComponentId elcomp_id) {
+                          CombinedBremInteractor interact(model,
+                                                          s.particle,
+                                                          s.direction,
+                                                          s.cutoffs,
+                                                          s.allocate,
+                                                          s.material,
+                                                          elcomp_id);
+                          return interact(s.rng);
+                      });
+        }
+        add_model(std::make_shared<RelativisticBremModel>(
+                      next_action(), particles, materials, imported, lpm),
+                  [](RelativisticBremRef const& model,
+                     Sampler& s,
+                     ElementComponentId elcomp_id) {
+                      RelativisticBremInteractor interact(model,
+                                                          s.particle,
+                                                          s.direction,
+                                                          s.cutoffs,
+                                                          s.allocate,
+                                                          s.material,
+                                                          elcomp_id);
+                      return interact(s.rng);
+                  });
+    }
+
+    // Muon models
+    if (has_process(pdg::mu_minus(), ImportProcessClass::mu_brems)
+        && has_process(pdg::mu_plus(), ImportProcessClass::mu_brems))
+    {
+        add_model(std::make_shared<MuBremsstrahlungModel>(
+                      next_action(), particles, imported),
+                  [](MuBremsstrahlungData const& model,
+                     Sampler& s,
+                     ElementComponentId elcomp_id) {
+                      MuBremsstrahlungInteractor interact(model,
+                                                          s.particle,
+                                                          s.direction,
+                                                          s.allocate,
+                                                          s.material,
+                                                          elcomp_id);
+                      return interact(s.rng);
+                  });
+        models_.back().min_energy
+            = MuBremsstrahlungData::min_incident_energy();
+    }
+
+    CELER_ENSURE(!models_.empty());
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+InteractorBenchmark::~InteractorBenchmark() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Labels of the models that will be benchmarked.
+ */
+auto InteractorBenchmark::model_labels() const -> VecString
+{
+    VecString result;
+    for (auto const& entry : models_)
+    {
+        result.push_back(entry.model->label());
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample all requested cases.
+ *
+ * Energies outside a model's range of applicability for a particle are
+ * skipped.
+ */
+auto InteractorBenchmark::operator()(BenchmarkInput const& inp) const
+    -> VecResult
+{
+    CELER_EXPECT(inp.num_samples > 0);
+    CELER_EXPECT(!inp.energies.empty());
+
+    // Find requested materials
+    std::vector<MaterialId> mat_ids;
+    if (inp.materials.empty())
+    {
+        for (auto mat_id : range(MaterialId{materials_->num_materials()}))
+        {
+            mat_ids.push_back(mat_id);
+        }
+    }
+    for (auto const& name : inp.materials)
+    {
+        auto mat_id = materials_->find_material(name);
+        CELER_VALIDATE(mat_id, << "invalid material name '" << name << "'");
+        mat_ids.push_back(mat_id);
+    }
+
+    // Check requested models
+    auto labels = this->model_labels();
+    for (auto const& label : inp.models)
+    {
+        CELER_VALIDATE(std::find(labels.begin(), labels.end(), label)
+                           != labels.end(),
+                       << "model '" << label
+                       << "' is unknown or unavailable in the physics data");
+    }
+
+    VecResult result;
+    for (auto const& entry : models_)
+    {
+        auto label = entry.model->label();
+        if (!inp.models.empty()
+            && std::find(inp.models.begin(), inp.models.end(), label)
+                   == inp.models.end())
+        {
+            continue;
+        }
+
+        for (auto const& applic : entry.model->applicability())
+        {
+            for (auto mat_id : mat_ids)
+            {
+                for (double energy : inp.energies)
+                {
+                    units::MevEnergy e{energy};
+                    if (!(e > applic.lower && e < applic.upper
+                          && e >= entry.min_energy))
+                    {
+                        continue;
+                    }
+
+                    Case c{applic.particle,
+                           mat_id,
+                           e,
+                           inp.num_samples,
+                           inp.seed};
+                    CELER_LOG(info)
+                        << "Sampling " << label << " for "
+                        << particles_->id_to_label(applic.particle) << " at "
+                        << energy << " MeV in "
+                        << materials_->id_to_label(mat_id).name;
+                    auto sampled = entry.sample(*this, c);
+                    sampled.model = label;
+                    result.push_back(std::move(sampled));
+                }
+            }
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Add a model and the function that samples its interactor.
+ */
+template<class M, class F>
+void InteractorBenchmark::add_model(std::shared_ptr<M> model, F&& interact)
+{
+    CELER_EXPECT(model);
+
+    ModelEntry entry;
+    entry.sample = [model, interact = std::forward<F>(interact)](
+                       InteractorBenchmark const& self, Case const& c) {
+        auto const& data = model->host_ref();
+        return self.sample(c, [&](Sampler& s, ElementComponentId elcomp_id) {
+            return interact(data, s, elcomp_id);
+        });
+    };
+    entry.model = std::move(model);
+    models_.push_back(std::move(entry));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample interactions for a single case in parallel.
+ *
+ * Thread-local states are allocated before the timer starts. Each interaction
+ * starts from the same incident particle state, and the secondary storage is
+ * cleared after each interaction.
+ */
+template<class F>
+BenchmarkResult
+InteractorBenchmark::sample(Case const& c, F const& interact) const
+{
+    CELER_EXPECT(c.particle && c.material && c.num_samples > 0);
+
+    AtomicRelaxParamsRef relax_params;
+    if (relaxation_)
+    {
+        relax_params = relaxation_->host_ref();
+    }
+
+    std::vector<ThreadState> states(num_threads());
+    for (auto i : range(states.size()))
+    {
+        auto& state = states[i];
+        resize(&state.particle, particles_->host_ref(), 1);
+        if (relaxation_)
+        {
+            resize(&state.relaxation, relaxation_->host_ref(), 1);
+        }
+        resize(&state.secondaries, secondary_capacity_);
+        state.rng.seed(c.seed + i);
+    }
+
+    MaterialView const material(materials_->host_ref(), c.material);
+    CutoffView const cutoffs(cutoffs_->host_ref(), c.material);
+    Real3 const direction{0, 0, 1};
+    auto const num_elements = material.num_elements();
+    auto const initial
+        = ParticleTrackView::Initializer_t{c.particle, c.energy};
+
+    size_type num_secondaries = 0;
+    size_type num_failed = 0;
+    MultiExceptionHandler capture_exception;
+    Stopwatch get_time;
+#pragma omp parallel reduction(+ : num_secondaries, num_failed)
+    {
+        auto& state = states[thread_id()];
+        HostRef<ParticleStateData> particle_states;
+        particle_states = state.particle;
+        HostRef<AtomicRelaxStateData> relax_states;
+        relax_states = state.relaxation;
+        SecondaryStackRef secondaries;
+        secondaries = state.secondaries;
+
+        ParticleTrackView particle(
+            particles_->host_ref(), particle_states, ThreadId{0});
+        StackAllocator<Secondary> allocate(secondaries);
+        Sampler s{particle,
+                  material,
+                  cutoffs,
+                  allocate,
+                  relax_params,
+                  relax_states,
+                  direction,
+                  state.rng};
+
+#pragma omp for
+        for (size_type i = 0; i < c.num_samples; ++i)
+        {
+            CELER_TRY_HANDLE(
+                {
+                    particle = initial;
+                    Interaction result
+                        = interact(s, ElementComponentId(i % num_elements));
+                    if (result.action == Interaction::Action::failed)
+                    {
+                        ++num_failed;
+                    }
+                    num_secondaries += result.secondaries.size();
+                    allocate.clear();
+                },
+                capture_exception);
+        }
+    }
+    double time = get_time();
+    log_and_rethrow(std::move(capture_exception));
+
+    BenchmarkResult result;
+    result.particle = particles_->id_to_label(c.particle);
+    result.material = materials_->id_to_label(c.material).name;
+    result.energy = c.energy.value();
+    result.num_samples = c.num_samples;
+    result.num_secondaries = num_secondaries;
+    result.num_failed = num_failed;
+    result.time = time;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace bench_interactor
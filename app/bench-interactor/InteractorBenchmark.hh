@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-interactor/InteractorBenchmark.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Model.hh"
+
+#include "BenchmarkIO.hh"
+
+namespace celeritas
+{
+struct ImportData;
+class AtomicRelaxationParams;
+class CutoffParams;
+class MaterialParams;
+class ParticleParams;
+}  // namespace celeritas
+
+namespace bench_interactor
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time the sampling of secondaries by each EM interactor on host.
+ *
+ * Every model that can be built from the imported physics data is sampled
+ * for each applicable particle type, each requested material, and each
+ * requested incident energy inside the model's applicable energy range.
+ * Samples are distributed over OpenMP threads, each of which has its own
+ * single-track state, secondary storage, and random number generator. The
+ * target element cycles through the material's elements so that every
+ * element is sampled equally.
+ *
+ * Muon bremsstrahlung, Bethe-Heitler, Rayleigh, and the electron
+ * bremsstrahlung models are only benchmarked if the imported data has the
+ * corresponding process. Atomic relaxation is enabled for the Livermore
+ * photoelectric model when the data includes relaxation transitions.
+ */
+class InteractorBenchmark
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecResult = std::vector<BenchmarkResult>;
+    using VecString = std::vector<std::string>;
+    //!@}
+
+  public:
+    // Construct models from imported data
+    explicit InteractorBenchmark(celeritas::ImportData const& data);
+
+    // Default destructor
+    ~InteractorBenchmark();
+
+    // Labels of the models that will be benchmarked
+    VecString model_labels() const;
+
+    // Sample all requested cases
+    VecResult operator()(BenchmarkInput const& inp) const;
+
+  private:
+    //// TYPES ////
+
+    struct Case;
+    struct Sampler;
+    using SampleFn = std::function<BenchmarkResult(
+        InteractorBenchmark const&, Case const&)>;
+    using SPConstModel = std::shared_ptr<celeritas::Model const>;
+
+    struct ModelEntry
+    {
+        SPConstModel model;
+        SampleFn sample;
+        celeritas::units::MevEnergy min_energy{0};  //!< Interactor minimum
+    };
+
+    //// DATA ////
+
+    std::shared_ptr<celeritas::ParticleParams const> particles_;
+    std::shared_ptr<celeritas::MaterialParams const> materials_;
+    std::shared_ptr<celeritas::CutoffParams const> cutoffs_;
+    std::shared_ptr<celeritas::AtomicRelaxationParams const> relaxation_;
+    std::vector<ModelEntry> models_;
+    celeritas::size_type secondary_capacity_{2};
+
+    //// HELPER FUNCTIONS ////
+
+    template<class M, class F>
+    void add_model(std::shared_ptr<M> model, F&& interact);
+
+    template<class F>
+    BenchmarkResult sample(Case const& c, F const& interact) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace bench_interactor
@@ -0,0 +1,137 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-interactor/bench-interactor.cc
+//---------------------------------------------------------------------------//
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "celeritas_version.h"
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/StringUtils.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
+#include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/ext/GeantSetup.hh"
+#include "celeritas/ext/RootImporter.hh"
+#include "celeritas/io/ImportData.hh"
+
+#include "BenchmarkIO.hh"
+#include "InteractorBenchmark.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+using namespace bench_interactor;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace bench_interactor
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Load physics data from a ROOT export or directly from Geant4.
+ */
+ImportData load_physics(std::string const& filename)
+{
+    if (ends_with(filename, ".root"))
+    {
+        return RootImporter(filename.c_str())();
+    }
+    else if (ends_with(filename, ".gdml"))
+    {
+        return GeantImporter(GeantSetup(filename, GeantPhysicsOptions{}))();
+    }
+    CELER_VALIDATE(false,
+                   << "invalid physics filename '" << filename
+                   << "' (expected gdml or root)");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run, launch, and output.
+ */
+void run(std::istream& is)
+{
+    // Read input options
+    auto inp = nlohmann::json::parse(is).get<BenchmarkInput>();
+    CELER_VALIDATE(inp.num_samples > 0,
+                   << "nonpositive num_samples=" << inp.num_samples);
+    CELER_VALIDATE(!inp.energies.empty(), << "no energies were given");
+
+    // Construct models and sample
+    InteractorBenchmark benchmark(load_physics(inp.physics_filename));
+    auto result = benchmark(inp);
+
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+
+    nlohmann::json outp = {
+        {"input", inp},
+        {"models", benchmark.model_labels()},
+        {"result", result},
+        {
+            "runtime",
+            {
+                {"version", std::string(celeritas_version)},
+                {"num_threads", num_threads},
+            },
+        },
+    };
+    cout << outp.dump() << endl;
+}
+}  // namespace bench_interactor
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+        && MpiCommunicator::comm_world().size() > 1)
+    {
+        CELER_LOG(critical) << "This app cannot run in parallel";
+        return EXIT_FAILURE;
+    }
+
+    // Process input arguments
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
+    {
+        cerr << "usage: " << args[0] << " {input}.json" << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (args[1] != "-")
+    {
+        std::ifstream infile(args[1]);
+        if (!infile)
+        {
+            CELER_LOG(critical) << "Failed to open '" << args[1] << "'";
+            return EXIT_FAILURE;
+        }
+        run(infile);
+    }
+    else
+    {
+        // Read input from STDIN
+        run(std::cin);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -90,6 +90,35 @@ GlobalSetup::GlobalSetup()
         options_->initializer_capacity = 1048576;
         cmd.SetDefaultValue(std::to_string(options_->initializer_capacity));
     }
+    {
+        auto& cmd = messenger_->DeclareProperty("stepsPerPush",
+                                                options_->steps_per_push);
+        cmd.SetGuidance(
+            "Set the step iterations run when the track buffer fills (0 "
+            "transports to completion)");
+        cmd.SetDefaultValue(std::to_string(options_->steps_per_push));
+    }
+    {
+        auto& cmd = messenger_->DeclarePropertyWithUnit(
+            "offloadMinEnergy", "MeV", options_->min_offload_energy);
+        cmd.SetGuidance("Set the minimum kinetic energy of offloaded tracks");
+    }
+    {
+        auto& cmd = messenger_->DeclareProperty(
+            "numServiceThreads", options_->num_service_threads);
+        cmd.SetGuidance(
+            "Set the number of Celeritas transport threads shared by all "
+            "workers (0 transports on each worker)");
+        cmd.SetDefaultValue(std::to_string(options_->num_service_threads));
+    }
+    {
+        auto& cmd = messenger_->DeclareProperty(
+            "serviceBatchSize", options_->service_batch_size);
+        cmd.SetGuidance(
+            "Set the number of tracks each worker queues for the transport "
+            "threads at once");
+        cmd.SetDefaultValue(std::to_string(options_->service_batch_size));
+    }
     {
         auto& cmd = messenger_->DeclareProperty("cudaStackSize",
                                                 options_->cuda_stack_size);
@@ -102,6 +131,12 @@ GlobalSetup::GlobalSetup()
         cmd.SetGuidance("Set the shared dynamic CUDA heap size (bytes)");
         options_->cuda_heap_size = 0;
     }
+    {
+        auto& cmd = messenger_->DeclareProperty("stepDiagnostic",
+                                                options_->step_diagnostic);
+        cmd.SetGuidance("Tally steps per track and interactions per process");
+        cmd.SetDefaultValue("false");
+    }
     {
         // TODO: expose other options here
     }
@@ -38,9 +38,10 @@ TrackingAction::TrackingAction(SPConstParams params, SPTransporter transport)
 /*!
  * At the start of a track, determine whether to use Celeritas to transport it.
  *
- * If the track is one of a few predetermined EM particles, we pass it to
- * Celeritas (which queues the track on its buffer and potentially flushes it)
- * and kill the Geant4 track.
+ * If the track is one of a few predetermined EM particles and is in a
+ * volume and energy range selected for offloading, we pass it to Celeritas
+ * (which queues the track on its buffer and potentially flushes it) and kill
+ * the Geant4 track.
  */
 void TrackingAction::PreUserTrackingAction(G4Track const* track)
 {
@@ -57,7 +58,8 @@ void TrackingAction::PreUserTrackingAction(G4Track const* track)
     if (std::find(std::begin(allowed_particles),
                   std::end(allowed_particles),
                   track->GetDefinition())
-        != std::end(allowed_particles))
+            != std::end(allowed_particles)
+        && transport_->IsApplicable(*track))
     {
         // Celeritas is transporting this track
         celeritas::ExceptionConverter call_g4exception{"celer0003"};
@@ -0,0 +1,158 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/EventDistributor.cc
+//---------------------------------------------------------------------------//
+#include "EventDistributor.hh"
+
+#include <utility>
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+#include "corecel/Assert.hh"
+#include "corecel/io/EnumStringMapper.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+//! Shared event counter
+struct EventDistributor::Impl
+{
+#if CELERITAS_USE_MPI
+    MPI_Win win = MPI_WIN_NULL;
+#endif
+};
+
+//---------------------------------------------------------------------------//
+//! Free the shared counter window (collective)
+void EventDistributor::ImplDeleter::operator()(Impl* impl) const
+{
+#if CELERITAS_USE_MPI
+    if (impl->win != MPI_WIN_NULL)
+    {
+        MPI_Win_unlock_all(impl->win);
+        MPI_Win_free(&impl->win);
+    }
+#endif
+    delete impl;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with communicator, source, and distribution.
+ */
+EventDistributor::EventDistributor(MpiCommunicator const& comm,
+                                   EventSource read_event,
+                                   EventDistribution dist)
+    : comm_(comm), read_event_(std::move(read_event)), dist_(dist)
+{
+    CELER_EXPECT(read_event_);
+
+    if (dist_ != EventDistribution::dynamic || comm_.size() == 1)
+    {
+        return;
+    }
+
+#if CELERITAS_USE_MPI
+    impl_.reset(new Impl);
+
+    // Allocate the event counter on the first rank
+    unsigned long* counter{nullptr};
+    CELER_MPI_CALL(MPI_Win_allocate(
+        static_cast<MPI_Aint>(comm_.rank() == 0 ? sizeof(unsigned long) : 0),
+        sizeof(unsigned long),
+        MPI_INFO_NULL,
+        comm_.mpi_comm(),
+        &counter,
+        &impl_->win));
+    if (comm_.rank() == 0)
+    {
+        *counter = 0;
+    }
+    CELER_MPI_CALL(MPI_Barrier(comm_.mpi_comm()));
+
+    // Open a passive-target access epoch for the duration of the run
+    CELER_MPI_CALL(MPI_Win_lock_all(0, impl_->win));
+#else
+    CELER_NOT_CONFIGURED("MPI");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Free the shared counter
+EventDistributor::~EventDistributor() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the next event owned by this rank, or empty if finished.
+ */
+auto EventDistributor::operator()() -> result_type
+{
+    size_type index = this->next_index();
+
+    // Skip events owned by other ranks
+    result_type result;
+    do
+    {
+        result = read_event_();
+    } while (num_read_++ < index && !result.empty());
+
+    if (!result.empty())
+    {
+        ++num_events_;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the index of the next event to transport.
+ */
+auto EventDistributor::next_index() -> size_type
+{
+    if (!impl_)
+    {
+        // Static assignment: skip to the next multiple of this rank
+        size_type const size = comm_.size();
+        size_type const rank = comm_.rank();
+        return (num_read_ + size - 1 - rank) / size * size + rank;
+    }
+
+#if CELERITAS_USE_MPI
+    // Atomically claim the next event from the shared counter
+    unsigned long const one = 1;
+    unsigned long result{};
+    CELER_MPI_CALL(MPI_Fetch_and_op(&one,
+                                    &result,
+                                    MPI_UNSIGNED_LONG,
+                                    /* target_rank = */ 0,
+                                    /* target_disp = */ 0,
+                                    MPI_SUM,
+                                    impl_->win));
+    CELER_MPI_CALL(MPI_Win_flush(0, impl_->win));
+    return static_cast<size_type>(result);
+#else
+    CELER_ASSERT_UNREACHABLE();
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to an event distribution.
+ */
+char const* to_cstring(EventDistribution value)
+{
+    static celeritas::EnumStringMapper<EventDistribution> const to_cstring_impl{
+        "round_robin",
+        "dynamic",
+    };
+    return to_cstring_impl(value);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace demo_loop
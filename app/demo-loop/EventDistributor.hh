@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/EventDistributor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+//! How to assign events to MPI ranks
+enum class EventDistribution
+{
+    round_robin,  //!< Event i is transported by rank i % size
+    dynamic,  //!< Each rank claims the next unassigned event when ready
+    size_
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select the subset of events from a source to transport on this rank.
+ *
+ * Every rank reads the full event stream (so event IDs match a serial run)
+ * but only returns the events it owns. With round-robin distribution the
+ * assignment is static. With dynamic distribution, the first rank owns a
+ * shared event counter that the other ranks atomically increment through
+ * one-sided MPI communication each time they need a new event, so that
+ * faster ranks take on more events. Dynamic distribution calls MPI, so it
+ * must be used from the thread that initialized MPI, and it should be read
+ * by the streaming transporter so that an event is only claimed once there
+ * are free track slots for it.
+ *
+ * Construction and destruction are collective over the communicator.
+ */
+class EventDistributor
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using size_type = celeritas::size_type;
+    using VecPrimary = std::vector<celeritas::Primary>;
+    using EventSource = std::function<VecPrimary()>;
+    using MpiCommunicator = celeritas::MpiCommunicator;
+    using result_type = VecPrimary;
+    //!@}
+
+  public:
+    // Construct with communicator, source, and distribution
+    EventDistributor(MpiCommunicator const& comm,
+                     EventSource read_event,
+                     EventDistribution dist);
+
+    // Free the shared counter
+    ~EventDistributor();
+
+    //!@{
+    //! Prevent copying and moving
+    EventDistributor(EventDistributor const&) = delete;
+    EventDistributor& operator=(EventDistributor const&) = delete;
+    //!@}
+
+    // Get the next event owned by this rank, or empty if finished
+    result_type operator()();
+
+    //! Number of events returned on this rank
+    size_type num_events() const { return num_events_; }
+
+  private:
+    struct Impl;
+    struct ImplDeleter
+    {
+        void operator()(Impl*) const;
+    };
+
+    MpiCommunicator comm_;
+    EventSource read_event_;
+    EventDistribution dist_;
+    std::unique_ptr<Impl, ImplDeleter> impl_;
+
+    size_type num_read_{0};
+    size_type num_events_{0};
+
+    // Get the index of the next event to transport
+    size_type next_index();
+};
+
+//---------------------------------------------------------------------------//
+// Get a string corresponding to an event distribution
+char const* to_cstring(EventDistribution value);
+
+//---------------------------------------------------------------------------//
+}  // namespace demo_loop
@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/EventPipeline.cc
+//---------------------------------------------------------------------------//
+#include "EventPipeline.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Start reading events from the source.
+ */
+EventPipeline::EventPipeline(EventSource read_event, size_type max_queued)
+    : read_event_(std::move(read_event)), max_queued_(max_queued)
+{
+    CELER_EXPECT(read_event_);
+    CELER_VALIDATE(max_queued_ > 0,
+                   << "nonpositive event queue size " << max_queued_);
+
+    thread_ = std::thread(&EventPipeline::run, this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop reading and wait for the background thread.
+ *
+ * If transport is aborted early, the reader is interrupted after the event it
+ * is currently reading.
+ */
+EventPipeline::~EventPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    not_full_.notify_all();
+    thread_.join();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the next event, or an empty vector if the input is exhausted.
+ */
+auto EventPipeline::operator()() -> result_type
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty() || finished_; });
+
+    if (queue_.empty())
+    {
+        if (error_)
+        {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+        return {};
+    }
+
+    result_type result = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read events until the source is exhausted or the pipeline is stopped.
+ */
+void EventPipeline::run()
+{
+    try
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                not_full_.wait(lock, [this] {
+                    return queue_.size() < max_queued_ || stopped_;
+                });
+                if (stopped_)
+                {
+                    break;
+                }
+            }
+
+            // Read without holding the lock so the consumer can proceed
+            auto event = read_event_();
+            if (event.empty())
+            {
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.push_back(std::move(event));
+            }
+            not_empty_.notify_one();
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+    }
+    not_empty_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace demo_loop
@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-loop/EventPipeline.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read events on a background thread into a bounded queue.
+ *
+ * The event source (e.g. an \c EventReader or \c PrimaryGenerator) is called
+ * only from the background thread, which blocks while the queue is full. This
+ * overlaps event parsing with transport while bounding the number of events
+ * held in memory. Calling the pipeline pops the next event, blocking until one
+ * is available; an empty event marks the end of the input. Exceptions from the
+ * source are rethrown in the consuming thread.
+ *
+ * \code
+    EventPipeline next_event(EventReader{filename, particles}, 16);
+    for (auto event = next_event(); !event.empty(); event = next_event())
+    {
+        transport(event);
+    }
+   \endcode
+ */
+class EventPipeline
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using size_type = celeritas::size_type;
+    using VecPrimary = std::vector<celeritas::Primary>;
+    using EventSource = std::function<VecPrimary()>;
+    using result_type = VecPrimary;
+    //!@}
+
+  public:
+    // Start reading events from the source
+    EventPipeline(EventSource read_event, size_type max_queued);
+
+    // Stop reading and wait for the background thread
+    ~EventPipeline();
+
+    //!@{
+    //! Prevent copying and moving: the thread references this instance
+    EventPipeline(EventPipeline const&) = delete;
+    EventPipeline& operator=(EventPipeline const&) = delete;
+    //!@}
+
+    // Get the next event, or an empty vector if the input is exhausted
+    result_type operator()();
+
+    //! Maximum number of events read ahead
+    size_type max_queued() const { return max_queued_; }
+
+  private:
+    EventSource read_event_;
+    size_type max_queued_;
+
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<VecPrimary> queue_;
+    bool finished_{false};
+    bool stopped_{false};
+    std::exception_ptr error_;
+
+    std::thread thread_;
+
+    // Background thread loop
+    void run();
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace demo_loop
@@ -7,14 +7,21 @@
 //---------------------------------------------------------------------------//
 #include "LDemoIO.hh"
 
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include <sys/stat.h>
 
 #include "corecel/cont/ArrayIO.json.hh"
+#include "corecel/io/BinaryCache.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/io/StringEnumMapper.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/math/HashUtils.hh"
 #include "corecel/sys/Device.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
 #include "celeritas/Units.hh"
 #include "celeritas/em/UrbanMscParams.hh"
 #include "celeritas/ext/GeantImporter.hh"
@@ -30,6 +37,7 @@
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/io/ImportData.hh"
+#include "celeritas/io/ImportDataArchive.hh"
 #include "celeritas/mat/MaterialParams.hh"
 #include "celeritas/phys/CutoffParams.hh"
 #include "celeritas/phys/ParticleParams.hh"
@@ -84,6 +92,92 @@ void get_optional(nlohmann::json const& j, char const* key, T& value)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Identify the physics input file and the options used to build processes.
+ *
+ * This is used to detect when a physics cache is stale. It uses the file's
+ * name, size, and modification time rather than its contents so that checking
+ * the cache is much cheaper than importing the data.
+ */
+std::uint64_t hash_physics_input(LDemoArgs const& args)
+{
+    struct stat file_stat;
+    CELER_VALIDATE(::stat(args.physics_filename.c_str(), &file_stat) == 0,
+                   << "failed to open physics file '" << args.physics_filename
+                   << "'");
+    std::string geant_options;
+    if (ends_with(args.physics_filename, ".gdml"))
+    {
+        geant_options = nlohmann::json(args.geant_options).dump();
+    }
+    return hash_combine(args.physics_filename,
+                        static_cast<long long>(file_stat.st_size),
+                        static_cast<long long>(file_stat.st_mtime),
+                        geant_options,
+                        args.brem_combined);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Import physics data from ROOT or Geant4.
+ */
+ImportData import_physics(LDemoArgs const& args)
+{
+    if (ends_with(args.physics_filename, ".root"))
+    {
+        // Load imported_data from ROOT file
+        return RootImporter(args.physics_filename.c_str())();
+    }
+    CELER_VALIDATE(ends_with(args.physics_filename, ".gdml"),
+                   << "invalid physics filename '" << args.physics_filename
+                   << "' (expected gdml or root)");
+
+    // Load imported_data directly from Geant4
+    return GeantImporter(
+        GeantSetup(args.physics_filename, args.geant_options))();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load imported physics data from the cache, or import and cache it.
+ *
+ * A cache that is stale or fails validation is ignored and rewritten.
+ */
+ImportData load_physics(LDemoArgs const& args, std::uint64_t cache_key)
+{
+    if (args.physics_cache.empty())
+    {
+        return import_physics(args);
+    }
+
+    std::string const filename = args.physics_cache + ".import";
+    if (BinaryCacheReader read_cache{filename, cache_key})
+    {
+        try
+        {
+            ImportData result;
+            unarchive(read_cache.archive(), &result);
+            CELER_VALIDATE(result && read_cache.archive().remaining() == 0,
+                           << "imported data is incomplete");
+            CELER_LOG(info) << "Loaded imported physics from '" << filename
+                            << "'";
+            return result;
+        }
+        catch (RuntimeError const& e)
+        {
+            CELER_LOG(warning) << "Ignoring invalid physics cache file '"
+                               << filename << "': " << e.what();
+        }
+    }
+
+    ImportData result = import_physics(args);
+    BinaryCacheWriter write_cache(filename, cache_key);
+    archive(write_cache.archive(), result);
+    write_cache.finalize();
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -99,10 +193,14 @@ void to_json(nlohmann::json& j, LDemoArgs const& v)
                        {"max_steps", v.max_steps},
                        {"initializer_capacity", v.initializer_capacity},
                        {"max_events", v.max_events},
+                       {"event_queue_size", v.event_queue_size},
+                       {"event_distribution",
+                        to_cstring(v.event_distribution)},
                        {"secondary_stack_factor", v.secondary_stack_factor},
                        {"enable_diagnostics", v.enable_diagnostics},
                        {"use_device", v.use_device},
                        {"sync", v.sync},
+                       {"share_physics", v.share_physics},
                        {"mag_field", v.mag_field},
                        {"brem_combined", v.brem_combined}};
     if (v.mag_field != LDemoArgs::no_field())
@@ -132,6 +230,15 @@ void to_json(nlohmann::json& j, LDemoArgs const& v)
     if (!v.mctruth_filename.empty())
     {
         j["mctruth_filename"] = v.mctruth_filename;
+        j["mctruth_buffers"] = v.mctruth_buffers;
+    }
+    if (!v.physics_cache.empty())
+    {
+        j["physics_cache"] = v.physics_cache;
+    }
+    if (v.action_efficiency)
+    {
+        j["action_efficiency"] = v.action_efficiency;
     }
 }
 
@@ -146,6 +253,11 @@ void from_json(nlohmann::json const& j, LDemoArgs& v)
     if (j.contains("mctruth_filename"))
     {
         j.at("mctruth_filename").get_to(v.mctruth_filename);
+        get_optional(j, "mctruth_buffers", v.mctruth_buffers);
+    }
+    if (j.contains("physics_cache"))
+    {
+        j.at("physics_cache").get_to(v.physics_cache);
     }
     if (j.contains("mctruth_filter"))
     {
@@ -177,10 +289,21 @@ void from_json(nlohmann::json const& j, LDemoArgs& v)
     }
     j.at("initializer_capacity").get_to(v.initializer_capacity);
     j.at("max_events").get_to(v.max_events);
+    get_optional(j, "event_queue_size", v.event_queue_size);
+    if (j.contains("event_distribution"))
+    {
+        static auto const from_string
+            = StringEnumMapper<EventDistribution>::from_cstring_func(
+                to_cstring, "event distribution");
+        v.event_distribution
+            = from_string(j.at("event_distribution").get<std::string>());
+    }
     j.at("secondary_stack_factor").get_to(v.secondary_stack_factor);
     j.at("enable_diagnostics").get_to(v.enable_diagnostics);
     j.at("use_device").get_to(v.use_device);
     j.at("sync").get_to(v.sync);
+    get_optional(j, "action_efficiency", v.action_efficiency);
+    get_optional(j, "share_physics", v.share_physics);
     if (j.contains("mag_field"))
     {
         j.at("mag_field").get_to(v.mag_field);
@@ -215,24 +338,11 @@ TransporterInput load_input(LDemoArgs const& args)
     TransporterInput result;
     CoreParams::Input params;
 
-    ImportData imported_data;
-    if (ends_with(args.physics_filename, ".root"))
-    {
-        // Load imported_data from ROOT file
-        imported_data = RootImporter(args.physics_filename.c_str())();
-    }
-    else if (ends_with(args.physics_filename, ".gdml"))
-    {
-        // Load imported_data directly from Geant4
-        imported_data = GeantImporter(
-            GeantSetup(args.physics_filename, args.geant_options))();
-    }
-    else
-    {
-        CELER_VALIDATE(false,
-                       << "invalid physics filename '" << args.physics_filename
-                       << "' (expected gdml or root)");
-    }
+    // Import physics data, or load it from the cache
+    std::uint64_t const cache_key = args.physics_cache.empty()
+                                        ? 0
+                                        : hash_physics_input(args);
+    ImportData imported_data = load_physics(args, cache_key);
 
     // Create action manager
     {
@@ -301,6 +411,19 @@ TransporterInput load_input(LDemoArgs const& args)
             }
         }
 
+        MpiCommunicator comm;
+        if (args.share_physics
+            && ScopedMpiInit::status() == ScopedMpiInit::Status::initialized)
+        {
+            comm = MpiCommunicator::comm_world();
+            input.shared_comm = &comm;
+        }
+        if (!args.physics_cache.empty())
+        {
+            input.cache_filename = args.physics_cache;
+            input.cache_key = cache_key;
+        }
+
         params.physics = std::make_shared<PhysicsParams>(std::move(input));
     }
 
@@ -376,9 +499,15 @@ TransporterInput load_input(LDemoArgs const& args)
     result.max_steps = args.max_steps;
     result.enable_diagnostics = args.enable_diagnostics;
     result.sync = args.sync;
+    result.count_tracks = args.action_efficiency;
 
     // Save diagnosics
     result.energy_diag = args.energy_diag;
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized)
+    {
+        // Sum diagnostic tallies over all processes
+        result.comm = MpiCommunicator::comm_world();
+    }
 
     CELER_ENSURE(result);
     return result;
@@ -22,6 +22,7 @@
 #include "celeritas/phys/Model.hh"
 #include "celeritas/phys/PrimaryGeneratorOptions.hh"
 
+#include "EventDistributor.hh"
 #include "Transporter.hh"
 
 namespace celeritas
@@ -72,9 +73,12 @@ struct LDemoArgs
     std::string physics_filename;  //!< Path to ROOT exported Geant4 data
     std::string hepmc3_filename;  //!< Path to HepMC3 event data
     std::string mctruth_filename;  //!< Path to ROOT MC truth event data
+    std::string physics_cache;  //!< Optional path to physics cache
 
     // Optional filter for ROOT MC truth data
     MCTruthFilter mctruth_filter;
+    //! Step buffers for writing MC truth in the background (0: synchronous)
+    size_type mctruth_buffers{};
 
     // Optional setup options for generating primaries programmatically
     celeritas::PrimaryGeneratorOptions primary_gen_options;
@@ -85,10 +89,14 @@ struct LDemoArgs
     size_type max_steps = TransporterInput::no_max_steps();
     size_type initializer_capacity{};
     size_type max_events{};
+    size_type event_queue_size{};  //!< Events to read ahead (0: load all)
+    EventDistribution event_distribution{EventDistribution::round_robin};
     real_type secondary_stack_factor{};
     bool enable_diagnostics{};
     bool use_device{};
     bool sync{};
+    bool action_efficiency{};  //!< Count useful tracks in each action
+    bool share_physics{};  //!< Share physics tables among ranks on a node
 
     // Magnetic field vector [* 1/Tesla] and associated field options
     Real3 mag_field{no_field()};
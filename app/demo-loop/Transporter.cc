@@ -23,95 +23,14 @@
 #include "celeritas/global/detail/ActionSequence.hh"
 #include "celeritas/grid/VectorUtils.hh"
 #include "celeritas/phys/Model.hh"
-
-#include "diagnostic/Diagnostic.hh"
-#include "diagnostic/EnergyDiagnostic.hh"
-#include "diagnostic/ParticleProcessDiagnostic.hh"
-#include "diagnostic/StepDiagnostic.hh"
+#include "celeritas/user/EnergyDiagnostic.hh"
+#include "celeritas/user/ParticleProcessDiagnostic.hh"
+#include "celeritas/user/StepDiagnostic.hh"
 
 using namespace celeritas;
 
 namespace demo_loop
 {
-namespace
-{
-//---------------------------------------------------------------------------//
-// HELPER CLASSES AND FUNCTIONS
-//---------------------------------------------------------------------------//
-template<MemSpace M>
-using MemTag = std::integral_constant<MemSpace, M>;
-
-DiagnosticStore::VecUPDiag<MemSpace::host>&
-get_diag_ref(DiagnosticStore& params, MemTag<MemSpace::host>)
-{
-    return params.host;
-}
-
-DiagnosticStore::VecUPDiag<MemSpace::device>&
-get_diag_ref(DiagnosticStore& params, MemTag<MemSpace::device>)
-{
-    return params.device;
-}
-
-//---------------------------------------------------------------------------//
-//! Adapt a vector of diagnostics to the Action interface
-class DiagnosticActionAdapter final : public ExplicitActionInterface
-{
-  public:
-    using SPDiagnostics = std::shared_ptr<DiagnosticStore>;
-
-  public:
-    DiagnosticActionAdapter(ActionId id, SPDiagnostics diag)
-        : id_(id), diagnostics_(diag)
-    {
-        CELER_EXPECT(id_);
-        CELER_EXPECT(diagnostics_);
-    }
-
-    //! Execute the action with host data
-    void execute(CoreHostRef const& core) const final
-    {
-        this->execute_impl(core.states, diagnostics_->host);
-    }
-
-    //! Execute the action with device data
-    void execute(CoreDeviceRef const& core) const final
-    {
-        this->execute_impl(core.states, diagnostics_->device);
-    }
-
-    //!@{
-    //! \name Action interface
-    ActionId action_id() const final { return id_; }
-    std::string label() const final { return "diagnostics"; }
-    std::string description() const final
-    {
-        return "diagnostics after post-step";
-    }
-    ActionOrder order() const final { return ActionOrder::post_post; }
-    //!@}
-
-  private:
-    ActionId id_;
-    SPDiagnostics diagnostics_;
-
-    template<MemSpace M>
-    using VecUPDiag = DiagnosticStore::VecUPDiag<M>;
-
-    template<MemSpace M>
-    void execute_impl(CoreStateData<Ownership::reference, M> const& states,
-                      VecUPDiag<M> const& diagnostics) const
-    {
-        for (auto const& diag_ptr : diagnostics)
-        {
-            diag_ptr->mid_step(states);
-        }
-    }
-};
-
-//---------------------------------------------------------------------------//
-}  // namespace
-
 //---------------------------------------------------------------------------//
 //! Default virtual destructor
 TransporterBase::~TransporterBase() = default;
@@ -131,26 +50,25 @@ Transporter<M>::Transporter(TransporterInput inp)
     // Create diagnostics
     if (input_.enable_diagnostics)
     {
-        diagnostics_ = std::make_shared<DiagnosticStore>();
-        auto& diag = get_diag_ref(*diagnostics_, MemTag<M>{});
-        diag.push_back(std::make_unique<StepDiagnostic<M>>(
-            get_ref<M>(params), params.particle(), input_.num_track_slots, 200));
-        diag.push_back(std::make_unique<ParticleProcessDiagnostic<M>>(
-            get_ref<M>(params), params.particle(), params.physics()));
+        auto& action_reg = *params.action_reg();
+        step_diag_ = std::make_shared<StepDiagnostic>(
+            action_reg.next_id(), params.particle(), 200, 1);
+        action_reg.insert(step_diag_);
+        process_diag_ = std::make_shared<ParticleProcessDiagnostic>(
+            action_reg.next_id(), params.particle(), params.physics(), 1);
+        action_reg.insert(process_diag_);
         {
             auto const& ediag = input_.energy_diag;
             CELER_VALIDATE(ediag.axis >= 'x' && ediag.axis <= 'z',
                            << "Invalid axis '" << ediag.axis
                            << "' (must be x, y, or z)");
-            diag.push_back(std::make_unique<EnergyDiagnostic<M>>(
+            energy_diag_ = std::make_shared<EnergyDiagnostic>(
+                action_reg.next_id(),
                 linspace(ediag.min, ediag.max, ediag.num_bins + 1),
-                static_cast<Axis>(ediag.axis - 'x')));
+                static_cast<Axis>(ediag.axis - 'x'),
+                1);
+            action_reg.insert(energy_diag_);
         }
-
-        // Add diagnostic adapters to action manager
-        diagnostic_action_ = params.action_reg()->next_id();
-        params.action_reg()->insert(std::make_shared<DiagnosticActionAdapter>(
-            diagnostic_action_, diagnostics_));
     }
 }
 
@@ -160,6 +78,78 @@ Transporter<M>::Transporter(TransporterInput inp)
  */
 template<MemSpace M>
 TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
+{
+    // Inject all primaries on the first step
+    return this->transport([&primaries](Stepper<M> const&,
+                                        StepperResult const&) {
+        return std::exchange(primaries, {});
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport events from a source as initializer capacity frees up.
+ *
+ * Before each step, whole events are moved from the source into the
+ * track initializer buffer while fewer initializers are queued than there are
+ * track slots, as long as the event fits in the remaining initializer
+ * capacity. The source is only called when there is room for another event,
+ * so a source that hands out shared work (e.g. dynamic distribution over MPI
+ * processes) gives events to the processes that can start them soonest. The
+ * source should return an empty vector once all events have been read.
+ */
+template<MemSpace M>
+TransporterResult Transporter<M>::operator()(EventSource const& next_event)
+{
+    CELER_EXPECT(next_event);
+
+    VecPrimary pending;
+    VecPrimary primaries;
+    bool exhausted{false};
+    return this->transport([&](Stepper<M> const& step,
+                               StepperResult const& counts) {
+        size_type const capacity
+            = step.core_data().states.init.initializers.capacity();
+        primaries.clear();
+        while (!exhausted
+               && counts.queued + primaries.size() < input_.num_track_slots)
+        {
+            if (pending.empty())
+            {
+                pending = next_event();
+                if (pending.empty())
+                {
+                    exhausted = true;
+                    break;
+                }
+            }
+            if (counts.queued + primaries.size() + pending.size() > capacity)
+            {
+                // Wait for initializers to be consumed
+                break;
+            }
+            primaries.insert(primaries.end(), pending.begin(), pending.end());
+            pending.clear();
+        }
+        CELER_VALIDATE(pending.empty() || !primaries.empty() || counts,
+                       << "event with " << pending.size()
+                       << " primaries exceeds the initializer capacity ("
+                       << capacity << ")");
+        return SpanConstPrimary{make_span(primaries)};
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport until no tracks or primaries remain.
+ *
+ * Before each step, the given function is called with the stepper and the
+ * track counts from the previous step, and it returns the new primaries (if
+ * any) to inject.
+ */
+template<MemSpace M>
+template<class F>
+TransporterResult Transporter<M>::transport(F&& get_primaries)
 {
     Stopwatch get_transport_time;
 
@@ -186,18 +176,34 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
     input.params = input_.params;
     input.num_track_slots = input_.num_track_slots;
     input.sync = input_.sync;
+    input.count_tracks = input_.count_tracks;
     Stepper<M> step(std::move(input));
 
     Stopwatch get_step_time;
     size_type remaining_steps = input_.max_steps;
 
     // Copy primaries to device and transport the first step
-    auto track_counts = step(primaries);
-    append_track_counts(track_counts);
-    result.time.steps.push_back(get_step_time());
+    StepperResult track_counts;
+    if (SpanConstPrimary primaries = get_primaries(step, track_counts);
+        !primaries.empty())
+    {
+        track_counts = step(primaries);
+        append_track_counts(track_counts);
+        result.time.steps.push_back(get_step_time());
+    }
+    else
+    {
+        // E.g. all events were claimed by other processes
+        CELER_LOG_LOCAL(warning) << "No primaries to transport";
+    }
 
-    while (track_counts)
+    while (true)
     {
+        SpanConstPrimary primaries = get_primaries(step, track_counts);
+        if (!track_counts && primaries.empty())
+        {
+            break;
+        }
         if (CELER_UNLIKELY(--remaining_steps == 0))
         {
             CELER_LOG(error) << "Exceeded step count of " << input_.max_steps
@@ -213,7 +219,7 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
         }
 
         get_step_time = {};
-        track_counts = step();
+        track_counts = primaries.empty() ? step() : step(primaries);
         append_track_counts(track_counts);
         result.time.steps.push_back(get_step_time());
     }
@@ -233,15 +239,36 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
         }
     }
 
-    if (diagnostics_)
+    // Save hardware performance counters if enabled with CELER_PERF_COUNTERS
     {
-        CELER_LOG(status) << "Finalizing diagnostic data";
-        // Collect results from diagnostics
-        for (auto& diagnostic : get_diag_ref(*diagnostics_, MemTag<M>{}))
+        auto const& action_seq = step.actions();
+        auto const& names = action_seq.counter_names();
+        auto const& counts = action_seq.accum_counters();
+        for (auto i : range(counts.size()))
         {
-            diagnostic->get_result(&result);
+            auto& action_counts
+                = result.time.counters[action_seq.actions()[i]->label()];
+            for (auto j : range(names.size()))
+            {
+                action_counts[names[j]] = counts[i][j];
+            }
         }
     }
+
+    result.memory = step.memory_usage();
+    if (input_.count_tracks)
+    {
+        result.action_efficiency = step.action_efficiency();
+    }
+
+    if (input_.enable_diagnostics)
+    {
+        CELER_LOG(status) << "Finalizing diagnostic data";
+        // Sum diagnostic tallies over all processes
+        result.steps = step_diag_->steps(input_.comm);
+        result.process = process_diag_->particle_processes(input_.comm);
+        result.edep = energy_diag_->energy_deposition(input_.comm);
+    }
     result.time.total = get_transport_time();
     return result;
 }
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -18,21 +19,23 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/math/NumericLimits.hh"
+#include "corecel/sys/MpiCommunicator.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/global/ActionEfficiency.hh"
+#include "celeritas/global/CoreMemoryUsage.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/phys/Primary.hh"
 
 namespace celeritas
 {
+class EnergyDiagnostic;
+class ParticleProcessDiagnostic;
 struct Primary;
-}
+class StepDiagnostic;
+}  // namespace celeritas
 
 namespace demo_loop
 {
-//---------------------------------------------------------------------------//
-template<celeritas::MemSpace M>
-class Diagnostic;
-
 //---------------------------------------------------------------------------//
 struct EnergyDiagInput
 {
@@ -62,6 +65,7 @@ struct TransporterInput
     std::shared_ptr<CoreParams const> params;
     size_type num_track_slots{};  //!< AKA max_num_tracks
     bool sync{false};  //!< Whether to synchronize device between actions
+    bool count_tracks{false};  //!< Count useful tracks in each action
 
     // Loop control
     size_type max_steps{};
@@ -69,6 +73,7 @@ struct TransporterInput
     // Diagnostic setup
     bool enable_diagnostics{true};
     EnergyDiagInput energy_diag;
+    celeritas::MpiCommunicator comm;  //!< Processes to sum diagnostics over
 
     //! True if all params are assigned
     explicit operator bool() const
@@ -84,11 +89,32 @@ struct TransporterTiming
     using real_type = celeritas::real_type;
     using VecReal = std::vector<real_type>;
     using MapStrReal = std::unordered_map<std::string, real_type>;
+    using MapStrCount = std::unordered_map<std::string, unsigned long long>;
+    using MapStrMapCount = std::unordered_map<std::string, MapStrCount>;
 
     VecReal steps;  //!< Real time per step
     real_type total{};  //!< Total simulation time
     real_type setup{};  //!< One-time initialization cost
     MapStrReal actions{};  //!< Accumulated action timing
+    MapStrMapCount counters{};  //!< Hardware counts per action (optional)
+};
+
+//---------------------------------------------------------------------------//
+//! Per-process counts and timing when running with multiple MPI processes
+struct TransporterRankResult
+{
+    using real_type = celeritas::real_type;
+    using size_type = celeritas::size_type;
+    using VecCount = std::vector<size_type>;
+    using VecReal = std::vector<real_type>;
+
+    VecCount events;  //!< Number of events transported by each rank
+    VecCount steps;  //!< Number of step iterations on each rank
+    VecReal total;  //!< Transport time on each rank
+    VecReal setup;  //!< Setup time on each rank
+
+    //! Whether results were gathered
+    explicit operator bool() const { return !events.empty(); }
 };
 
 //---------------------------------------------------------------------------//
@@ -114,18 +140,9 @@ struct TransporterResult
     MapStringCount process;  //!< Count of particle/process interactions
     MapStringVecCount steps;  //!< Distribution of steps
     TransporterTiming time;  //!< Timing information
-};
-
-//---------------------------------------------------------------------------//
-//! Hack: help adapt demo-loop diagnostics to Transporter/Action
-struct DiagnosticStore
-{
-    using MemSpace = celeritas::MemSpace;
-    template<MemSpace M>
-    using VecUPDiag = std::vector<std::unique_ptr<Diagnostic<M>>>;
-
-    VecUPDiag<MemSpace::host> host;
-    VecUPDiag<MemSpace::device> device;
+    celeritas::CoreMemoryUsage memory;  //!< Params and state memory use
+    celeritas::VecActionEfficiency action_efficiency;  //!< If counted
+    TransporterRankResult ranks;  //!< Per-process summary (MPI only)
 };
 
 //---------------------------------------------------------------------------//
@@ -144,6 +161,8 @@ class TransporterBase
     //!@{
     //! \name Type aliases
     using SpanConstPrimary = celeritas::Span<const celeritas::Primary>;
+    using VecPrimary = std::vector<celeritas::Primary>;
+    using EventSource = std::function<VecPrimary()>;
     using CoreParams = celeritas::CoreParams;
     using ActionId = celeritas::ActionId;
     //!@}
@@ -154,6 +173,9 @@ class TransporterBase
     // Transport the input primaries and all secondaries produced
     virtual TransporterResult operator()(SpanConstPrimary primaries) = 0;
 
+    // Transport events from a source as initializer capacity frees up
+    virtual TransporterResult operator()(EventSource const& next_event) = 0;
+
     //! Access input parameters (TODO hacky)
     CoreParams const& params() const { return *input_.params; }
 
@@ -176,9 +198,16 @@ class Transporter final : public TransporterBase
     // Transport the input primaries and all secondaries produced
     TransporterResult operator()(SpanConstPrimary primaries) final;
 
+    // Transport events from a source as initializer capacity frees up
+    TransporterResult operator()(EventSource const& next_event) final;
+
   private:
-    std::shared_ptr<DiagnosticStore> diagnostics_;
-    celeritas::ActionId diagnostic_action_;
+    std::shared_ptr<celeritas::StepDiagnostic> step_diag_;
+    std::shared_ptr<celeritas::ParticleProcessDiagnostic> process_diag_;
+    std::shared_ptr<celeritas::EnergyDiagnostic> energy_diag_;
+
+    template<class F>
+    TransporterResult transport(F&& get_primaries);
 };
 
 //---------------------------------------------------------------------------//
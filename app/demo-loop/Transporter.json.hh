@@ -21,6 +21,18 @@ inline void to_json(nlohmann::json& j, TransporterTiming const& v)
                        {"total", v.total},
                        {"setup", v.setup},
                        {"actions", v.actions}};
+    if (!v.counters.empty())
+    {
+        j["counters"] = v.counters;
+    }
+}
+
+inline void to_json(nlohmann::json& j, TransporterRankResult const& v)
+{
+    j = nlohmann::json{{"events", v.events},
+                       {"steps", v.steps},
+                       {"total", v.total},
+                       {"setup", v.setup}};
 }
 
 inline void to_json(nlohmann::json& j, TransporterResult const& v)
@@ -32,6 +44,10 @@ inline void to_json(nlohmann::json& j, TransporterResult const& v)
                        {"process", v.process},
                        {"steps", v.steps},
                        {"time", v.time}};
+    if (v.ranks)
+    {
+        j["ranks"] = v.ranks;
+    }
 }
 
 //---------------------------------------------------------------------------//
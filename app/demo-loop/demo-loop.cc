@@ -11,6 +11,7 @@
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <random>
 #include <type_traits>
@@ -19,6 +20,7 @@
 #include <nlohmann/json.hpp>
 
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/io/BuildOutput.hh"
 #include "corecel/io/ExceptionOutput.hh"
@@ -33,11 +35,14 @@
 #include "corecel/sys/KernelRegistry.hh"
 #include "corecel/sys/KernelRegistryIO.json.hh"
 #include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/ext/ScopedRootErrorHandler.hh"
+#include "celeritas/global/ActionEfficiencyOutput.hh"
 #include "celeritas/global/ActionRegistryOutput.hh"
+#include "celeritas/global/CoreMemoryOutput.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/io/EventReader.hh"
 #include "celeritas/io/RootFileManager.hh"
@@ -47,9 +52,12 @@
 #include "celeritas/phys/Primary.hh"
 #include "celeritas/phys/PrimaryGenerator.hh"
 #include "celeritas/phys/PrimaryGeneratorOptions.hh"
+#include "celeritas/user/AsyncStepInterface.hh"
 #include "celeritas/user/StepCollector.hh"
 #include "celeritas/user/StepData.hh"
 
+#include "EventDistributor.hh"
+#include "EventPipeline.hh"
 #include "LDemoIO.hh"
 #include "Transporter.hh"
 #include "Transporter.json.hh"
@@ -94,7 +102,8 @@ bool rsw_filter_match(size_type step_trk_id,
  * `RootStepWriter` filter.
  *
  * Write if any combination of event ID, track ID, and/or parent ID match. If
- * no fields are specified or are set to -1, all steps are stored.
+ * no fields are specified or are set to -1, the filter is empty and all steps
+ * are stored without evaluating it.
  */
 std::function<bool(RootStepWriter::TStepData const&)>
 make_root_step_writer_filter(LDemoArgs const& args)
@@ -110,11 +119,6 @@ make_root_step_writer_filter(LDemoArgs const& args)
                     && rsw_filter_match(step.parent_id, opts.parent_id));
         };
     }
-    else
-    {
-        // No filtering; store all the data
-        rsw_filter = [](RootStepWriter::TStepData const&) { return true; };
-    }
 
     return rsw_filter;
 }
@@ -123,11 +127,18 @@ make_root_step_writer_filter(LDemoArgs const& args)
 /*!
  * Initialize `RootFileManager`, set up step data collection, and write input
  * data to the ROOT file when a valid ROOT MC truth file is provided.
+ *
+ * If MC truth buffers are requested, the steps are written on a background
+ * thread by the asynchronous interface saved to \c async_writer, which must be
+ * flushed before the ROOT file is closed.
  */
 std::shared_ptr<RootFileManager>
 init_root_mctruth_output(LDemoArgs const& run_args,
-                         TransporterBase const* transport_ptr)
+                         TransporterBase const* transport_ptr,
+                         std::shared_ptr<AsyncStepInterface>* async_writer)
 {
+    CELER_EXPECT(async_writer);
+
     std::shared_ptr<RootFileManager> root_manager;
 
     if (run_args.mctruth_filename.empty())
@@ -139,6 +150,8 @@ init_root_mctruth_output(LDemoArgs const& run_args,
     CELER_LOG(info) << "Writing ROOT MC truth output at "
                     << run_args.mctruth_filename;
 
+    // Steps are written from a background thread
+    RootFileManager::enable_thread_safety();
     root_manager
         = std::make_shared<RootFileManager>(run_args.mctruth_filename.c_str());
     auto step_writer = std::make_shared<RootStepWriter>(
@@ -146,9 +159,17 @@ init_root_mctruth_output(LDemoArgs const& run_args,
         transport_ptr->params().particle(),
         StepSelection::all(),
         make_root_step_writer_filter(run_args));
+    StepCollector::SPStepInterface step_callback = step_writer;
+    if (run_args.mctruth_buffers > 0)
+    {
+        *async_writer = std::make_shared<AsyncStepInterface>(
+            std::move(step_writer), run_args.mctruth_buffers);
+        step_callback = *async_writer;
+    }
     auto step_collector = std::make_shared<StepCollector>(
-        StepCollector::VecInterface{step_writer},
+        StepCollector::VecInterface{step_callback},
         transport_ptr->params().geometry(),
+        /* num_streams = */ 1,
         transport_ptr->params().action_reg().get());
 
     // Store input and CoreParams data
@@ -158,11 +179,107 @@ init_root_mctruth_output(LDemoArgs const& run_args,
     return root_manager;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Gather per-process counts and sum timing over all processes.
+ *
+ * The per-step vectors of the result are left as those from the local
+ * process. Action efficiency tallies are summed.
+ */
+void reduce_result(MpiCommunicator const& comm,
+                   size_type num_events,
+                   TransporterResult* result)
+{
+    CELER_EXPECT(result);
+
+    // Each process fills its own slot, and the sum gathers them
+    auto gather = [&comm](auto value) {
+        std::vector<decltype(value)> values(comm.size(), 0);
+        values[comm.rank()] = value;
+        allreduce(comm, Operation::sum, make_span(values));
+        return values;
+    };
+
+    auto& ranks = result->ranks;
+    ranks.events = gather(num_events);
+    ranks.steps = gather(static_cast<size_type>(result->active.size()));
+    ranks.total = gather(result->time.total);
+    ranks.setup = gather(result->time.setup);
+
+    // Sum action times in a consistent order across processes
+    std::map<std::string, real_type> sorted_actions(
+        result->time.actions.begin(), result->time.actions.end());
+    std::vector<real_type> action_times;
+    for (auto const& kv : sorted_actions)
+    {
+        action_times.push_back(kv.second);
+    }
+    allreduce(comm, Operation::sum, make_span(action_times));
+    auto time_iter = action_times.begin();
+    for (auto const& kv : sorted_actions)
+    {
+        result->time.actions[kv.first] = *time_iter++;
+    }
+
+    // Sum hardware counters in a consistent order if all processes have them
+    std::map<std::string, std::map<std::string, unsigned long long>>
+        sorted_counters;
+    for (auto const& kv : result->time.counters)
+    {
+        sorted_counters[kv.first].insert(kv.second.begin(), kv.second.end());
+    }
+    std::vector<unsigned long long> counts;
+    for (auto const& action : sorted_counters)
+    {
+        for (auto const& kv : action.second)
+        {
+            counts.push_back(kv.second);
+        }
+    }
+    if (allreduce(comm, Operation::min, counts.size())
+        == allreduce(comm, Operation::max, counts.size()))
+    {
+        allreduce(comm, Operation::sum, make_span(counts));
+        auto count_iter = counts.begin();
+        for (auto const& action : sorted_counters)
+        {
+            for (auto const& kv : action.second)
+            {
+                result->time.counters[action.first][kv.first] = *count_iter++;
+            }
+        }
+    }
+
+    // Sum action efficiency tallies, which have the same action order on
+    // every process
+    auto& efficiency = result->action_efficiency;
+    if (!efficiency.empty())
+    {
+        std::vector<ActionEfficiency::Count> counts;
+        std::vector<double> times;
+        for (auto const& eff : efficiency)
+        {
+            counts.insert(counts.end(),
+                          {eff.num_launches, eff.launched, eff.useful});
+            times.push_back(eff.time);
+        }
+        allreduce(comm, Operation::sum, make_span(counts));
+        allreduce(comm, Operation::sum, make_span(times));
+        for (auto i : range(efficiency.size()))
+        {
+            efficiency[i].num_launches = counts[3 * i];
+            efficiency[i].launched = counts[3 * i + 1];
+            efficiency[i].useful = counts[3 * i + 2];
+            efficiency[i].time = times[i];
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
  */
-void run(std::istream* is, OutputManager* output)
+void run(std::istream* is, OutputManager* output, MpiCommunicator const& comm)
 {
     // Read input options
     auto inp = nlohmann::json::parse(*is);
@@ -185,6 +302,9 @@ void run(std::istream* is, OutputManager* output)
     // For now, only do a single run
     auto run_args = inp.get<LDemoArgs>();
     CELER_EXPECT(run_args);
+    CELER_VALIDATE(comm.size() == 1 || run_args.mctruth_filename.empty(),
+                   << "MC truth output cannot be written with multiple "
+                      "processes");
     output->insert(std::make_shared<OutputInterfaceAdapter<LDemoArgs>>(
         OutputInterface::Category::input,
         "*",
@@ -208,39 +328,89 @@ void run(std::istream* is, OutputManager* output)
     }
 
     // Initialize RootFileManager and store input data if requested
-    auto root_manager = init_root_mctruth_output(run_args, transport_ptr.get());
+    std::shared_ptr<AsyncStepInterface> async_writer;
+    auto root_manager = init_root_mctruth_output(
+        run_args, transport_ptr.get(), &async_writer);
 
-    // Run all the primaries
-    TransporterResult result;
-    std::vector<Primary> primaries;
+    // Create a function that reads one event at a time
+    TransporterBase::EventSource read_event;
     if (run_args.primary_gen_options)
     {
-        std::mt19937 rng;
-        auto generate_event = PrimaryGenerator<std::mt19937>::from_options(
-            transport_ptr->params().particle(), run_args.primary_gen_options);
-        auto event = generate_event(rng);
-        while (!event.empty())
+        read_event = [generate_event
+                      = PrimaryGenerator<std::mt19937>::from_options(
+                          transport_ptr->params().particle(),
+                          run_args.primary_gen_options),
+                      rng = std::mt19937{}]() mutable {
+            return generate_event(rng);
+        };
+    }
+    else
+    {
+        read_event = EventReader(run_args.hepmc3_filename.c_str(),
+                                 transport_ptr->params().particle());
+    }
+
+    std::shared_ptr<EventDistributor> distribute;
+    if (comm.size() > 1)
+    {
+        // Transport only the subset of events owned by this process
+        distribute = std::make_shared<EventDistributor>(
+            comm, std::move(read_event), run_args.event_distribution);
+        read_event = [distribute] { return (*distribute)(); };
+    }
+
+    // Transport
+    TransporterResult result;
+    if (distribute && run_args.event_distribution == EventDistribution::dynamic)
+    {
+        // Claim events from the shared counter only when track slots free up.
+        // The distributor calls MPI, so it can't be read on another thread.
+        if (run_args.event_queue_size > 0)
         {
-            primaries.insert(primaries.end(), event.begin(), event.end());
-            event = generate_event(rng);
+            CELER_LOG(warning) << "Ignoring event queue size with dynamic "
+                                  "event distribution";
         }
+        result = (*transport_ptr)(read_event);
+    }
+    else if (run_args.event_queue_size > 0)
+    {
+        // Stream events from a background thread as track slots free up
+        EventPipeline pipeline(std::move(read_event),
+                               run_args.event_queue_size);
+        TransporterBase::EventSource next_event
+            = [&pipeline] { return pipeline(); };
+        result = (*transport_ptr)(next_event);
     }
     else
     {
-        EventReader read_event(run_args.hepmc3_filename.c_str(),
-                               transport_ptr->params().particle());
+        // Load all the primaries up front
+        std::vector<Primary> primaries;
         auto event = read_event();
         while (!event.empty())
         {
             primaries.insert(primaries.end(), event.begin(), event.end());
             event = read_event();
         }
+        result = (*transport_ptr)(make_span(primaries));
     }
 
-    // Transport
-    result = (*transport_ptr)(make_span(primaries));
-
     result.time.setup = setup_time;
+    if (async_writer)
+    {
+        // Finish writing MC truth data
+        async_writer->flush();
+    }
+    if (distribute)
+    {
+        reduce_result(comm, distribute->num_events(), &result);
+    }
+    output->insert(
+        std::make_shared<CoreMemoryOutput>(std::move(result.memory)));
+    if (!result.action_efficiency.empty())
+    {
+        output->insert(std::make_shared<ActionEfficiencyOutput>(
+            std::move(result.action_efficiency)));
+    }
 
     // TODO: convert individual results into OutputInterface so we don't have
     // to use this ugly "global" hack
@@ -263,12 +433,6 @@ int main(int argc, char* argv[])
                ? MpiCommunicator{}
                : MpiCommunicator::comm_world());
 
-    if (comm.size() > 1)
-    {
-        CELER_LOG(critical) << "TODO: this app cannot run in parallel";
-        return EXIT_FAILURE;
-    }
-
     // Process input arguments
     std::vector<std::string> args(argv, argv + argc);
     if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
@@ -315,7 +479,7 @@ int main(int argc, char* argv[])
     int return_code = EXIT_SUCCESS;
     try
     {
-        run(instream, &output);
+        run(instream, &output, comm);
     }
     catch (std::exception const& e)
     {
@@ -326,10 +490,13 @@ int main(int argc, char* argv[])
             std::make_shared<ExceptionOutput>(std::current_exception()));
     }
 
-    // Write system properties and (if available) results
-    CELER_LOG(status) << "Saving output";
-    output.output(&cout);
-    cout << endl;
+    if (comm.rank() == 0)
+    {
+        // Write system properties and (if available) results
+        CELER_LOG(status) << "Saving output";
+        output.output(&cout);
+        cout << endl;
+    }
 
     return return_code;
 }
@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Run fixed host problems with demo-loop and compare against a baseline.
+
+Throughput (steps/s and tracks/s) and per-action times are extracted from the
+transporter result and compared to the baseline with relative tolerances.
+The number of steps and tracks is also checked so that a change in the
+simulated physics isn't mistaken for a change in performance. A
+machine-readable report is written for each problem, and the exit code is
+nonzero if any metric regressed.
+
+Use ``--update-baseline`` to replace the baseline entries for the given
+problems with the measured values and record the machine they came from. A
+problem without a baseline entry is an error otherwise. Absolute throughput
+is only comparable on the machine that generated the baseline, so these
+tests are only added when configuring with ``CELERITAS_PERF_TESTS=ON``.
+"""
+import argparse
+import json
+import platform
+import subprocess
+from os import environ, path
+from sys import exit, stderr
+
+# Default relative tolerances
+DEFAULT_TOLERANCE = {
+    # Fractional decrease in throughput
+    'steps_per_s': 0.25,
+    'tracks_per_s': 0.25,
+    # Fractional increase in time for a single action
+    'action_time': 0.5,
+    # Fractional change in number of steps and tracks
+    'count': 0.05,
+    # Actions taking less than this fraction of the total time are ignored
+    'min_action_fraction': 0.01,
+}
+
+# Host problems: physics is loaded from the bundled ROOT export or directly
+# from Geant4 with the given options
+PROBLEMS = {
+    'testem3-flat': {
+        'geometry': 'testem3-flat',
+        'physics': 'testem3-flat.gdml',
+        'primary_gen_options': {
+            'pdg': [11],
+            'num_events': 4,
+            'primaries_per_event': 4,
+            'energy': {'distribution': 'delta', 'params': [1000]},
+            'position': {'distribution': 'delta', 'params': [-22, 0, 0]},
+            'direction': {'distribution': 'delta', 'params': [1, 0, 0]},
+        },
+    },
+    'simple-cms': {
+        'geometry': 'simple-cms',
+        'physics': 'simple-cms.root',
+        'primary_gen_options': {
+            'pdg': [22, 11, -11],
+            'num_events': 4,
+            'primaries_per_event': 6,
+            'energy': {'distribution': 'delta', 'params': [100]},
+            'position': {'distribution': 'delta', 'params': [0, 0, 0]},
+            'direction': {'distribution': 'isotropic', 'params': []},
+        },
+    },
+}
+
+GEANT_OPTIONS = {
+    'rayleigh': True,
+    'eloss_fluctuation': True,
+    'brems': "all",
+    'lpm': True,
+}
+
+
+def strtobool(text):
+    """Convert an environment variable value to a boolean."""
+    text = text.strip().lower()
+    if text in ('y', 'yes', 't', 'true', 'on', '1'):
+        return True
+    if text in ('', 'n', 'no', 'f', 'false', 'off', '0'):
+        return False
+    raise ValueError(f"invalid boolean value {text!r}")
+
+
+def run_problem(exe, data_dir, name, use_vecgeom):
+    problem = PROBLEMS[name]
+    geo_ext = '.gdml' if use_vecgeom else '.org.json'
+    geant_options = dict(GEANT_OPTIONS)
+    geant_options['msc'] = "urban" if use_vecgeom else "none"
+
+    inp = {
+        'use_device': False,
+        'geometry_filename': path.join(data_dir, problem['geometry'] + geo_ext),
+        'physics_filename': path.join(data_dir, problem['physics']),
+        'primary_gen_options': problem['primary_gen_options'],
+        'seed': 12345,
+        'max_num_tracks': 1024,
+        'initializer_capacity': 1024 * 128,
+        'max_events': 1000,
+        'secondary_stack_factor': 3,
+        'enable_diagnostics': True,
+        'sync': True,
+        'brem_combined': True,
+        'geant_options': geant_options,
+    }
+    with open(f'perf-{name}.inp.json', 'w') as f:
+        json.dump(inp, f, indent=1)
+
+    print("Running", exe, "for", name, file=stderr)
+    result = subprocess.run([exe, '-'],
+                            input=json.dumps(inp).encode(),
+                            stdout=subprocess.PIPE)
+    if result.returncode:
+        print(f"fatal: {name} failed with error {result.returncode}")
+        exit(result.returncode)
+
+    out_text = result.stdout.decode()
+    # Filter out spurious output
+    out_text = out_text[out_text.find('\n{') + 1:]
+    try:
+        j = json.loads(out_text)
+    except json.decoder.JSONDecodeError as e:
+        print("error: expected a JSON object but got the following stdout:")
+        print(out_text)
+        print("fatal:", str(e))
+        exit(1)
+
+    with open(f'perf-{name}.out.json', 'w') as f:
+        json.dump(j, f, indent=1)
+    return j['result']
+
+
+def extract_metrics(result):
+    """Get counts, throughput, and action times from a transporter result.
+
+    Every active track takes one step, and the step diagnostic histograms
+    each killed track.
+    """
+    time = result['time']
+    total = time['total']
+    num_steps = sum(result['active'])
+    num_tracks = sum(sum(counts) for counts in result['steps'].values())
+    return {
+        'num_steps': num_steps,
+        'num_tracks': num_tracks,
+        'total_time': total,
+        'setup_time': time['setup'],
+        'steps_per_s': num_steps / total if total > 0 else 0.0,
+        'tracks_per_s': num_tracks / total if total > 0 else 0.0,
+        'actions': time['actions'],
+    }
+
+
+def compare(measured, baseline, tol):
+    """Compare measured metrics to a baseline, returning a list of checks."""
+    checks = []
+
+    def check(metric, value, base, limit, passed):
+        checks.append({
+            'metric': metric,
+            'value': value,
+            'baseline': base,
+            'ratio': value / base if base else None,
+            'limit': limit,
+            'status': "pass" if passed else "fail",
+        })
+
+    for key in ['num_steps', 'num_tracks']:
+        base = baseline[key]
+        lo, hi = base * (1 - tol['count']), base * (1 + tol['count'])
+        value = measured[key]
+        check(key, value, base, [lo, hi], lo <= value <= hi)
+
+    for key in ['steps_per_s', 'tracks_per_s']:
+        base = baseline[key]
+        limit = base * (1 - tol[key])
+        value = measured[key]
+        check(key, value, base, limit, value >= limit)
+
+    min_time = tol['min_action_fraction'] * baseline['total_time']
+    for (label, base) in sorted(baseline['actions'].items()):
+        if base < min_time:
+            continue
+        value = measured['actions'].get(label, 0.0)
+        limit = base * (1 + tol['action_time'])
+        check('actions/' + label, value, base, limit, value <= limit)
+
+    return checks
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument('problems', nargs='+', choices=sorted(PROBLEMS))
+    parser.add_argument('--data-dir', required=True,
+                        help="directory with problem geometry and physics")
+    parser.add_argument('--baseline', required=True,
+                        help="baseline JSON file")
+    parser.add_argument('--update-baseline', action='store_true',
+                        help="overwrite baseline values with measurements")
+    args = parser.parse_args()
+
+    exe = environ.get('CELERITAS_DEMO_EXE', './demo-loop')
+    use_vecgeom = not strtobool(environ.get('CELER_DISABLE_VECGEOM', 'false'))
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    tol = dict(DEFAULT_TOLERANCE)
+    tol.update(baseline.get('tolerance', {}))
+    base_problems = baseline.setdefault('problems', {})
+
+    missing = [name for name in args.problems if name not in base_problems]
+    if missing and not args.update_baseline:
+        print("fatal: no baseline in", args.baseline, "for",
+              ", ".join(missing), file=stderr)
+        print("Run with --update-baseline (or build the perf-update-baseline "
+              "target) on this machine to create it", file=stderr)
+        exit(1)
+
+    machine = {'node': platform.node(), 'platform': platform.platform(),
+               'processor': platform.processor() or platform.machine()}
+    if args.update_baseline:
+        baseline['machine'] = machine
+    elif baseline.get('machine', machine) != machine:
+        print("warning: baseline was generated on a different machine:",
+              json.dumps(baseline['machine']), file=stderr)
+
+    failed = []
+    for name in args.problems:
+        result = run_problem(exe, args.data_dir, name, use_vecgeom)
+        measured = extract_metrics(result)
+
+        report = {'problem': name, 'tolerance': tol, 'measured': measured}
+        if args.update_baseline:
+            base_problems[name] = measured
+            report['status'] = "updated"
+        else:
+            checks = compare(measured, base_problems[name], tol)
+            report['checks'] = checks
+            bad = [c['metric'] for c in checks if c['status'] == "fail"]
+            report['status'] = "fail" if bad else "pass"
+            for metric in bad:
+                failed.append(f"{name}: {metric}")
+
+        outfilename = f'perf-{name}.report.json'
+        with open(outfilename, 'w') as f:
+            json.dump(report, f, indent=1)
+        print(f"{name}: {report['status']} "
+              f"({measured['steps_per_s']:.4g} steps/s, "
+              f"{measured['tracks_per_s']:.4g} tracks/s); "
+              f"report written to {outfilename}", file=stderr)
+
+    if args.update_baseline:
+        with open(args.baseline, 'w') as f:
+            json.dump(baseline, f, indent=1, sort_keys=True)
+            f.write('\n')
+        print("Updated baseline", args.baseline, file=stderr)
+
+    if failed:
+        print("Performance regressions:", *failed, sep="\n  ")
+        exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -23,9 +23,12 @@ except ValueError:
 use_device = not strtobool(environ.get('CELER_DISABLE_DEVICE', 'false'))
 use_vecgeom = not strtobool(environ.get('CELER_DISABLE_VECGEOM', 'false'))
 geant_exp_exe = environ.get('CELER_EXPORT_GEANT_EXE', './celer-export-geant')
+# Optional MPI launch command, e.g. "mpiexec -n 2"
+launcher = environ.get('CELERITAS_DEMO_LAUNCHER', '').split()
 
 run_name = (path.splitext(path.basename(geometry_filename))[0]
-            + ('-gpu' if use_device else '-cpu'))
+            + ('-gpu' if use_device else '-cpu')
+            + ('-mpi' if launcher else ''))
 
 geant_options = {
     'rayleigh': True,
@@ -80,15 +83,24 @@ inp = {
     'brem_combined': True,
     'geant_options': geant_options,
 }
+if launcher:
+    # Processes claim events from a shared counter as they have room
+    inp['event_distribution'] = 'dynamic'
 
-with open(f'{run_name}.inp.json', 'w') as f:
+inp_filename = f'{run_name}.inp.json'
+with open(inp_filename, 'w') as f:
     json.dump(inp, f, indent=1)
 
 exe = environ.get('CELERITAS_DEMO_EXE', './demo-loop')
 print("Running", exe, file=stderr)
-result = subprocess.run([exe, '-'],
-                        input=json.dumps(inp).encode(),
-                        stdout=subprocess.PIPE)
+if launcher:
+    # Only the first process would receive standard input
+    result = subprocess.run(launcher + [exe, inp_filename],
+                            stdout=subprocess.PIPE)
+else:
+    result = subprocess.run([exe, '-'],
+                            input=json.dumps(inp).encode(),
+                            stdout=subprocess.PIPE)
 if result.returncode:
     print("fatal: run failed with error", result.returncode)
     try:
@@ -123,3 +135,11 @@ print("Results written to", outfilename, file=stderr)
 time = j['result']['time'].copy()
 time.pop('steps')
 print(json.dumps(time, indent=1))
+
+if launcher:
+    # Every event is transported by exactly one process
+    events = j['result']['ranks']['events']
+    print("Events per process:", events, file=stderr)
+    if sum(events) != 3:
+        print(f"fatal: expected 3 events but transported {sum(events)}")
+        exit(1)
@@ -69,6 +69,7 @@ CC_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/Types.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/{dir}/launcher/{class}Launcher.hh" // IWYU pragma: associated
 #include "celeritas/phys/InteractionLauncher.hh"
@@ -91,13 +92,17 @@ void {func}_interact(
         core_data,
         model_data,
         {namespace}::{func}_interact_track);
-    #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < core_data.states.size(); ++i)
+    #pragma omp parallel
     {{
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{{i}}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{{i}}, "{func}"));
+        celeritas::ScopedTrace trace("omp", "{func}");
+        #pragma omp for
+        for (celeritas::size_type i = 0; i < core_data.states.size(); ++i)
+        {{
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{{i}}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{{i}}, "{func}"));
+        }}
     }}
     log_and_rethrow(std::move(capture_exception));
 }}
@@ -56,6 +56,7 @@ CC_TEMPLATE = CLIKE_TOP + """\
 
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "corecel/Types.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/track/detail/{clsname}Launcher.hh" // IWYU pragma: associated
@@ -68,13 +69,17 @@ namespace generated
 {{
     MultiExceptionHandler capture_exception;
     detail::{clsname}Launcher<MemSpace::host> launch({kernel_arglist});
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < {num_threads}; ++i)
+    #pragma omp parallel
     {{
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{{i}}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{{i}}, "{funcname}"));
+        ScopedTrace trace("omp", "{funcname}");
+        #pragma omp for
+        for (ThreadId::size_type i = 0; i < {num_threads}; ++i)
+        {{
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{{i}}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{{i}}, "{funcname}"));
+        }}
     }}
     log_and_rethrow(std::move(capture_exception));
 }}
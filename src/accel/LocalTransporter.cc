@@ -7,10 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "LocalTransporter.hh"
 
+#include <algorithm>
 #include <csignal>
 #include <type_traits>
 #include <CLHEP/Units/SystemOfUnits.h>
 #include <G4ParticleDefinition.hh>
+#include <G4Threading.hh>
 #include <G4ThreeVector.hh>
 
 #include "corecel/cont/Span.hh"
@@ -23,6 +25,7 @@
 
 #include "SetupOptions.hh"
 #include "SharedParams.hh"
+#include "detail/OffloadService.hh"
 
 namespace celeritas
 {
@@ -50,12 +53,46 @@ inline Real3 convert_from_geant(G4ThreeVector const& vec, double units)
  */
 LocalTransporter::LocalTransporter(SetupOptions const& options,
                                    SharedParams const& params)
-    : auto_flush_(options.max_num_tracks), max_steps_(options.max_steps)
+    : select_(options)
+    , auto_flush_(options.max_num_tracks)
+    , max_steps_(options.max_steps)
+    , steps_per_push_(options.steps_per_push)
+    , initializer_capacity_(options.initializer_capacity)
 {
     CELER_EXPECT(params);
     particles_ = params.Params()->particle();
 
-    StepperInput inp{params.Params(), options.max_num_tracks, options.sync};
+    auto thread_id = G4Threading::G4GetThreadId();
+    if (auto const& service = params.OffloadService())
+    {
+        // Pass tracks to the shared transport threads in smaller batches
+        service_ = service;
+        worker_ = static_cast<size_type>(thread_id > 0 ? thread_id : 0);
+        CELER_VALIDATE(worker_ < service_->num_workers(),
+                       << "Geant4 thread ID " << thread_id
+                       << " exceeds the number of offloading workers ("
+                       << service_->num_workers() << ")");
+        auto_flush_ = options.service_batch_size;
+        if (auto_flush_ == 0)
+        {
+            auto_flush_ = std::max<size_type>(
+                options.max_num_tracks / service_->num_workers(), 1);
+        }
+        return;
+    }
+
+    // Each worker thread (or the main thread in serial mode) is a stream
+    StreamId stream_id{static_cast<size_type>(thread_id > 0 ? thread_id : 0)};
+    CELER_VALIDATE(stream_id < params.NumStreams(),
+                   << "Geant4 thread ID " << thread_id
+                   << " exceeds the number of Celeritas streams ("
+                   << params.NumStreams() << ")");
+
+    StepperInput inp;
+    inp.params = params.Params();
+    inp.num_track_slots = options.max_num_tracks;
+    inp.sync = options.sync;
+    inp.stream_id = stream_id;
     if (celeritas::device())
     {
         step_ = std::make_shared<Stepper<MemSpace::device>>(inp);
@@ -74,6 +111,9 @@ void LocalTransporter::SetEventId(int id)
 {
     CELER_EXPECT(*this);
     CELER_EXPECT(id >= 0);
+    CELER_VALIDATE(!track_counts_,
+                   << "tracks from event " << event_id_.unchecked_get()
+                   << " were not flushed before starting event " << id);
     event_id_ = EventId(id);
     track_counter_ = 0;
 }
@@ -81,10 +121,16 @@ void LocalTransporter::SetEventId(int id)
 //---------------------------------------------------------------------------//
 /*!
  * Whether Celeritas supports offloading of this track.
+ *
+ * The cheapest criteria are checked first.
  */
 bool LocalTransporter::IsApplicable(G4Track const& g4track) const
 {
     CELER_EXPECT(*this);
+    if (!select_(g4track))
+    {
+        return false;
+    }
     PDGNumber pdg{g4track.GetDefinition()->GetPDGEncoding()};
     return static_cast<bool>(particles_->find(pdg));
 }
@@ -109,6 +155,7 @@ void LocalTransporter::Push(G4Track const& g4track)
     track.position = convert_from_geant(g4track.GetPosition(), CLHEP::cm);
     track.direction = convert_from_geant(g4track.GetMomentumDirection(), 1);
     track.time = convert_from_geant(g4track.GetGlobalTime(), CLHEP::s);
+    track.weight = g4track.GetWeight();
 
     // TODO: Celeritas track IDs are independent from Geant4 track IDs, since
     // they must be sequential from zero for a given event. We may need to save
@@ -118,50 +165,109 @@ void LocalTransporter::Push(G4Track const& g4track)
     track.event_id = event_id_;
 
     buffer_.push_back(track);
-    if (buffer_.size() >= auto_flush_)
+    if (service_)
+    {
+        if (buffer_.size() >= auto_flush_)
+        {
+            // Queue for the transport threads and process returned hits
+            service_->push(worker_, std::move(buffer_));
+            buffer_ = {};
+            service_->process_hits(worker_, event_id_);
+        }
+    }
+    else if (buffer_.size() >= auto_flush_)
     {
-        // TODO: maybe only run one iteration? But then make sure that Flush
-        // still transports active tracks to completion.
-        this->Flush();
+        // Transport for a limited number of steps (or to completion if
+        // steps_per_push is zero) and leave the remaining tracks in flight
+        this->Step(steps_per_push_);
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Transport the buffered tracks and all secondaries produced.
+ * Transport the buffered and in-flight tracks and all secondaries produced.
+ *
+ * This must be called at the end of every event.
  */
 void LocalTransporter::Flush()
 {
     CELER_EXPECT(*this);
-    if (buffer_.empty())
+    if (service_)
+    {
+        if (!buffer_.empty())
+        {
+            service_->push(worker_, std::move(buffer_));
+            buffer_ = {};
+        }
+        CELER_LOG_LOCAL(debug) << "Waiting for Celeritas to complete event "
+                               << event_id_.unchecked_get();
+        service_->flush(worker_, event_id_);
+        return;
+    }
+    if (buffer_.empty() && !track_counts_)
     {
         return;
     }
 
     CELER_LOG_LOCAL(info)
-        << "Transporting " << buffer_.size() << " tracks from event "
-        << event_id_.unchecked_get() << " with Celeritas";
+        << "Transporting " << buffer_.size() << " buffered and "
+        << track_counts_.alive + track_counts_.queued
+        << " in-flight tracks from event " << event_id_.unchecked_get()
+        << " with Celeritas";
 
+    this->Step(0);
+    CELER_ENSURE(buffer_.empty() && !track_counts_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport buffered tracks for at most the given number of step iterations.
+ *
+ * A maximum of zero transports all tracks to completion. In-flight tracks
+ * are stepped first if the initializer queue doesn't have room for the
+ * buffered primaries.
+ */
+void LocalTransporter::Step(size_type max_iters)
+{
     // Abort cleanly for interrupt and user-defined signals
     ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
 
-    // Copy buffered tracks to device and transport the first step
-    auto track_counts = (*step_)(make_span(buffer_));
-    buffer_.clear();
-
-    size_type step_iters = 1;
-
-    while (track_counts)
-    {
-        CELER_VALIDATE(step_iters < max_steps_,
+    size_type num_iters = 0;
+    auto step_once = [&](StepperInterface::SpanConstPrimary primaries) {
+        CELER_VALIDATE(step_iters_ < max_steps_,
                        << "number of step iterations exceeded the allowed "
                           "maximum ("
                        << max_steps_ << ")");
 
-        track_counts = (*step_)();
-        ++step_iters;
+        track_counts_ = primaries.empty() ? (*step_)() : (*step_)(primaries);
+        ++step_iters_;
+        ++num_iters;
 
         CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
+    };
+
+    while (track_counts_
+           && track_counts_.queued + buffer_.size() > initializer_capacity_)
+    {
+        step_once({});
+    }
+
+    if (!buffer_.empty())
+    {
+        // Copy buffered tracks to device and transport the first step
+        step_once(make_span(buffer_));
+        buffer_.clear();
+    }
+
+    while (track_counts_ && (max_iters == 0 || num_iters < max_iters))
+    {
+        step_once({});
+    }
+
+    if (!track_counts_)
+    {
+        // All tracks have completed: reset the step counter
+        step_iters_ = 0;
     }
 }
 
@@ -175,7 +281,7 @@ void LocalTransporter::Flush()
 void LocalTransporter::Finalize()
 {
     CELER_EXPECT(*this);
-    CELER_VALIDATE(buffer_.empty(),
+    CELER_VALIDATE(buffer_.empty() && !track_counts_,
                    << "some offloaded tracks were not flushed");
 
     // Reset all data
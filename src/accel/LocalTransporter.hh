@@ -18,8 +18,14 @@
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/phys/Primary.hh"
 
+#include "detail/OffloadSelector.hh"
+
 namespace celeritas
 {
+namespace detail
+{
+class OffloadService;
+}
 struct SetupOptions;
 class SharedParams;
 
@@ -33,6 +39,27 @@ class SharedParams;
  * - an event action (to set the event ID and flush offloaded tracks at the end
  *   of the event)
  * - a tracking action (to try offloading every track)
+ *
+ * Tracks are applicable for offloading if Celeritas knows their particle
+ * type. If \c SetupOptions lists offload regions or volumes, or has a
+ * minimum offload energy, the track must also start in one of the selected
+ * logical volumes with at least that energy. The volume selection is
+ * precomputed as a lookup table indexed by logical volume instance ID, and
+ * primaries that have not yet been placed in a volume are located with a
+ * thread-local navigator.
+ *
+ * By default, filling the buffer of offloaded tracks transports them and all
+ * their secondaries to completion before returning control to Geant4. If \c
+ * SetupOptions::steps_per_push is nonzero, a full buffer instead runs only
+ * that many step iterations: the remaining tracks stay in flight while
+ * Geant4 continues with the event, and later primaries are added to the
+ * partially filled state. \c Flush must still be called at the end of each
+ * event to transport the remaining tracks to completion.
+ *
+ * If the shared params have an offload service, the transporter has no state
+ * of its own: full buffers are queued for the service's transport threads,
+ * and \c Flush waits for the event's tracks to complete while calling the
+ * worker's sensitive detectors with the returned hits.
  */
 class LocalTransporter
 {
@@ -56,7 +83,7 @@ class LocalTransporter
     // Offload this track
     void Push(G4Track const&);
 
-    // Transport all buffered tracks to completion
+    // Transport all buffered and in-flight tracks to completion
     void Flush();
 
     // Clear local data and return to an invalid state
@@ -65,19 +92,37 @@ class LocalTransporter
     // Number of buffered tracks
     size_type GetBufferSize() const { return buffer_.size(); }
 
+    //! Whether tracks from the current event are still being transported
+    bool HasActiveTracks() const { return static_cast<bool>(track_counts_); }
+
     //! Whether the class instance is initialized
-    explicit operator bool() const { return static_cast<bool>(step_); }
+    explicit operator bool() const
+    {
+        return static_cast<bool>(step_) || static_cast<bool>(service_);
+    }
 
   private:
     std::shared_ptr<ParticleParams const> particles_;
+    detail::OffloadSelector select_;
     std::shared_ptr<StepperInterface> step_;
+    std::shared_ptr<detail::OffloadService> service_;
     std::vector<Primary> buffer_;
+    size_type worker_{};
 
     EventId event_id_;
     TrackId::size_type track_counter_{};
 
     size_type auto_flush_{};
     size_type max_steps_{};
+    size_type steps_per_push_{};
+    size_type initializer_capacity_{};
+
+    // Tracks in flight and step iterations since the state was last empty
+    StepperResult track_counts_;
+    size_type step_iters_{};
+
+    // Transport buffered tracks for a limited number of step iterations
+    void Step(size_type max_iters);
 };
 
 //---------------------------------------------------------------------------//
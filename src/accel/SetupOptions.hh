@@ -34,6 +34,8 @@ struct SDSetupOptions
     bool ignore_zero_deposition{true};
     //! Save energy deposition
     bool energy_deposition{true};
+    //! Save the track weight for variance-reduced problems
+    bool track_weight{false};
     //! Set TouchableHandle for PreStepPoint
     bool locate_touchable{false};
     //! Options for saving and converting beginning-of-step data
@@ -95,6 +97,26 @@ struct SetupOptions
     real_type secondary_stack_factor{};
     //! Sync the GPU at every kernel for error checking
     bool sync{false};
+    //! Step iterations run each time the buffer fills (0: run to completion)
+    size_type steps_per_push{0};
+    //!@}
+
+    //!@{
+    //! \name Offload service options
+    //! Dedicated transport threads shared by all workers (0: disabled)
+    size_type num_service_threads{0};
+    //! Tracks each worker buffers before queuing them (0: divide slots)
+    size_type service_batch_size{0};
+    //!@}
+
+    //!@{
+    //! \name Offload selection
+    //! Geant4 regions in which tracks are offloaded (default: all)
+    VecString offload_regions;
+    //! Logical volumes in which tracks are offloaded (default: all)
+    VecString offload_volumes;
+    //! Minimum kinetic energy [MeV] of offloaded tracks
+    real_type min_offload_energy{0};
     //!@}
 
     //!@{
@@ -113,6 +135,14 @@ struct SetupOptions
     VecString ignore_processes;
     //!@}
 
+    //!@{
+    //! \name Diagnostic options
+    //! Tally steps per track and particle/process interactions
+    bool step_diagnostic{false};
+    //! Steps per track above which tracks are tallied in an overflow bin
+    size_type step_diagnostic_bins{1000};
+    //!@}
+
     //!@{
     //! \name CUDA options
     size_type cuda_stack_size{};
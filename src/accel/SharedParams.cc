@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 #include <CLHEP/Random/Random.h>
+#include <G4MTRunManager.hh>
+#include <G4RunManager.hh>
 
 #include "celeritas_config.h"
 #include "corecel/Assert.hh"
@@ -37,11 +39,15 @@
 #include "celeritas/phys/ProcessBuilder.hh"
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/user/DiagnosticOutput.hh"
+#include "celeritas/user/ParticleProcessDiagnostic.hh"
 #include "celeritas/user/StepCollector.hh"
+#include "celeritas/user/StepDiagnostic.hh"
 
 #include "AlongStepFactory.hh"
 #include "SetupOptions.hh"
 #include "detail/HitManager.hh"
+#include "detail/OffloadService.hh"
 
 #if CELERITAS_USE_JSON
 #    include "corecel/io/BuildOutput.hh"
@@ -104,6 +110,23 @@ build_processes(ImportData const& imported,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of worker threads that may each offload to Celeritas.
+ */
+size_type get_num_streams()
+{
+    auto const* run_man = G4RunManager::GetRunManager();
+    CELER_VALIDATE(run_man,
+                   << "cannot initialize Celeritas without a run manager");
+    if (auto const* mt_run_man = dynamic_cast<G4MTRunManager const*>(run_man))
+    {
+        // Multithreaded or tasking run manager
+        return static_cast<size_type>(mt_run_man->GetNumberOfThreads());
+    }
+    return 1;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -163,6 +186,14 @@ void SharedParams::Finalize()
 {
     CELER_EXPECT(*this);
 
+    // Stop transport threads before writing diagnostics: workers may still
+    // hold a reference to the service
+    if (service_)
+    {
+        service_->stop();
+        service_.reset();
+    }
+
     if (!output_filename_.empty())
     {
 #if CELERITAS_USE_JSON
@@ -190,6 +221,13 @@ void SharedParams::Finalize()
             std::make_shared<PhysicsParamsOutput>(params_->physics()));
         output.insert(
             std::make_shared<ActionRegistryOutput>(params_->action_reg()));
+        if (step_diagnostic_)
+        {
+            DiagnosticOutput::Input diag;
+            diag.steps = step_diagnostic_;
+            diag.processes = process_diagnostic_;
+            output.insert(std::make_shared<DiagnosticOutput>(std::move(diag)));
+        }
 
         std::ofstream outf(output_filename_);
         CELER_VALIDATE(outf,
@@ -348,21 +386,57 @@ void SharedParams::initialize_core(SetupOptions const& options)
         params.init = std::make_shared<TrackInitParams>(input);
     }
 
+    // Each worker thread gets an independent stream of track states, unless
+    // the workers share dedicated transport threads
+    size_type num_workers = get_num_streams();
+    size_type num_service_threads = options.num_service_threads;
+    num_streams_ = num_service_threads > 0 ? num_service_threads : num_workers;
+    CELER_LOG(debug) << "Reserving Celeritas data for " << num_streams_
+                     << " streams";
+
     // Construct sensitive detector callback
     if (options.sd)
     {
-        hit_manager_ = std::make_shared<detail::HitManager>(*params.geometry,
-                                                            options.sd);
+        hit_manager_ = std::make_shared<detail::HitManager>(
+            *params.geometry,
+            options.sd,
+            num_streams_,
+            num_service_threads > 0 ? num_workers : 0);
         step_collector_ = std::make_shared<StepCollector>(
             StepCollector::VecInterface{hit_manager_},
             params.geometry,
+            num_streams_,
             params.action_reg.get());
     }
 
+    // Construct step diagnostics, tallied separately for each stream
+    if (options.step_diagnostic)
+    {
+        step_diagnostic_ = std::make_shared<StepDiagnostic>(
+            params.action_reg->next_id(),
+            params.particle,
+            options.step_diagnostic_bins,
+            num_streams_);
+        params.action_reg->insert(step_diagnostic_);
+        process_diagnostic_ = std::make_shared<ParticleProcessDiagnostic>(
+            params.action_reg->next_id(),
+            params.particle,
+            params.physics,
+            num_streams_);
+        params.action_reg->insert(process_diagnostic_);
+    }
+
     // Create params
     CELER_ASSERT(params);
     params_ = std::make_shared<CoreParams>(std::move(params));
 
+    // Start shared transport threads
+    if (num_service_threads > 0)
+    {
+        service_ = std::make_shared<detail::OffloadService>(
+            options, params_, hit_manager_, num_workers);
+    }
+
     // Save other data as needed
     output_filename_ = options.output_file;
 }
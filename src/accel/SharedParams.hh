@@ -11,16 +11,20 @@
 #include <string>
 
 #include "corecel/Assert.hh"
+#include "corecel/Types.hh"
 
 namespace celeritas
 {
 namespace detail
 {
 class HitManager;
+class OffloadService;
 }
 class CoreParams;
+class ParticleProcessDiagnostic;
 struct SetupOptions;
 class StepCollector;
+class StepDiagnostic;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -34,6 +38,12 @@ class StepCollector;
  * structures (geometry, physics). \c InitializeWorker must subsequently be
  * invoked on all worker threads to set up thread-local data (specifically,
  * CUDA device initialization).
+ *
+ * If \c SetupOptions::num_service_threads is nonzero, initialization also
+ * starts an offload service whose dedicated transport threads are the
+ * Celeritas streams: all worker threads pass their tracks to it, so the
+ * number and size of the Celeritas states are independent of the number of
+ * Geant4 threads.
  */
 class SharedParams
 {
@@ -41,6 +51,7 @@ class SharedParams
     //!@{
     //! \name Type aliases
     using SPConstParams = std::shared_ptr<CoreParams const>;
+    using SPOffloadService = std::shared_ptr<detail::OffloadService>;
     //!@}
 
   public:
@@ -67,6 +78,12 @@ class SharedParams
     // Access constructed Celeritas data
     inline SPConstParams Params() const;
 
+    //! Number of streams (worker or service threads) that may transport
+    size_type NumStreams() const { return num_streams_; }
+
+    //! Shared transport threads, if enabled
+    SPOffloadService const& OffloadService() const { return service_; }
+
     //! Whether this instance is initialized
     explicit operator bool() const { return static_cast<bool>(params_); }
 
@@ -76,7 +93,11 @@ class SharedParams
     std::shared_ptr<CoreParams> params_;
     std::shared_ptr<detail::HitManager> hit_manager_;
     std::shared_ptr<StepCollector> step_collector_;
+    std::shared_ptr<StepDiagnostic> step_diagnostic_;
+    std::shared_ptr<ParticleProcessDiagnostic> process_diagnostic_;
+    SPOffloadService service_;
     std::string output_filename_;
+    size_type num_streams_{0};
 
     //// HELPER FUNCTIONS ////
 
@@ -13,12 +13,14 @@
 #include <G4LogicalVolumeStore.hh>
 
 #include "celeritas_cmake_strings.h"
+#include "corecel/Macros.hh"
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Label.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/io/Logger.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
+#include "celeritas/user/StepData.hh"
 #include "accel/SetupOptions.hh"
 
 #include "HitProcessor.hh"
@@ -37,20 +39,62 @@ void update_selection(StepPointSelection* selection,
     selection->pos = options.position;
     selection->energy = options.kinetic_energy;
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append a single hit from one detector output to another.
+ */
+void append_hit(DetectorStepOutput const& src,
+                size_type i,
+                DetectorStepOutput* dst)
+{
+    auto append = [i](auto const& from, auto& to) {
+        if (!from.empty())
+        {
+            to.push_back(from[i]);
+        }
+    };
+    for (auto sp : range(StepPoint::size_))
+    {
+        append(src.points[sp].time, dst->points[sp].time);
+        append(src.points[sp].pos, dst->points[sp].pos);
+        append(src.points[sp].dir, dst->points[sp].dir);
+        append(src.points[sp].energy, dst->points[sp].energy);
+    }
+    append(src.detector, dst->detector);
+    append(src.track_id, dst->track_id);
+    append(src.event_id, dst->event_id);
+    append(src.parent_id, dst->parent_id);
+    append(src.track_step_count, dst->track_step_count);
+    append(src.step_length, dst->step_length);
+    append(src.weight, dst->weight);
+    append(src.particle, dst->particle);
+    append(src.energy_deposition, dst->energy_deposition);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
 //---------------------------------------------------------------------------//
 /*!
  * Map detector IDs on construction.
+ *
+ * If the number of workers is nonzero, hits are stored by event rather than
+ * processed on the thread that runs the stream.
  */
-HitManager::HitManager(GeoParams const& geo, SDSetupOptions const& setup)
+HitManager::HitManager(GeoParams const& geo,
+                       SDSetupOptions const& setup,
+                       size_type num_streams,
+                       size_type num_workers)
     : nonzero_energy_deposition_(setup.ignore_zero_deposition)
+    , locate_touchable_(setup.locate_touchable)
 {
     CELER_EXPECT(setup.enabled);
+    CELER_EXPECT(num_streams > 0);
 
     // Convert setup options to step data
     selection_.energy_deposition = setup.energy_deposition;
+    selection_.weight = setup.track_weight;
     update_selection(&selection_.points[StepPoint::pre], setup.pre);
     update_selection(&selection_.points[StepPoint::post], setup.post);
     if (setup.locate_touchable)
@@ -59,9 +103,6 @@ HitManager::HitManager(GeoParams const& geo, SDSetupOptions const& setup)
         selection_.points[StepPoint::pre].dir = true;
     }
 
-    // Logical volumes to pass to hit processor
-    std::vector<G4LogicalVolume*> lv_with_sd;
-
     // Helper class to extract GDML names+labels from Geant4 volume
     G4GDMLWriteStructure temp_writer;
 
@@ -102,14 +143,26 @@ HitManager::HitManager(GeoParams const& geo, SDSetupOptions const& setup)
                        << lv->GetName() << "'");
 
         // Add Geant4 volume and corresponding volume ID to list
-        lv_with_sd.push_back(lv);
+        geant_vols_.push_back(lv);
         vecgeom_vols_.push_back(id);
     }
     CELER_VALIDATE(!vecgeom_vols_.empty(),
                    << "no sensitive detectors were found");
 
-    process_hits_ = std::make_unique<HitProcessor>(
-        std::move(lv_with_sd), selection_, setup.locate_touchable);
+    CELER_VALIDATE(!locate_touchable_ || selection_.points[StepPoint::pre].pos,
+                   << "cannot set 'locate_touchable' because the pre-step "
+                      "position is not being collected");
+
+    // Hit processors are created on their stream's thread when first used
+    steps_.resize(num_streams);
+    processors_.resize(num_streams);
+
+    if (num_workers > 0)
+    {
+        // Hits must be sorted by event to return them to the right worker
+        selection_.event_id = true;
+        worker_processors_.resize(num_workers);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -140,11 +193,7 @@ auto HitManager::filters() const -> Filters
  */
 void HitManager::execute(StateHostRef const& data)
 {
-    copy_steps(&steps_, data);
-    if (steps_)
-    {
-        (*process_hits_)(steps_);
-    }
+    this->process_hits(data);
 }
 
 //---------------------------------------------------------------------------//
@@ -153,11 +202,119 @@ void HitManager::execute(StateHostRef const& data)
  */
 void HitManager::execute(StateDeviceRef const& data)
 {
-    copy_steps(&steps_, data);
-    if (steps_)
+    this->process_hits(data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy detector steps and call the stream-local hit processor.
+ */
+template<MemSpace M>
+void HitManager::process_hits(
+    StepStateData<Ownership::reference, M> const& data)
+{
+    CELER_EXPECT(data.stream_id < processors_.size());
+    auto sid = data.stream_id.get();
+
+    DetectorStepOutput& steps = steps_[sid];
+    copy_steps(&steps, data);
+    if (!steps)
+    {
+        return;
+    }
+
+    if (this->deferred())
     {
-        (*process_hits_)(steps_);
+        this->store_deferred(steps);
+        return;
     }
+
+    UPHitProcessor& process = processors_[sid];
+    if (CELER_UNLIKELY(!process))
+    {
+        CELER_LOG_LOCAL(debug) << "Creating hit processor for stream " << sid;
+        process = this->make_processor();
+    }
+    (*process)(steps);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process stored hits for an event on the calling worker thread.
+ *
+ * Hits that are stored while this is executing are left for the next call.
+ */
+void HitManager::process_deferred(size_type worker, EventId event)
+{
+    CELER_EXPECT(worker < worker_processors_.size());
+    CELER_EXPECT(event);
+
+    std::vector<DetectorStepOutput> hits;
+    {
+        std::lock_guard<std::mutex> scoped_lock(deferred_mutex_);
+        auto iter = deferred_hits_.find(event.unchecked_get());
+        if (iter == deferred_hits_.end())
+        {
+            return;
+        }
+        hits = std::move(iter->second);
+        deferred_hits_.erase(iter);
+    }
+
+    UPHitProcessor& process = worker_processors_[worker];
+    if (CELER_UNLIKELY(!process))
+    {
+        CELER_LOG_LOCAL(debug) << "Creating hit processor for worker "
+                               << worker;
+        process = this->make_processor();
+    }
+    for (DetectorStepOutput const& steps : hits)
+    {
+        (*process)(steps);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether any hits are stored for an event.
+ */
+bool HitManager::has_deferred(EventId event)
+{
+    CELER_EXPECT(event);
+    std::lock_guard<std::mutex> scoped_lock(deferred_mutex_);
+    return deferred_hits_.count(event.unchecked_get()) > 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Split copied hits by event and store them for the owning workers.
+ */
+void HitManager::store_deferred(DetectorStepOutput const& steps)
+{
+    CELER_EXPECT(steps.event_id.size() == steps.size());
+
+    std::unordered_map<EventId::size_type, DetectorStepOutput> event_hits;
+    for (auto i : range(steps.size()))
+    {
+        append_hit(steps, i, &event_hits[steps.event_id[i].unchecked_get()]);
+    }
+
+    std::lock_guard<std::mutex> scoped_lock(deferred_mutex_);
+    for (auto& id_hits : event_hits)
+    {
+        deferred_hits_[id_hits.first].push_back(std::move(id_hits.second));
+    }
+    ++num_stores_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a hit processor on the calling thread.
+ */
+auto HitManager::make_processor() const -> UPHitProcessor
+{
+    return std::make_unique<HitProcessor>(
+        geant_vols_, selection_, locate_touchable_);
 }
 
 //---------------------------------------------------------------------------//
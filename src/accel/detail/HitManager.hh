@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "orange/Types.hh"
@@ -15,6 +18,8 @@
 #include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepInterface.hh"
 
+class G4LogicalVolume;
+
 namespace celeritas
 {
 struct SDSetupOptions;
@@ -33,18 +38,31 @@ class HitProcessor;
  * - Finds *all* logical volumes that have SDs attached (TODO: add list of
  *   exclusions?)
  * - Maps those volumes to VecGeom geometry
- * - Creates a HitProcessor for each Geant4 thread
+ * - Reserves a HitProcessor and output buffer for each stream
  *
  * Execute:
- * - Can share DetectorStepOutput across threads for now since StepGatherAction
- *   is mutexed across all threads
- * - Calls a single HitProcessor (thread safe because of caller's mutex)
+ * - Is called concurrently by each stream's thread with that stream's states
+ * - Creates the stream's HitProcessor on first use, so that the Geant4
+ *   navigator and thread-local sensitive detectors belong to the calling
+ *   thread
+ * - Copies to and processes hits from stream-local data without locking
+ *
+ * Deferred execution:
+ * - If constructed with a nonzero number of Geant4 workers, the streams are
+ *   run by dedicated transport threads rather than by the Geant4 workers
+ *   whose sensitive detectors must be called
+ * - Hits are copied from each stream and stored by event ID
+ * - The worker that owns the event processes them on its own thread by
+ *   calling \c process_deferred
  */
 class HitManager final : public StepInterface
 {
   public:
     // Construct with VecGeom for mapping volume IDs
-    HitManager(GeoParams const& geo, SDSetupOptions const& setup);
+    HitManager(GeoParams const& geo,
+               SDSetupOptions const& setup,
+               size_type num_streams,
+               size_type num_workers = 0);
 
     // Default destructor
     ~HitManager();
@@ -61,14 +79,45 @@ class HitManager final : public StepInterface
     // Process device-generated hits
     void execute(StateDeviceRef const&) final;
 
+    // Process stored hits for an event on the calling worker thread
+    void process_deferred(size_type worker, EventId event);
+
+    // Whether any hits are stored for an event
+    bool has_deferred(EventId event);
+
+    //! Whether hits are stored for processing by Geant4 workers
+    bool deferred() const { return !worker_processors_.empty(); }
+
+    //! Number of times that hits have been stored for deferred processing
+    size_type num_deferred_stores() const { return num_stores_.load(); }
+
   private:
+    using VecLV = std::vector<G4LogicalVolume*>;
+    using UPHitProcessor = std::unique_ptr<HitProcessor>;
+
     bool nonzero_energy_deposition_{};
+    bool locate_touchable_{};
     StepSelection selection_;
-    DetectorStepOutput steps_;
+    VecLV geant_vols_;
     std::vector<VolumeId> vecgeom_vols_;
-    std::unique_ptr<HitProcessor> process_hits_;
 
-    void call_local_processor() const;
+    // Stream-local data
+    std::vector<DetectorStepOutput> steps_;
+    std::vector<UPHitProcessor> processors_;
+
+    // Worker-local processors and hits stored by event
+    std::vector<UPHitProcessor> worker_processors_;
+    std::mutex deferred_mutex_;
+    std::unordered_map<EventId::size_type, std::vector<DetectorStepOutput>>
+        deferred_hits_;
+    std::atomic<size_type> num_stores_{0};
+
+    template<MemSpace M>
+    void process_hits(StepStateData<Ownership::reference, M> const& data);
+
+    void store_deferred(DetectorStepOutput const& steps);
+
+    UPHitProcessor make_processor() const;
 };
 
 //---------------------------------------------------------------------------//
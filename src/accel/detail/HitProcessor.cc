@@ -7,10 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "HitProcessor.hh"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <CLHEP/Units/SystemOfUnits.h>
+#include <G4AffineTransform.hh>
 #include <G4LogicalVolume.hh>
+#include <G4NavigationHistory.hh>
 #include <G4Navigator.hh>
 #include <G4Step.hh>
 #include <G4StepPoint.hh>
@@ -19,7 +23,9 @@
 #include <G4TransportationManager.hh>
 #include <G4VPhysicalVolume.hh>
 #include <G4VSensitiveDetector.hh>
+#include <G4VSolid.hh>
 #include <G4Version.hh>
+#include <geomdefs.hh>
 
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
@@ -107,6 +113,32 @@ std::ostream& operator<<(std::ostream& os, PrintableNavHistory const& pnh)
     return os;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a point is strictly inside the touchable's placement.
+ *
+ * This is false if the volume has daughters, since one of them might contain
+ * the point. It's also false for replicated and parameterised placements:
+ * their shared solid and transformation are those of whichever copy was
+ * computed last, which may not be the touchable's copy.
+ */
+bool is_inside_leaf(G4VTouchable const& touchable, G4ThreeVector const& pos)
+{
+    G4VPhysicalVolume const* pv = touchable.GetVolume(0);
+    if (!pv || pv->VolumeType() != kNormal)
+    {
+        return false;
+    }
+    G4LogicalVolume const* lv = pv->GetLogicalVolume();
+    if (lv->GetNoDaughters() > 0)
+    {
+        return false;
+    }
+    G4ThreeVector local
+        = touchable.GetHistory()->GetTopTransform().TransformPoint(pos);
+    return lv->GetSolid()->Inside(local) == kInside;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -124,47 +156,55 @@ HitProcessor::HitProcessor(VecLV detector_volumes,
                    << "cannot set 'locate_touchable' because the pre-step "
                       "position is not being collected");
 
-    // Create temporary objects
-    step_ = std::make_unique<G4Step>();
+    // Create navigator
+    if (locate_touchable && selection.points[StepPoint::pre].pos)
+    {
+        G4VPhysicalVolume* world_volume
+            = G4TransportationManager::GetTransportationManager()
+                  ->GetNavigatorForTracking()
+                  ->GetWorldVolume();
+        navi_ = std::make_unique<G4Navigator>();
+        navi_->SetWorldVolume(world_volume);
+    }
 
 #if G4VERSION_NUMBER >= 1101
-#    define HP_CLEAR_STEP_POINT(CMD) step_->CMD(nullptr)
+#    define HP_CLEAR_STEP_POINT(CMD) step->CMD(nullptr)
 #else
 #    define HP_CLEAR_STEP_POINT(CMD) /* no "reset" before v11.0.1 */
 #endif
 
-#define HP_SETUP_POINT(LOWER, TITLE)                                          \
-    do                                                                        \
-    {                                                                         \
-        if (!selection.points[StepPoint::LOWER])                              \
-        {                                                                     \
-            HP_CLEAR_STEP_POINT(Reset##TITLE##StepPoint);                     \
-        }                                                                     \
-        else                                                                  \
-        {                                                                     \
-            step_->Get##TITLE##StepPoint()->SetStepStatus(fUserDefinedLimit); \
-        }                                                                     \
+#define HP_SETUP_POINT(LOWER, TITLE)                                         \
+    do                                                                       \
+    {                                                                        \
+        if (!selection.points[StepPoint::LOWER])                             \
+        {                                                                    \
+            HP_CLEAR_STEP_POINT(Reset##TITLE##StepPoint);                    \
+        }                                                                    \
+        else                                                                 \
+        {                                                                    \
+            step->Get##TITLE##StepPoint()->SetStepStatus(fUserDefinedLimit); \
+        }                                                                    \
     } while (0)
 
-    HP_SETUP_POINT(pre, Pre);
-    HP_SETUP_POINT(post, Post);
-#undef HP_SETUP_POINT
-#undef HP_CLEAR_STEP_POINT
-
-    // Create navigator
-    G4VPhysicalVolume* world_volume
-        = G4TransportationManager::GetTransportationManager()
-              ->GetNavigatorForTracking()
-              ->GetWorldVolume();
-    if (locate_touchable && selection.points[StepPoint::pre].pos)
+    // Create temporary objects for each detector
+    steps_.resize(detector_volumes_.size());
+    for (auto& step : steps_)
     {
-        navi_ = std::make_unique<G4Navigator>();
-        navi_->SetWorldVolume(world_volume);
+        step = std::make_unique<G4Step>();
+        HP_SETUP_POINT(pre, Pre);
+        HP_SETUP_POINT(post, Post);
 
-        // Create "touchable handle" (shared pointer to G4TouchableHistory)
-        touch_handle_ = new G4TouchableHistory;
-        step_->GetPreStepPoint()->SetTouchableHandle(touch_handle_);
+        if (navi_)
+        {
+            // Create "touchable handle" (shared pointer to
+            // G4TouchableHistory)
+            touch_handles_.emplace_back(new G4TouchableHistory);
+            step->GetPreStepPoint()->SetTouchableHandle(touch_handles_.back());
+        }
     }
+    located_.assign(detector_volumes_.size(), false);
+#undef HP_SETUP_POINT
+#undef HP_CLEAR_STEP_POINT
 }
 
 //---------------------------------------------------------------------------//
@@ -174,7 +214,7 @@ HitProcessor::~HitProcessor() = default;
 /*!
  * Generate and call hits from a detector output.
  */
-void HitProcessor::operator()(DetectorStepOutput const& out) const
+void HitProcessor::operator()(DetectorStepOutput const& out)
 {
     CELER_EXPECT(!out.detector.empty());
     CELER_ASSERT(!navi_ || !out.points[StepPoint::pre].pos.empty());
@@ -182,8 +222,22 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
 
     CELER_LOG_LOCAL(debug) << "Processing " << out.size() << " hits";
 
-    for (auto i : range(out.size()))
+    // Sort hits by detector, preserving their order within each detector
+    order_.resize(out.size());
+    std::iota(order_.begin(), order_.end(), size_type{0});
+    std::stable_sort(
+        order_.begin(), order_.end(), [&out](size_type a, size_type b) {
+            return out.detector[a] < out.detector[b];
+        });
+
+    size_type sd_det = detector_volumes_.size();
+    G4VSensitiveDetector* sd = nullptr;
+    for (size_type i : order_)
     {
+        CELER_ASSERT(out.detector[i] < detector_volumes_.size());
+        size_type det = out.detector[i].unchecked_get();
+        G4Step* step = steps_[det].get();
+
 #define HP_SET(SETTER, OUT, UNITS)                   \
     do                                               \
     {                                                \
@@ -193,15 +247,15 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
         }                                            \
     } while (0)
 
-        HP_SET(step_->SetTotalEnergyDeposit, out.energy_deposition, CLHEP::MeV);
+        HP_SET(step->SetTotalEnergyDeposit, out.energy_deposition, CLHEP::MeV);
         // TODO: how to handle these attributes?
-        // step_->SetTrack(primary_track);
+        // step->SetTrack(primary_track);
 
         // TODO: assert that event ID is consistent with active
         // LocalTransporter event?
 
         EnumArray<StepPoint, G4StepPoint*> points
-            = {step_->GetPreStepPoint(), step_->GetPostStepPoint()};
+            = {step->GetPreStepPoint(), step->GetPostStepPoint()};
         for (auto sp : range(StepPoint::size_))
         {
             if (!points[sp])
@@ -213,25 +267,27 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
             HP_SET(points[sp]->SetKineticEnergy,
                    out.points[sp].energy,
                    CLHEP::MeV);
+            if (!out.weight.empty())
+            {
+                points[sp]->SetWeight(out.weight[i]);
+            }
             // TODO: do we set secondary properties like the velocity,
             // material, mass, charge,  ... ?
 
             // TODO: how to handle these attributes?
-            // step_->SetTrack(primary_track);
+            // step->SetTrack(primary_track);
             // dynamic particle, ParticleDefinition
             // pre->SetLocalTime
             // pre->SetProperTime
-            // pre->SetTouchableHandle
         }
 #undef HP_SET
 
         if (navi_)
         {
-            CELER_ASSERT(out.detector[i] < detector_volumes_.size());
-            bool success = this->update_touchable(
-                out.points[StepPoint::pre].pos[i],
-                out.points[StepPoint::pre].dir[i],
-                detector_volumes_[out.detector[i].unchecked_get()]);
+            bool success
+                = this->update_touchable(det,
+                                         out.points[StepPoint::pre].pos[i],
+                                         out.points[StepPoint::pre].dir[i]);
             if (CELER_UNLIKELY(!success))
             {
                 // Inconsistent touchable: skip this energy deposition
@@ -239,28 +295,36 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
             }
         }
 
-        // Hit sensitive detector (NOTE: GetSensitiveDetector returns a
-        // thread-local object from a global object.)
-        CELER_ASSERT(out.detector[i] < detector_volumes_.size());
-        G4VSensitiveDetector* sd
-            = detector_volumes_[out.detector[i].unchecked_get()]
-                  ->GetSensitiveDetector();
-        CELER_ASSERT(sd);
-        sd->Hit(step_.get());
+        if (det != sd_det)
+        {
+            // Hit sensitive detector (NOTE: GetSensitiveDetector returns a
+            // thread-local object from a global object.)
+            sd = detector_volumes_[det]->GetSensitiveDetector();
+            sd_det = det;
+            CELER_ASSERT(sd);
+        }
+        sd->Hit(step);
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Update the temporary navigation state based on the position and direction.
+ * Update the detector's navigation state based on the position and direction.
  */
-bool HitProcessor::update_touchable(Real3 const& pos,
-                                    Real3 const& dir,
-                                    G4LogicalVolume* lv) const
+bool HitProcessor::update_touchable(size_type det,
+                                    Real3 const& pos,
+                                    Real3 const& dir)
 {
     auto g4pos = convert_to_geant(pos, CLHEP::cm);
     auto g4dir = convert_to_geant(dir, 1);
-    G4VTouchable* touchable = touch_handle_();
+    G4LogicalVolume* lv = detector_volumes_[det];
+    G4VTouchable* touchable = touch_handles_[det]();
+
+    if (located_[det] && is_inside_leaf(*touchable, g4pos))
+    {
+        // Still in the same placement as the previous hit
+        return true;
+    }
 
     // Locate pre-step point
     navi_->LocateGlobalPointAndUpdateTouchable(g4pos,
@@ -271,7 +335,8 @@ bool HitProcessor::update_touchable(Real3 const& pos,
     // Check that physical and logical volumes are consistent
     G4VPhysicalVolume* pv = touchable->GetVolume(0);
     CELER_ASSERT(pv);
-    if (!CELER_UNLIKELY(pv->GetLogicalVolume() != lv))
+    located_[det] = (pv->GetLogicalVolume() == lv);
+    if (located_[det])
     {
         return true;
     }
@@ -316,7 +381,8 @@ bool HitProcessor::update_touchable(Real3 const& pos,
             << max_step / CLHEP::mm << " [mm]";
     }
 
-    if (CELER_UNLIKELY(pv->GetLogicalVolume() != lv))
+    located_[det] = (pv->GetLogicalVolume() == lv);
+    if (CELER_UNLIKELY(!located_[det]))
     {
         CELER_LOG(error)
             << "expected step point at " << repr(g4pos) << " [mm] along "
@@ -324,7 +390,8 @@ bool HitProcessor::update_touchable(Real3 const& pos,
             << "' (ID " << lv->GetInstanceID() << ") but navigation gives "
             << PrintableNavHistory{touchable}
             << ": omitting energy deposition of "
-            << step_->GetTotalEnergyDeposit() / CLHEP::MeV << " [MeV]";
+            << steps_[det]->GetTotalEnergyDeposit() / CLHEP::MeV
+            << " [MeV]";
         return false;
     }
     return true;
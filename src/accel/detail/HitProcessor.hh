@@ -31,24 +31,26 @@ namespace detail
  * Transfer Celeritas sensitive detector hits to Geant4.
  *
  * This serves a similar purpose to the \c G4FastSimHitMaker class for
- * generating hit objects. It should be "stream local" but by necessity has to
- * share the same HitManager which takes the input
- * detector names, maps them to detector IDs, and adds a HitCollector to the
- * action manager.
+ * generating hit objects. It is "stream local": the shared \c HitManager
+ * creates one instance for each stream, on the thread that executes the
+ * stream, so that the navigator and temporary step are never shared.
  *
  * Call operator:
- * - Loop over detector steps
- * - Update step attributes based on hit selection for the detector (TODO:
+ * - Sort detector steps by detector, preserving their order within each
+ *   detector
+ * - Update attributes of the detector's step based on hit selection (TODO:
  *   selection is global for now)
  * - Call the local detector (based on detector ID from map) with the step
  *
- * \note For now we store the LogicalVolume rather than the SD in order to work
- * better with multithreaded code. (The LV `GetSensitiveDetector` returns
- * thread-local data.) This means you can (and should) share the \c
- * HitProcessor instance across threads. Once multithreading is better
- * integrated into Celeritas and we can check how it interacts with CMSSW, then
- * we can make the whole kernel thread safe by ensuring independent hit
- * processors (and state data) for every thread.
+ * Each detector has its own preallocated \c G4Step (and touchable, if
+ * locating), so consecutive hits in a detector only overwrite the selected
+ * attributes. The touchable is only relocated with the navigator if the
+ * pre-step point is not strictly inside the previously located placement,
+ * or if that placement has daughters.
+ *
+ * \note We store the LogicalVolume rather than the SD because the LV
+ * `GetSensitiveDetector` returns thread-local data, so the same list of
+ * volumes can be used to construct the processor on any thread.
  */
 class HitProcessor
 {
@@ -68,21 +70,23 @@ class HitProcessor
     ~HitProcessor();
 
     // Generate and call hits from a detector output
-    void operator()(DetectorStepOutput const& out) const;
+    void operator()(DetectorStepOutput const& out);
 
   private:
     //! Map detector IDs to logical volumes
     VecLV detector_volumes_;
-    //! Temporary step
-    std::unique_ptr<G4Step> step_;
+    //! Reusable step for each detector
+    std::vector<std::unique_ptr<G4Step>> steps_;
     //! Navigator for finding points
     std::unique_ptr<G4Navigator> navi_;
-    //! Geant4 reference-counted pointer to a G4VTouchable
-    G4TouchableHandle touch_handle_;
+    //! Geant4 reference-counted pointers to each detector's G4VTouchable
+    std::vector<G4TouchableHandle> touch_handles_;
+    //! Whether each detector's touchable was successfully located
+    std::vector<bool> located_;
+    //! Temporary hit ordering
+    std::vector<size_type> order_;
 
-    bool update_touchable(Real3 const& pos,
-                          Real3 const& dir,
-                          G4LogicalVolume* lv) const;
+    bool update_touchable(size_type det, Real3 const& pos, Real3 const& dir);
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,173 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadSelector.cc
+//---------------------------------------------------------------------------//
+#include "OffloadSelector.hh"
+
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4Navigator.hh>
+#include <G4Region.hh>
+#include <G4RegionStore.hh>
+#include <G4ThreeVector.hh>
+#include <G4Track.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/io/Logger.hh"
+#include "accel/SetupOptions.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Mark logical volumes in the selected regions or with the selected names.
+ *
+ * The result is indexed by logical volume instance ID and is empty if no
+ * regions or volumes are selected.
+ */
+std::vector<bool> make_offload_volumes(SetupOptions const& options)
+{
+    std::vector<bool> result;
+    if (options.offload_regions.empty() && options.offload_volumes.empty())
+    {
+        return result;
+    }
+
+    std::unordered_set<G4Region const*> regions;
+    for (std::string const& name : options.offload_regions)
+    {
+        G4Region const* region = G4RegionStore::GetInstance()->GetRegion(
+            name, /* verbose = */ false);
+        CELER_VALIDATE(region,
+                       << "offload region '" << name
+                       << "' is not a Geant4 region");
+        regions.insert(region);
+    }
+    std::unordered_set<std::string> names(options.offload_volumes.begin(),
+                                          options.offload_volumes.end());
+    auto missing = names;
+
+    G4LogicalVolumeStore* lv_store = G4LogicalVolumeStore::GetInstance();
+    CELER_ASSERT(lv_store);
+    size_type num_selected = 0;
+    for (G4LogicalVolume const* lv : *lv_store)
+    {
+        CELER_ASSERT(lv && lv->GetInstanceID() >= 0);
+        auto id = static_cast<std::size_t>(lv->GetInstanceID());
+        if (id >= result.size())
+        {
+            result.resize(id + 1, false);
+        }
+        missing.erase(lv->GetName());
+        if (regions.count(lv->GetRegion()) || names.count(lv->GetName()))
+        {
+            result[id] = true;
+            ++num_selected;
+        }
+    }
+    CELER_VALIDATE(missing.empty(),
+                   << "offload volume '" << *missing.begin()
+                   << "' is not a Geant4 logical volume");
+
+    CELER_LOG_LOCAL(debug) << "Offloading tracks in " << num_selected
+                           << " of " << lv_store->size()
+                           << " logical volumes";
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct to accept all tracks.
+ */
+OffloadSelector::OffloadSelector() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the offload selection options.
+ */
+OffloadSelector::OffloadSelector(SetupOptions const& options)
+{
+    CELER_VALIDATE(options.min_offload_energy >= 0,
+                   << "invalid minimum offload energy "
+                   << options.min_offload_energy << " [MeV]");
+    min_energy_ = options.min_offload_energy * CLHEP::MeV;
+    volumes_ = make_offload_volumes(options);
+
+    if (!volumes_.empty())
+    {
+        // Create a navigator for locating primaries
+        G4VPhysicalVolume* world_volume
+            = G4TransportationManager::GetTransportationManager()
+                  ->GetNavigatorForTracking()
+                  ->GetWorldVolume();
+        CELER_VALIDATE(world_volume,
+                       << "detector geometry was not initialized before "
+                          "selecting offload volumes");
+        navi_ = std::make_unique<G4Navigator>();
+        navi_->SetWorldVolume(world_volume);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Default destructor and move
+OffloadSelector::~OffloadSelector() = default;
+OffloadSelector::OffloadSelector(OffloadSelector&&) = default;
+OffloadSelector& OffloadSelector::operator=(OffloadSelector&&) = default;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the track satisfies the energy and location criteria.
+ *
+ * The cheapest criteria are checked first.
+ */
+bool OffloadSelector::operator()(G4Track const& track) const
+{
+    if (track.GetKineticEnergy() < min_energy_)
+    {
+        return false;
+    }
+    if (volumes_.empty())
+    {
+        return true;
+    }
+
+    G4VPhysicalVolume const* pv = track.GetVolume();
+    if (!pv)
+    {
+        // The track hasn't been located yet
+        CELER_ASSERT(navi_);
+        pv = navi_->LocateGlobalPointAndSetup(track.GetPosition(),
+                                              &track.GetMomentumDirection(),
+                                              /* relative_search = */ false);
+        if (!pv)
+        {
+            // Outside the world
+            return false;
+        }
+    }
+    auto id = static_cast<std::size_t>(pv->GetLogicalVolume()->GetInstanceID());
+    return id < volumes_.size() && volumes_[id];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadSelector.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+class G4Navigator;
+class G4Track;
+
+namespace celeritas
+{
+struct SetupOptions;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Select tracks to offload by energy and location.
+ *
+ * Tracks below the minimum energy are rejected. If offload regions or
+ * volumes are given, only tracks in logical volumes belonging to those
+ * regions or with those names are accepted.
+ *
+ * Primaries passed to the pre-tracking action have no touchable yet, so
+ * their volume is found with a navigator. The navigator is created on
+ * construction, so the selector must be constructed on the thread that uses
+ * it after the geometry has been built.
+ */
+class OffloadSelector
+{
+  public:
+    // Construct to accept all tracks
+    OffloadSelector();
+
+    // Construct from the offload selection options
+    explicit OffloadSelector(SetupOptions const& options);
+
+    // Default destructor and move
+    ~OffloadSelector();
+    OffloadSelector(OffloadSelector&&);
+    OffloadSelector& operator=(OffloadSelector&&);
+
+    // Whether the track satisfies the energy and location criteria
+    bool operator()(G4Track const& track) const;
+
+  private:
+    double min_energy_{0};
+    std::vector<bool> volumes_;
+    std::unique_ptr<G4Navigator> navi_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
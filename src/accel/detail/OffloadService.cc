@@ -0,0 +1,437 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadService.cc
+//---------------------------------------------------------------------------//
+#include "OffloadService.hh"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/Stepper.hh"
+#include "accel/SetupOptions.hh"
+#include "accel/SharedParams.hh"
+
+#include "HitManager.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Queue, transport threads, and per-event completion counters.
+ *
+ * The mutex guards the queue, the number of pending and abandoned batches
+ * for each worker's event, the stop flag, and the error. Flushing workers
+ * wait on \c batch_completed , which is notified when batches complete, when
+ * hits are stored for deferred processing, and when transport stops.
+ */
+struct OffloadService::Impl
+{
+    //! Geant4 worker and the event it is processing
+    using WorkerEvent = std::pair<size_type, EventId::size_type>;
+
+    struct Batch
+    {
+        WorkerEvent key;
+        VecPrimary primaries;
+    };
+
+    SPConstParams params;
+    SPHitManager hit_manager;
+    size_type num_track_slots{};
+    size_type initializer_capacity{};
+    size_type max_steps{};
+
+    std::deque<Batch> queued;
+    std::map<WorkerEvent, size_type> pending;
+    std::map<WorkerEvent, size_type> abandoned;
+
+    std::mutex mutex;
+    std::condition_variable batch_queued;
+    std::condition_variable batch_completed;
+    bool stopped{false};
+    std::exception_ptr error;
+
+    std::vector<std::thread> transporters;
+
+    // Transport queued batches on one stream until stopped
+    void transport(SetupOptions const& options, StreamId stream_id);
+
+    // Take enough batches to fill the track slots (caller holds lock)
+    std::vector<Batch> pop_batches();
+
+    // Wake flushing workers if hits were stored since the given count
+    void notify_stored(size_type num_stores);
+
+    // Mark a batch as no longer pending (caller holds lock)
+    void release(WorkerEvent const& key);
+
+    // Rethrow a transport exception (caller holds lock)
+    void rethrow_error() const
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take enough batches to fill the track slots.
+ *
+ * At least one batch is always taken, and more are added as long as the
+ * primaries fit in the initializer queue.
+ */
+auto OffloadService::Impl::pop_batches() -> std::vector<Batch>
+{
+    CELER_EXPECT(!queued.empty());
+
+    std::vector<Batch> result;
+    size_type num_primaries = 0;
+    do
+    {
+        num_primaries += queued.front().primaries.size();
+        result.push_back(std::move(queued.front()));
+        queued.pop_front();
+    } while (!queued.empty() && num_primaries < num_track_slots
+             && num_primaries + queued.front().primaries.size()
+                    <= initializer_capacity);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wake flushing workers if hits were stored since the given count.
+ *
+ * The lock is acquired so that a worker can't miss the notification between
+ * checking for stored hits and waiting.
+ */
+void OffloadService::Impl::notify_stored(size_type num_stores)
+{
+    if (!hit_manager || hit_manager->num_deferred_stores() == num_stores)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> scoped_lock(mutex);
+    }
+    batch_completed.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Mark a batch as no longer pending.
+ */
+void OffloadService::Impl::release(WorkerEvent const& key)
+{
+    auto iter = pending.find(key);
+    CELER_ASSERT(iter != pending.end() && iter->second > 0);
+    if (--iter->second == 0)
+    {
+        pending.erase(iter);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport queued batches on one stream until stopped.
+ *
+ * A batch that has been taken from the queue is always transported to
+ * completion, even if the service is stopped in the meantime.
+ */
+void OffloadService::Impl::transport(SetupOptions const& options,
+                                     StreamId stream_id)
+{
+    std::exception_ptr transport_error;
+    try
+    {
+        // Set up thread-local device data
+        SharedParams::InitializeWorker(options);
+
+        StepperInput inp;
+        inp.params = params;
+        inp.num_track_slots = num_track_slots;
+        inp.sync = options.sync;
+        inp.stream_id = stream_id;
+        std::shared_ptr<StepperInterface> step;
+        if (celeritas::device())
+        {
+            step = std::make_shared<Stepper<MemSpace::device>>(inp);
+        }
+        else
+        {
+            step = std::make_shared<Stepper<MemSpace::host>>(inp);
+        }
+
+        VecPrimary primaries;
+        while (true)
+        {
+            std::vector<Batch> batches;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                batch_queued.wait(lock, [this] {
+                    return stopped || !queued.empty();
+                });
+                if (stopped)
+                {
+                    return;
+                }
+                batches = this->pop_batches();
+            }
+
+            primaries.clear();
+            for (Batch const& b : batches)
+            {
+                primaries.insert(
+                    primaries.end(), b.primaries.begin(), b.primaries.end());
+            }
+
+            // Transport the combined primaries and all secondaries
+            auto num_stores = hit_manager ? hit_manager->num_deferred_stores()
+                                          : 0;
+            auto track_counts = (*step)(make_span(primaries));
+            size_type step_iters = 1;
+            while (track_counts)
+            {
+                CELER_VALIDATE(step_iters < max_steps,
+                               << "number of step iterations exceeded the "
+                                  "allowed maximum ("
+                               << max_steps << ")");
+                this->notify_stored(num_stores);
+                num_stores = hit_manager ? hit_manager->num_deferred_stores()
+                                         : 0;
+                track_counts = (*step)();
+                ++step_iters;
+            }
+
+            // Hits have all been stored: release the workers' events
+            {
+                std::lock_guard<std::mutex> scoped_lock(mutex);
+                for (Batch const& b : batches)
+                {
+                    this->release(b.key);
+                }
+            }
+            batch_completed.notify_all();
+        }
+    }
+    catch (...)
+    {
+        transport_error = std::current_exception();
+    }
+
+    // Stop all transport threads and let the workers rethrow
+    {
+        std::lock_guard<std::mutex> scoped_lock(mutex);
+        if (!error)
+        {
+            error = std::move(transport_error);
+        }
+        stopped = true;
+    }
+    batch_queued.notify_all();
+    batch_completed.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start transport threads.
+ *
+ * The number of transport threads is the number of Celeritas streams.
+ */
+OffloadService::OffloadService(SetupOptions const& options,
+                               SPConstParams params,
+                               SPHitManager hit_manager,
+                               size_type num_workers)
+    : num_workers_(num_workers), impl_(std::make_unique<Impl>())
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(!hit_manager || hit_manager->deferred());
+    CELER_EXPECT(num_workers > 0);
+    CELER_VALIDATE(options.num_service_threads > 0,
+                   << "number of offload service threads must be positive");
+    CELER_VALIDATE(options.max_num_tracks > 0,
+                   << "number of track slots has not been set");
+
+    impl_->params = std::move(params);
+    impl_->hit_manager = std::move(hit_manager);
+    impl_->num_track_slots = options.max_num_tracks;
+    impl_->initializer_capacity = options.initializer_capacity;
+    impl_->max_steps = options.max_steps;
+
+    CELER_LOG(status) << "Starting " << options.num_service_threads
+                      << " Celeritas transport threads for " << num_workers
+                      << " Geant4 workers";
+    for (auto i : range(options.num_service_threads))
+    {
+        impl_->transporters.emplace_back(
+            [impl = impl_.get(), options, i] {
+                impl->transport(options, StreamId{i});
+            });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop and join transport threads.
+ */
+OffloadService::~OffloadService()
+{
+    this->stop();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop transport threads and wait for them to finish.
+ *
+ * Batches being transported are completed, but batches still in the queue
+ * are abandoned. Workers waiting to flush an event with abandoned batches
+ * are woken and throw an error, since the hits for that event are
+ * incomplete. All workers should have flushed their events before the end of
+ * the run.
+ */
+void OffloadService::stop()
+{
+    {
+        std::lock_guard<std::mutex> scoped_lock(impl_->mutex);
+        if (!impl_->queued.empty())
+        {
+            CELER_LOG(warning) << "Stopping offload service with "
+                               << impl_->queued.size()
+                               << " unflushed batches of offloaded tracks";
+        }
+        for (Impl::Batch const& b : impl_->queued)
+        {
+            impl_->release(b.key);
+            ++impl_->abandoned[b.key];
+        }
+        impl_->queued.clear();
+        impl_->stopped = true;
+    }
+    impl_->batch_queued.notify_all();
+    impl_->batch_completed.notify_all();
+    for (std::thread& t : impl_->transporters)
+    {
+        if (t.joinable())
+        {
+            t.join();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue a batch of primaries from a worker.
+ *
+ * All primaries in the batch must belong to the event currently being
+ * processed by the worker.
+ */
+void OffloadService::push(size_type worker, VecPrimary&& primaries)
+{
+    CELER_EXPECT(worker < num_workers_);
+    CELER_EXPECT(!primaries.empty());
+    CELER_EXPECT(primaries.front().event_id);
+    CELER_EXPECT(std::all_of(
+        primaries.begin(), primaries.end(), [&primaries](Primary const& p) {
+            return p.event_id == primaries.front().event_id;
+        }));
+
+    Impl::WorkerEvent key{worker, primaries.front().event_id.get()};
+    {
+        std::lock_guard<std::mutex> scoped_lock(impl_->mutex);
+        impl_->rethrow_error();
+        CELER_VALIDATE(!impl_->stopped,
+                       << "offload service has already been stopped");
+        ++impl_->pending[key];
+        impl_->queued.push_back({key, std::move(primaries)});
+    }
+    impl_->batch_queued.notify_one();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process hits for the worker's event that are ready.
+ *
+ * This should be called periodically during the event so that stored hits
+ * don't accumulate.
+ */
+void OffloadService::process_hits(size_type worker, EventId event)
+{
+    CELER_EXPECT(worker < num_workers_);
+    if (impl_->hit_manager)
+    {
+        impl_->hit_manager->process_deferred(worker, event);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for the tracks of the worker's event to complete while processing
+ * its hits.
+ *
+ * Hits are stored before the batches that produced them are marked complete,
+ * so all hits for the event have been processed when this returns. Batches
+ * from other events or workers are not waited on. An error is thrown if the
+ * service was stopped before all batches for the event were transported.
+ */
+void OffloadService::flush(size_type worker, EventId event)
+{
+    CELER_EXPECT(worker < num_workers_);
+    CELER_EXPECT(event);
+
+    Impl::WorkerEvent const key{worker, event.get()};
+    auto& hit_manager = impl_->hit_manager;
+    std::unique_lock<std::mutex> lock(impl_->mutex);
+    while (true)
+    {
+        impl_->rethrow_error();
+        size_type num_abandoned = 0;
+        if (auto iter = impl_->abandoned.find(key);
+            iter != impl_->abandoned.end())
+        {
+            num_abandoned = iter->second;
+            impl_->abandoned.erase(iter);
+        }
+        CELER_VALIDATE(num_abandoned == 0,
+                       << "offload service was stopped before "
+                       << num_abandoned << " batches of tracks from event "
+                       << event.get() << " on worker " << worker
+                       << " were transported");
+        bool complete = (impl_->pending.count(key) == 0);
+        lock.unlock();
+        this->process_hits(worker, event);
+        if (complete)
+        {
+            return;
+        }
+        lock.lock();
+
+        // Sleep until the batches complete or more hits are ready
+        impl_->batch_completed.wait(lock, [&] {
+            return impl_->pending.count(key) == 0 || impl_->error
+                   || impl_->abandoned.count(key) > 0
+                   || (hit_manager && hit_manager->has_deferred(event));
+        });
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
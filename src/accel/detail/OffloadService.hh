@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadService.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace celeritas
+{
+class CoreParams;
+struct SetupOptions;
+
+namespace detail
+{
+class HitManager;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport tracks from all Geant4 workers on dedicated threads.
+ *
+ * Construction:
+ * - Created during SharedParams::Initialize when \c
+ *   SetupOptions::num_service_threads is nonzero
+ * - Starts one transport thread per Celeritas stream, each with its own
+ *   (large) stepper
+ *
+ * Execute:
+ * - Geant4 workers push batches of primaries into a single multi-producer
+ *   queue; pushing only blocks for a brief queue lock
+ * - Each idle transport thread takes enough queued batches (from any
+ *   worker) to fill its track slots and transports them and their
+ *   secondaries to completion
+ * - Hits are stored by event in the \c HitManager, and each worker
+ *   processes the hits for its own event on its own thread when flushing
+ *
+ * The number of outstanding batches for each worker and event determines
+ * when the event is complete. An exception from a transport thread stops all
+ * transport threads and is rethrown to the workers. Stopping the service
+ * abandons queued batches, and workers flushing those events throw an error.
+ */
+class OffloadService
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParams = std::shared_ptr<CoreParams const>;
+    using SPHitManager = std::shared_ptr<HitManager>;
+    using VecPrimary = std::vector<Primary>;
+    //!@}
+
+  public:
+    // Start transport threads
+    OffloadService(SetupOptions const& options,
+                   SPConstParams params,
+                   SPHitManager hit_manager,
+                   size_type num_workers);
+
+    // Stop and join transport threads
+    ~OffloadService();
+
+    // Stop transport threads and wait for them to finish
+    void stop();
+
+    // Queue a batch of primaries from a worker
+    void push(size_type worker, VecPrimary&& primaries);
+
+    // Process hits for the worker's event that are ready
+    void process_hits(size_type worker, EventId event);
+
+    // Wait for the worker's event to complete while processing its hits
+    void flush(size_type worker, EventId event);
+
+    //! Number of Geant4 workers that may push tracks
+    size_type num_workers() const { return num_workers_; }
+
+  private:
+    struct Impl;
+
+    size_type num_workers_;
+    std::unique_ptr<Impl> impl_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
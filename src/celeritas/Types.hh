@@ -47,6 +47,12 @@ using ParticleId = OpaqueId<struct ParticleRecord>;
 //! Opaque index of physics process
 using ProcessId = OpaqueId<class Process>;
 
+//! Opaque index of a set of volumes sharing cutoffs and step limits
+using RegionId = OpaqueId<struct Region>;
+
+//! Index of a simultaneously executing set of track states (e.g. a thread)
+using StreamId = OpaqueId<struct Stream>;
+
 //! Unique ID (for an event) of a track among all primaries and secondaries
 using TrackId = OpaqueId<struct Track>;
 
@@ -0,0 +1,147 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/FastShower.cc
+//---------------------------------------------------------------------------//
+#include "FastShower.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "detail/FastShowerAction.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with particles and options, and register actions.
+ */
+FastShower::FastShower(ParticleParams const& particles,
+                       Input inp,
+                       size_type num_streams,
+                       ActionRegistry* action_registry)
+    : storage_(std::make_shared<detail::FastShowerStorage>())
+{
+    CELER_EXPECT(num_streams > 0);
+    CELER_EXPECT(action_registry);
+    CELER_VALIDATE(!inp.volumes.empty(),
+                   << "no volumes were given for shower parameterization");
+    CELER_VALIDATE(inp.min_energy > zero_quantity(),
+                   << "invalid minimum shower energy "
+                   << inp.min_energy.value() << " [MeV] (must be positive)");
+    CELER_VALIDATE(inp.profile_b > 0,
+                   << "invalid longitudinal profile parameter b="
+                   << inp.profile_b << " (must be positive)");
+    CELER_VALIDATE(inp.step_depth > 0,
+                   << "invalid shower spot depth " << inp.step_depth
+                   << " [X0] (must be positive)");
+    CELER_VALIDATE(inp.tail_fraction > 0 && inp.tail_fraction < 1,
+                   << "invalid shower tail fraction " << inp.tail_fraction
+                   << " (must be in (0, 1))");
+
+    HostVal<FastShowerParamsData> host_data;
+    host_data.select_action = action_registry->next_id();
+    host_data.action = ActionId{host_data.select_action.get() + 1};
+    host_data.min_energy = inp.min_energy;
+    host_data.profile_b = inp.profile_b;
+    host_data.step_depth = inp.step_depth;
+    host_data.tail_fraction = inp.tail_fraction;
+
+    // Map particle types to shower types
+    {
+        std::vector<ShowerParticle> showers(particles.size(),
+                                            ShowerParticle::none);
+        auto set_shower = [&](PDGNumber pdg, ShowerParticle shower) {
+            if (ParticleId pid = particles.find(pdg))
+            {
+                showers[pid.get()] = shower;
+            }
+        };
+        set_shower(pdg::electron(), ShowerParticle::electron);
+        set_shower(pdg::positron(), ShowerParticle::positron);
+        set_shower(pdg::gamma(), ShowerParticle::photon);
+        make_builder(&host_data.particles)
+            .insert_back(showers.begin(), showers.end());
+    }
+
+    // Flag parameterized volumes
+    {
+        std::vector<char> volumes;
+        for (VolumeId v : inp.volumes)
+        {
+            CELER_VALIDATE(v, << "invalid volume for shower parameterization");
+            if (v.get() >= volumes.size())
+            {
+                volumes.resize(v.get() + 1, false);
+            }
+            volumes[v.get()] = true;
+        }
+        make_builder(&host_data.volumes)
+            .insert_back(volumes.begin(), volumes.end());
+    }
+
+    CELER_ASSERT(host_data);
+    storage_->params
+        = CollectionMirror<FastShowerParamsData>{std::move(host_data)};
+
+    // Reserve a slot for each stream's states (allocated on first use)
+    storage_->states.host.resize(num_streams);
+    storage_->states.device.resize(num_streams);
+
+    // Add selection and transport actions
+    select_action_
+        = std::make_shared<detail::FastShowerAction<ActionOrder::pre>>(
+            action_registry->next_id(), storage_);
+    action_registry->insert(select_action_);
+    step_action_
+        = std::make_shared<detail::FastShowerAction<ActionOrder::along>>(
+            action_registry->next_id(), storage_);
+    action_registry->insert(step_action_);
+    CELER_ENSURE(select_action_->action_id() == this->host_ref().select_action
+                 && step_action_->action_id() == this->action_id());
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Default destructor and move
+FastShower::~FastShower() = default;
+FastShower::FastShower(FastShower&&) = default;
+FastShower& FastShower::operator=(FastShower&&) = default;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * ID of the action that transports shower tracks.
+ */
+ActionId FastShower::action_id() const
+{
+    return this->host_ref().action;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on the host.
+ */
+HostCRef<FastShowerParamsData> const& FastShower::host_ref() const
+{
+    return storage_->params.host_ref();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on the device.
+ */
+DeviceCRef<FastShowerParamsData> const& FastShower::device_ref() const
+{
+    return storage_->params.device_ref();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
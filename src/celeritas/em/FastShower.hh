@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/FastShower.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "orange/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+#include "data/FastShowerData.hh"
+
+namespace celeritas
+{
+class ActionRegistry;
+class ParticleParams;
+
+namespace detail
+{
+template<ActionOrder O>
+class FastShowerAction;
+struct FastShowerStorage;
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace electromagnetic showers in selected volumes with a parameterization.
+ *
+ * Electrons, positrons, and photons above an energy threshold that start a
+ * step inside one of the given volumes are "fast simulated" for the rest of
+ * their lives: instead of being transported by the problem's along-step
+ * action, they move along the shower axis and deposit energy in a series of
+ * spots sampled from GFlash-style longitudinal and radial shower profiles.
+ * The longitudinal profile is integrated over the radiation lengths of every
+ * volume the shower axis crosses, so the shower may extend outside the
+ * selected volumes. Positrons also deposit their annihilation energy.
+ *
+ * Each spot is recorded as a step of the track, so step collectors (and thus
+ * sensitive detector callbacks) see it exactly like a detailed step, including
+ * its statistical weight. This registers a pre-step action that selects
+ * tracks and an along-step action that deposits the spots.
+ */
+class FastShower
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    //!@}
+
+    struct Input
+    {
+        std::vector<VolumeId> volumes;  //!< Parameterized volumes
+        Energy min_energy{1000};  //!< Minimum energy to parameterize
+        real_type profile_b{0.5};  //!< Longitudinal profile scale
+        real_type step_depth{1};  //!< Maximum depth per spot [rad length]
+        real_type tail_fraction{1e-3};  //!< Energy fraction of the last spot
+    };
+
+  public:
+    // Construct with particles and options, and register actions
+    FastShower(ParticleParams const& particles,
+               Input,
+               size_type num_streams,
+               ActionRegistry* action_registry);
+
+    // Default destructor and move
+    ~FastShower();
+    FastShower(FastShower&&);
+    FastShower& operator=(FastShower&&);
+
+    // ID of the action that transports shower tracks
+    ActionId action_id() const;
+
+    // Access data on the host
+    HostCRef<FastShowerParamsData> const& host_ref() const;
+
+    // Access data on the device
+    DeviceCRef<FastShowerParamsData> const& device_ref() const;
+
+  private:
+    template<ActionOrder O>
+    using SPAction = std::shared_ptr<detail::FastShowerAction<O>>;
+    using SPStorage = std::shared_ptr<detail::FastShowerStorage>;
+
+    SPStorage storage_;
+    SPAction<ActionOrder::pre> select_action_;
+    SPAction<ActionOrder::along> step_action_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/data/FastShowerData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "orange/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Type of shower initiated by a particle
+enum class ShowerParticle : char
+{
+    none,  //!< Not parameterized
+    electron,  //!< Electron
+    positron,  //!< Positron (deposits its rest mass when annihilating)
+    photon,  //!< Gamma
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Data for parameterized electromagnetic showers.
+ *
+ * The longitudinal profile is a gamma distribution in units of radiation
+ * length whose maximum is at \f$ t_\mathrm{max} = \ln(E/E_c) + C \f$, with
+ * \f$ C = -0.5 \f$ for electrons and \f$ C = 0.5 \f$ for photons. The radial
+ * profile is scaled by the Moliere radius.
+ */
+template<Ownership W, MemSpace M>
+struct FastShowerParamsData
+{
+    //// TYPES ////
+
+    using Energy = units::MevEnergy;
+
+    //// DATA ////
+
+    ActionId select_action;  //!< ID of the shower selection action
+    ActionId action;  //!< ID of the shower transport action
+    Energy min_energy;  //!< Minimum energy to parameterize a shower
+    real_type profile_b{0.5};  //!< Longitudinal profile scale parameter
+    real_type step_depth{1};  //!< Maximum depth of a spot [rad length]
+    real_type tail_fraction{1e-3};  //!< Fraction of energy in the last spot
+
+    Collection<ShowerParticle, W, M, ParticleId> particles;
+    Collection<char, W, M, VolumeId> volumes;  //!< Whether parameterized
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return select_action && action && min_energy > zero_quantity()
+               && profile_b > 0 && step_depth > 0 && tail_fraction > 0
+               && tail_fraction < 1 && !particles.empty() && !volumes.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    FastShowerParamsData& operator=(FastShowerParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        select_action = other.select_action;
+        action = other.action;
+        min_energy = other.min_energy;
+        profile_b = other.profile_b;
+        step_depth = other.step_depth;
+        tail_fraction = other.tail_fraction;
+        particles = other.particles;
+        volumes = other.volumes;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shower in progress for each track slot.
+ *
+ * A track that starts a shower keeps its position on the shower axis, the
+ * depth along the axis in radiation lengths, the total shower energy, and the
+ * shape of its longitudinal profile. These are only valid while the track is
+ * being transported by the fast shower action.
+ */
+template<Ownership W, MemSpace M>
+struct FastShowerStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using StateItems = celeritas::StateCollection<T, W, M>;
+
+    //// DATA ////
+
+    StateItems<Real3> axis;  //!< Current point on the shower axis
+    StateItems<real_type> depth;  //!< Depth along the axis [rad length]
+    StateItems<real_type> energy;  //!< Total shower energy [MeV]
+    StateItems<real_type> alpha;  //!< Longitudinal profile shape
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !axis.empty() && depth.size() == axis.size()
+               && energy.size() == axis.size() && alpha.size() == axis.size();
+    }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return axis.size(); }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    FastShowerStateData& operator=(FastShowerStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        axis = other.axis;
+        depth = other.depth;
+        energy = other.energy;
+        alpha = other.alpha;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize shower states.
+ */
+template<MemSpace M>
+inline void resize(FastShowerStateData<Ownership::value, M>* data,
+                   HostCRef<FastShowerParamsData> const&,
+                   size_type size)
+{
+    CELER_EXPECT(size > 0);
+    resize(&data->axis, size);
+    resize(&data->depth, size);
+    resize(&data->energy, size);
+    resize(&data->alpha, size);
+    CELER_ENSURE(*data);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,114 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/detail/FastShowerAction.cc
+//---------------------------------------------------------------------------//
+#include "FastShowerAction.hh"
+
+#include <string>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/TraceRecorder.hh"
+#include "celeritas/global/KernelContextException.hh"
+
+#include "FastShowerLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+template<ActionOrder O>
+void fast_shower_device(CoreRef<MemSpace::device> const& core,
+                        DeviceCRef<FastShowerParamsData> const& shower_params,
+                        DeviceRef<FastShowerStateData> const& shower_state);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID and shared storage.
+ */
+template<ActionOrder O>
+FastShowerAction<O>::FastShowerAction(ActionId id, SPStorage storage)
+    : id_(id), storage_(std::move(storage))
+{
+    CELER_EXPECT(id_);
+    CELER_EXPECT(storage_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Description of the action.
+ */
+template<ActionOrder O>
+std::string FastShowerAction<O>::description() const
+{
+    return O == ActionOrder::pre ? "select tracks for parameterized showers"
+                                 : "parameterized electromagnetic shower";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the fast shower action on host.
+ */
+template<ActionOrder O>
+void FastShowerAction<O>::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+
+    using Launcher = std::conditional_t<O == ActionOrder::pre,
+                                        FastShowerSelectLauncher,
+                                        FastShowerStepLauncher>;
+
+    auto const& shower_state = this->get_state(data);
+    CELER_ASSERT(shower_state.size() == data.states.size());
+
+    MultiExceptionHandler capture_exception;
+    Launcher launch{data, storage_->params.host_ref(), shower_state};
+    std::string const label = this->label();
+#pragma omp parallel
+    {
+        ScopedTrace trace("omp", label.c_str());
+#pragma omp for
+        for (size_type i = 0; i < data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(data, ThreadId{i}, this->label()));
+        }
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the fast shower action on device.
+ */
+template<ActionOrder O>
+void FastShowerAction<O>::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+
+#if CELER_USE_DEVICE
+    fast_shower_device<O>(
+        data, storage_->params.device_ref(), this->get_state(data));
+#else
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template class FastShowerAction<ActionOrder::pre>;
+template class FastShowerAction<ActionOrder::along>;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,85 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/detail/FastShowerAction.cu
+//---------------------------------------------------------------------------//
+#include <type_traits>
+
+#include "corecel/Macros.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+#include "FastShowerLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+
+template<ActionOrder O>
+__global__ void
+fast_shower_kernel(CoreDeviceRef const core,
+                   DeviceCRef<FastShowerParamsData> const shower_params,
+                   DeviceRef<FastShowerStateData> const shower_state)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < core.states.size()))
+        return;
+
+    using Launcher = std::conditional_t<O == ActionOrder::pre,
+                                        FastShowerSelectLauncher,
+                                        FastShowerStepLauncher>;
+    Launcher launch{core, shower_params, shower_state};
+    launch(tid);
+}
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the action on device.
+ */
+template<ActionOrder O>
+void fast_shower_device(CoreRef<MemSpace::device> const& core,
+                        DeviceCRef<FastShowerParamsData> const& shower_params,
+                        DeviceRef<FastShowerStateData> const& shower_state)
+{
+    CELER_EXPECT(core);
+    CELER_EXPECT(shower_state.size() == core.states.size());
+
+    static const KernelParamCalculator calc_launch_params_(
+        O == ActionOrder::pre ? "fast_shower_select" : "fast_shower",
+        fast_shower_kernel<O>);
+    auto grid = calc_launch_params_(core.states.size());
+
+    CELER_LAUNCH_KERNEL_IMPL(fast_shower_kernel<O>,
+                             grid.blocks_per_grid,
+                             grid.threads_per_block,
+                             0,
+                             0,
+                             core,
+                             shower_params,
+                             shower_state);
+    CELER_DEVICE_CHECK_ERROR();
+}
+
+//---------------------------------------------------------------------------//
+
+template void
+fast_shower_device<ActionOrder::pre>(CoreRef<MemSpace::device> const&,
+                                     DeviceCRef<FastShowerParamsData> const&,
+                                     DeviceRef<FastShowerStateData> const&);
+template void
+fast_shower_device<ActionOrder::along>(CoreRef<MemSpace::device> const&,
+                                       DeviceCRef<FastShowerParamsData> const&,
+                                       DeviceRef<FastShowerStateData> const&);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,156 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/detail/FastShowerAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "../data/FastShowerData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent and per-stream shower data shared by the fast shower actions.
+ */
+struct FastShowerStorage
+{
+    //// TYPES ////
+
+    template<MemSpace M>
+    using StateStore = CollectionStateStore<FastShowerStateData, M>;
+    template<MemSpace M>
+    using VecState = std::vector<StateStore<M>>;
+    template<MemSpace M>
+    using MemSpaceTag = std::integral_constant<MemSpace, M>;
+
+    //// DATA ////
+
+    // Parameter data
+    CollectionMirror<FastShowerParamsData> params;
+
+    // State data for each stream
+    struct
+    {
+        VecState<MemSpace::host> host;
+        VecState<MemSpace::device> device;
+    } states;
+
+    //// METHODS ////
+
+    //!@{
+    //! Tag-based dispatch for accessing states
+    VecState<MemSpace::host>& get_states(MemSpaceTag<MemSpace::host>)
+    {
+        return states.host;
+    }
+
+    VecState<MemSpace::device>& get_states(MemSpaceTag<MemSpace::device>)
+    {
+        return states.device;
+    }
+    //!@}
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select or transport parameterized shower tracks.
+ *
+ * The pre-step instance hands applicable tracks over to the along-step
+ * instance, which replaces the problem's along-step action for those tracks.
+ */
+template<ActionOrder O>
+class FastShowerAction final : public ExplicitActionInterface
+{
+    static_assert(O == ActionOrder::pre || O == ActionOrder::along,
+                  "fast shower actions only select or transport");
+
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPStorage = std::shared_ptr<FastShowerStorage>;
+    //!@}
+
+  public:
+    // Construct with action ID and shared storage
+    FastShowerAction(ActionId id, SPStorage storage);
+
+    // Launch kernel with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Launch kernel with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the action
+    std::string label() const final
+    {
+        return O == ActionOrder::pre ? "fast-shower-select" : "fast-shower";
+    }
+
+    // Description of the action for user interaction
+    std::string description() const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return O; }
+
+  private:
+    ActionId id_;
+    SPStorage storage_;
+
+    template<MemSpace M>
+    FastShowerStateData<Ownership::reference, M> const&
+    get_state(CoreRef<M> const& core_data) const;
+};
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get a reference to the shower state data for a stream, allocating if needed.
+ */
+template<ActionOrder O>
+template<MemSpace M>
+FastShowerStateData<Ownership::reference, M> const&
+FastShowerAction<O>::get_state(CoreRef<M> const& core) const
+{
+    auto& all_states
+        = storage_->get_states(FastShowerStorage::MemSpaceTag<M>{});
+    StreamId stream_id = core.states.stream_id;
+    CELER_VALIDATE(stream_id < all_states.size(),
+                   << "stream ID " << stream_id.unchecked_get()
+                   << " exceeds the number of streams (" << all_states.size()
+                   << ") in the fast shower parameterization");
+
+    auto& state_store = all_states[stream_id.get()];
+    if (CELER_UNLIKELY(!state_store))
+    {
+        // State storage hasn't been allocated yet: allocate based on current
+        // state
+        state_store = FastShowerStorage::StateStore<M>{
+            storage_->params.host_ref(), core.states.size()};
+    }
+    CELER_ENSURE(state_store);
+    return state_store.ref();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,337 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/detail/FastShowerLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/em/data/FastShowerData.hh"
+#include "celeritas/field/LinearPropagator.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+#include "celeritas/random/distribution/UniformRealDistribution.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fraction of the shower energy deposited before a scaled depth.
+ *
+ * This is the cumulative distribution of the longitudinal profile, i.e. the
+ * regularized lower incomplete gamma function \f$ P(\alpha, bt) \f$. It's
+ * evaluated with a power series below \f$ \alpha + 1 \f$ and a continued
+ * fraction above it (Numerical Recipes, 6.2).
+ */
+inline CELER_FUNCTION real_type calc_shower_containment(real_type alpha,
+                                                        real_type bt)
+{
+    CELER_EXPECT(alpha > 0);
+    CELER_EXPECT(bt >= 0);
+
+    constexpr int max_iters = 200;
+    constexpr real_type eps = 1e-12;
+    if (bt == 0)
+    {
+        return 0;
+    }
+    real_type const prefactor
+        = std::exp(alpha * std::log(bt) - bt - std::lgamma(alpha));
+
+    if (bt < alpha + 1)
+    {
+        real_type term = 1 / alpha;
+        real_type sum = term;
+        for (int n = 1; n < max_iters && std::fabs(term) > eps * sum; ++n)
+        {
+            term *= bt / (alpha + n);
+            sum += term;
+        }
+        return min<real_type>(sum * prefactor, 1);
+    }
+
+    // Modified Lentz evaluation of the complementary function
+    constexpr real_type tiny = 1e-300;
+    real_type b = bt + 1 - alpha;
+    real_type c = 1 / tiny;
+    real_type d = 1 / b;
+    real_type h = d;
+    for (int n = 1; n < max_iters; ++n)
+    {
+        real_type an = -n * (n - alpha);
+        b += 2;
+        d = an * d + b;
+        d = (std::fabs(d) < tiny ? tiny : d);
+        c = b + an / c;
+        c = (std::fabs(c) < tiny ? tiny : c);
+        d = 1 / d;
+        real_type delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1) < eps)
+        {
+            break;
+        }
+    }
+    return max<real_type>(1 - prefactor * h, 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start a parameterized shower for an applicable track.
+ *
+ * Electrons, positrons, and photons above the energy threshold that start a
+ * step in a parameterized volume are handed over to the fast shower action for
+ * the rest of their lives. The total energy of the shower includes the
+ * annihilation energy of positrons.
+ */
+struct FastShowerSelectLauncher
+{
+    //!@{
+    //! \name Type aliases
+    using CoreRefNative = CoreRef<MemSpace::native>;
+    using ParamsRefNative = NativeCRef<FastShowerParamsData>;
+    using StateRefNative = NativeRef<FastShowerStateData>;
+    //!@}
+
+    //// DATA ////
+
+    CoreRefNative const& core_data;
+    ParamsRefNative const& shower_params;
+    StateRefNative const& shower_state;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(ThreadId thread) const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Deposit the next spot of a parameterized shower.
+ *
+ * Each step moves the track along the shower axis by up to the maximum spot
+ * depth, stopping at volume boundaries so that the shower continues in the
+ * next volume with that volume's material. The energy deposited over the step
+ * is the integral of the longitudinal profile over the depth traversed, and
+ * the spot is displaced from the axis according to the radial profile,
+ * limited by the safety distance. Spots are recorded as steps of the track so
+ * that step collectors see them exactly like detailed steps (including the
+ * track's statistical weight). Once the remaining energy is below the tail
+ * fraction, it is deposited and the track is killed. A shower that leaves the
+ * world through a boundary carries away its remaining energy.
+ */
+struct FastShowerStepLauncher
+{
+    //!@{
+    //! \name Type aliases
+    using CoreRefNative = CoreRef<MemSpace::native>;
+    using ParamsRefNative = NativeCRef<FastShowerParamsData>;
+    using StateRefNative = NativeRef<FastShowerStateData>;
+    //!@}
+
+    //// DATA ////
+
+    CoreRefNative const& core_data;
+    ParamsRefNative const& shower_params;
+    StateRefNative const& shower_state;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(ThreadId thread) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Hand over an applicable track to the fast shower action.
+ */
+CELER_FUNCTION void FastShowerSelectLauncher::operator()(ThreadId thread) const
+{
+    CELER_ASSERT(thread < this->core_data.states.size());
+    CoreTrackView const track(
+        this->core_data.params, this->core_data.states, thread);
+    auto const& params = this->shower_params;
+
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive || sim.along_step_action())
+    {
+        return;
+    }
+
+    auto particle = track.make_particle_view();
+    if (!(particle.particle_id() < params.particles.size())
+        || particle.energy() < params.min_energy)
+    {
+        return;
+    }
+    ShowerParticle const shower = params.particles[particle.particle_id()];
+    if (shower == ShowerParticle::none)
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    CELER_ASSERT(!geo.is_outside());
+    VolumeId const volume = geo.volume_id();
+    if (!(volume < params.volumes.size()) || !params.volumes[volume])
+    {
+        return;
+    }
+    auto const mat = track.make_material_view().make_material_view();
+    if (!(mat.density() > 0))
+    {
+        return;
+    }
+    track.tally_action(params.select_action);
+
+    // Total energy deposited by the shower
+    real_type energy = value_as<units::MevEnergy>(particle.energy());
+    if (shower == ShowerParticle::positron)
+    {
+        energy += 2 * value_as<units::MevMass>(particle.mass());
+    }
+
+    // Shower maximum from the Rossi critical energy for solids and liquids
+    real_type const crit_energy = 610 / (mat.zeff() + real_type(1.24));
+    real_type t_max = std::log(energy / crit_energy)
+                      + (shower == ShowerParticle::photon ? real_type(0.5)
+                                                          : real_type(-0.5));
+
+    auto const& state = this->shower_state;
+    state.axis[thread] = geo.pos();
+    state.depth[thread] = 0;
+    state.energy[thread] = energy;
+    state.alpha[thread] = params.profile_b * max<real_type>(t_max, 0) + 1;
+    sim.along_step_action(params.action);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport a shower track by one spot.
+ */
+CELER_FUNCTION void FastShowerStepLauncher::operator()(ThreadId thread) const
+{
+    CELER_ASSERT(thread < this->core_data.states.size());
+    CoreTrackView const track(
+        this->core_data.params, this->core_data.states, thread);
+    auto const& params = this->shower_params;
+
+    auto sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive
+        || sim.along_step_action() != params.action)
+    {
+        return;
+    }
+    CELER_ASSERT(sim.status() == TrackStatus::alive);
+    track.tally_action(params.action);
+
+    auto const& state = this->shower_state;
+    auto geo = track.make_geo_view();
+    if (geo.pos() != state.axis[thread])
+    {
+        // Return from the previous spot to the shower axis
+        geo.move_internal(state.axis[thread]);
+    }
+
+    // Move along the axis, stopping at the boundary
+    auto const mat = track.make_material_view().make_material_view();
+    LinearPropagator propagate(&geo);
+    Propagation p;
+    real_type depth = state.depth[thread];
+    if (mat.density() > 0)
+    {
+        p = propagate(params.step_depth * mat.radiation_length());
+        depth += p.distance / mat.radiation_length();
+    }
+    else
+    {
+        // No deposition in vacuum
+        p = propagate();
+    }
+    CELER_ASSERT(p.distance > 0);
+    state.axis[thread] = geo.pos();
+
+    // Integrate the longitudinal profile over the depth traversed
+    real_type const alpha = state.alpha[thread];
+    real_type const energy = state.energy[thread];
+    real_type const prev_remaining
+        = energy
+          * (1
+             - calc_shower_containment(alpha,
+                                       params.profile_b * state.depth[thread]));
+    real_type remaining
+        = energy
+          * (1 - calc_shower_containment(alpha, params.profile_b * depth));
+    if (remaining <= params.tail_fraction * energy)
+    {
+        remaining = 0;
+    }
+    state.depth[thread] = depth;
+
+    auto particle = track.make_particle_view();
+    if (real_type edep = prev_remaining - remaining; edep > 0)
+    {
+        using Energy = units::MevEnergy;
+        track.make_physics_step_view().deposit_energy(Energy{edep});
+
+        // Kinetic energy decreases in proportion with the shower energy
+        particle.subtract_energy(Energy{value_as<Energy>(particle.energy())
+                                        * (1 - remaining / prev_remaining)});
+
+        if (remaining > 0 && !p.boundary)
+        {
+            // Displace the spot from the axis, limited by the safety
+            constexpr real_type safety_tol = 0.01;
+            real_type const moliere_radius = mat.radiation_length()
+                                             * real_type(21.2052)
+                                             * (mat.zeff() + real_type(1.24))
+                                             / 610;
+            auto rng = track.make_rng_engine();
+            real_type xi = generate_canonical(rng);
+            real_type radius = min(moliere_radius * std::sqrt(xi / (1 - xi)),
+                                   (1 - safety_tol) * geo.find_safety());
+            if (radius > 0)
+            {
+                UniformRealDistribution<real_type> sample_phi(
+                    0, 2 * constants::pi);
+                Real3 pos = geo.pos();
+                axpy(radius,
+                     rotate(from_spherical(real_type(0), sample_phi(rng)),
+                            geo.dir()),
+                     &pos);
+                geo.move_internal(pos);
+            }
+        }
+    }
+
+    // Shower particles travel at approximately the speed of light
+    sim.add_time(p.distance / constants::c_light);
+    ActionId action = params.action;
+    if (remaining == 0)
+    {
+        sim.status(TrackStatus::killed);
+    }
+    else if (p.boundary)
+    {
+        action = track.boundary_action();
+    }
+    sim.reset_step_limit({p.distance, action});
+    sim.increment_num_steps();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
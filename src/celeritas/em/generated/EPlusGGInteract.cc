@@ -14,6 +14,7 @@
 #include "corecel/Types.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/em/launcher/EPlusGGLauncher.hh" // IWYU pragma: associated
 #include "celeritas/phys/InteractionLauncher.hh"
@@ -36,13 +37,17 @@ void eplusgg_interact(
         core_data,
         model_data,
         celeritas::eplusgg_interact_track);
-    #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < core_data.states.size(); ++i)
+    #pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{i}, "eplusgg"));
+        celeritas::ScopedTrace trace("omp", "eplusgg");
+        #pragma omp for
+        for (celeritas::size_type i = 0; i < core_data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{i}, "eplusgg"));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
@@ -60,6 +60,9 @@ class BetheHeitlerModel final : public Model
         return "Bethe-Heitler gamma conversion";
     }
 
+    //! Access model data on the host
+    BetheHeitlerData const& host_ref() const { return interface_; }
+
   private:
     BetheHeitlerData interface_;
     ImportedModelAdapter imported_;
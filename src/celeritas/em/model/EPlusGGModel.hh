@@ -47,6 +47,9 @@ class EPlusGGModel final : public Model
         return "Positron annihilation yielding two gammas";
     }
 
+    //! Access model data on the host
+    EPlusGGData const& host_ref() const { return interface_; }
+
     // Access data on device
     EPlusGGData device_ref() const { return interface_; }
 
@@ -47,6 +47,9 @@ class KleinNishinaModel final : public Model
         return "Klein-Nishina Compton scattering";
     }
 
+    //! Access model data on the host
+    KleinNishinaData const& host_ref() const { return interface_; }
+
   private:
     KleinNishinaData interface_;
 };
@@ -48,6 +48,9 @@ class MollerBhabhaModel final : public Model
         return "Moller+Bhabha scattering";
     }
 
+    //! Access model data on the host
+    MollerBhabhaData const& host_ref() const { return interface_; }
+
   private:
     MollerBhabhaData interface_;
 };
@@ -56,6 +56,9 @@ class MuBremsstrahlungModel final : public Model
     //! Name of the model, for user interaction
     std::string description() const final { return "Muon bremsstrahlung"; }
 
+    //! Access model data on the host
+    MuBremsstrahlungData const& host_ref() const { return interface_; }
+
   private:
     MuBremsstrahlungData interface_;
     ImportedModelAdapter imported_;
@@ -24,19 +24,31 @@ namespace celeritas
 /*!
  * Integrate with and control the quality of the field integration stepper.
  *
+ * An optional pointer to a per-track "substep memory" can be provided. If
+ * present, the first trial substep in \c advance starts from the
+ * remembered value rather than the full requested step. After a chord is
+ * accepted, the remembered value is updated with a proposed length for the
+ * next substep; if the chord is rejected (requiring the more accurate
+ * integration) the memory is cleared. For a track in a strong field this
+ * avoids re-discovering the acceptable chord length (with rejected stepper
+ * evaluations) at every step. This is analogous to the "last step estimate"
+ * in G4ChordFinder. Because it may update the memory, \c advance is
+ * non-const.
+ *
  * \note This class is based on G4ChordFinder and G4MagIntegratorDriver.
  */
 template<class StepperT>
 class FieldDriver
 {
   public:
-    // Construct with options data and the stepper
-    inline CELER_FUNCTION
-    FieldDriver(FieldDriverOptions const& options, StepperT&& perform_step);
+    // Construct with options data, the stepper, and optional substep memory
+    inline CELER_FUNCTION FieldDriver(FieldDriverOptions const& options,
+                                      StepperT&& perform_step,
+                                      real_type* substep = nullptr);
 
     // For a given trial step, advance by a sub_step within a tolerance error
     inline CELER_FUNCTION DriverResult advance(real_type step,
-                                               OdeState const& state) const;
+                                               OdeState const& state);
 
     // An adaptive step size control from G4MagIntegratorDriver
     // Move this to private after all tests with non-uniform field are done
@@ -65,6 +77,9 @@ class FieldDriver
     // Stepper for this field driver
     StepperT apply_step_;
 
+    // Optional trial substep length remembered between calls
+    real_type* substep_;
+
     //// TYPES ////
 
     //! A helper output for private member functions
@@ -72,6 +87,7 @@ class FieldDriver
     {
         DriverResult end;  //!< Step taken and post-step state
         real_type error;  //!< Stepper error
+        real_type proposed_step;  //!< Next chord length (0 if not found)
     };
 
     struct Integration
@@ -108,12 +124,18 @@ class FieldDriver
 //---------------------------------------------------------------------------//
 /*!
  * Construct with options and the step advancement functor.
+ *
+ * The optional \c substep argument points to (persistent) storage for the
+ * trial substep length: a nonpositive value means there is no estimate yet.
  */
 template<class StepperT>
 CELER_FUNCTION
 FieldDriver<StepperT>::FieldDriver(FieldDriverOptions const& options,
-                                   StepperT&& stepper)
-    : options_(options), apply_step_(::celeritas::forward<StepperT>(stepper))
+                                   StepperT&& stepper,
+                                   real_type* substep)
+    : options_(options)
+    , apply_step_(::celeritas::forward<StepperT>(stepper))
+    , substep_(substep)
 {
     CELER_EXPECT(options_);
 }
@@ -133,10 +155,16 @@ FieldDriver<StepperT>::FieldDriver(FieldDriverOptions const& options,
  * a reference distance (dist_chord) will be accepted if its stepping error is
  * within a reference accuracy. Otherwise, the more accurate step integration
  * (advance_accurate) will be performed.
+ *
+ * If the driver has substep memory, the chord search starts from the
+ * remembered trial length (if it's shorter than the requested step). The
+ * memory is updated with the length proposed for the next substep only if the
+ * chord is accepted; otherwise it's reset so that the next call starts from
+ * the full requested step.
  */
 template<class StepperT>
 CELER_FUNCTION DriverResult
-FieldDriver<StepperT>::advance(real_type step, OdeState const& state) const
+FieldDriver<StepperT>::advance(real_type step, OdeState const& state)
 {
     if (step <= options_.minimum_step)
     {
@@ -147,8 +175,15 @@ FieldDriver<StepperT>::advance(real_type step, OdeState const& state) const
         return result;
     }
 
+    // Start from the remembered substep length if one is available
+    real_type trial_step = step;
+    if (substep_ && *substep_ > options_.minimum_step)
+    {
+        trial_step = celeritas::min(*substep_, step);
+    }
+
     // Output with a step control error
-    ChordSearch output = this->find_next_chord(step, state);
+    ChordSearch output = this->find_next_chord(trial_step, state);
 
     // Evaluate the relative error
     real_type rel_error = output.error
@@ -158,8 +193,17 @@ FieldDriver<StepperT>::advance(real_type step, OdeState const& state) const
     {
         // Discard the original end state and advance more accurately with the
         // newly proposed step
-        real_type next_step = this->new_step_size(step, rel_error);
+        real_type next_step = this->new_step_size(trial_step, rel_error);
         output.end = this->accurate_advance(output.end.step, state, next_step);
+
+        // Don't reuse the rejected chord length
+        output.proposed_step = 0;
+    }
+
+    if (substep_)
+    {
+        // Save the proposed chord length (if any) for the next substep
+        *substep_ = output.proposed_step;
     }
 
     CELER_ENSURE(
@@ -185,6 +229,7 @@ FieldDriver<StepperT>::find_next_chord(real_type step,
     bool succeeded = false;
     auto remaining_steps = options_.max_nsteps;
     FieldStepperResult result;
+    real_type dchord;
 
     do
     {
@@ -193,7 +238,7 @@ FieldDriver<StepperT>::find_next_chord(real_type step,
 
         // Check whether the distance to the chord is smaller than the
         // reference
-        real_type dchord = detail::distance_chord(
+        dchord = detail::distance_chord(
             state, result.mid_state, result.end_state);
 
         if (dchord > options_.delta_chord + options_.dchord_tol)
@@ -213,6 +258,20 @@ FieldDriver<StepperT>::find_next_chord(real_type step,
     output.error = detail::truncation_error(
         step, options_.epsilon_rel_max, state, result.err_state);
 
+    // Estimate the next chord length from the sagitta scaling with the square
+    // of the step, with a bounded growth
+    output.proposed_step = 0;
+    if (succeeded)
+    {
+        real_type scale = options_.max_stepping_increase;
+        if (dchord > 0)
+        {
+            scale = celeritas::min(std::sqrt(options_.delta_chord / dchord),
+                                   scale);
+        }
+        output.proposed_step = scale * step;
+    }
+
     return output;
 }
 
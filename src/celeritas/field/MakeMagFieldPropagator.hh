@@ -42,6 +42,10 @@ make_mag_field_stepper(FieldT&& field, units::ElementaryCharge charge)
 /*!
  * Create a field propagator from an existing stepper.
  *
+ * The optional \c substep argument is persistent storage (usually from
+ * \c SimTrackView::field_substep ) for the field driver to remember its trial
+ * substep length between steps.
+ *
  * Example:
  * \code
  * FieldDriverOptions driver_options,
@@ -58,12 +62,13 @@ CELER_FUNCTION decltype(auto)
 make_field_propagator(StepperT&& stepper,
                       FieldDriverOptions const& options,
                       ParticleTrackView const& particle,
-                      GeoTrackView* geometry)
+                      GeoTrackView* geometry,
+                      real_type* substep = nullptr)
 {
     CELER_ASSERT(geometry);
     using Driver_t = FieldDriver<StepperT>;
     return FieldPropagator<Driver_t>{
-        Driver_t{options, ::celeritas::forward<StepperT>(stepper)},
+        Driver_t{options, ::celeritas::forward<StepperT>(stepper), substep},
         particle,
         geometry};
 }
@@ -88,14 +93,16 @@ CELER_FUNCTION decltype(auto)
 make_mag_field_propagator(FieldT&& field,
                           FieldDriverOptions const& options,
                           ParticleTrackView const& particle,
-                          GeoTrackView* geometry)
+                          GeoTrackView* geometry,
+                          real_type* substep = nullptr)
 {
     return make_field_propagator(
         make_mag_field_stepper<StepperT>(::celeritas::forward<FieldT>(field),
                                          particle.charge()),
         options,
         particle,
-        geometry);
+        geometry,
+        substep);
 }
 
 //---------------------------------------------------------------------------//
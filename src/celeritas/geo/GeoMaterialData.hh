@@ -15,7 +15,10 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Shared data for mapping geometry to materials.
+ * Shared data for mapping geometry to materials and regions.
+ *
+ * The region mapping is optional: if it is empty, all volumes belong to the
+ * default region \c RegionId{0} .
  */
 template<Ownership W, MemSpace M>
 struct GeoMaterialParamsData
@@ -24,6 +27,7 @@ struct GeoMaterialParamsData
     using VolumeItems = celeritas::Collection<T, W, M, VolumeId>;
 
     VolumeItems<MaterialId> materials;
+    VolumeItems<RegionId> regions;
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
@@ -37,6 +41,7 @@ struct GeoMaterialParamsData
     {
         CELER_EXPECT(other);
         materials = other.materials;
+        regions = other.regions;
         return *this;
     }
 };
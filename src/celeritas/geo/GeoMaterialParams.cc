@@ -78,6 +78,7 @@ GeoMaterialParams::from_import(ImportData const& data,
  */
 GeoMaterialParams::GeoMaterialParams(Input input)
 {
+    bool const has_regions = !input.volume_to_region.empty();
     CELER_EXPECT(input.geometry);
     CELER_EXPECT(input.materials);
     CELER_EXPECT(
@@ -90,12 +91,14 @@ GeoMaterialParams::GeoMaterialParams(Input input)
                                  return !m
                                         || m < input.materials->num_materials();
                              }));
+    CELER_EXPECT(!has_regions
+                 || input.volume_to_region.size() == input.volume_to_mat.size());
 
     if (!input.volume_labels.empty())
     {
-        // Remap materials to volume IDs using given volume names:
-        // build a map of volume name -> matid
-        std::unordered_map<Label, MaterialId> lab_to_id;
+        // Remap materials (and regions) to volume IDs using given volume
+        // names: build a map of volume name -> input index
+        std::unordered_map<Label, size_type> lab_to_id;
         std::set<Label> duplicates;
         for (auto idx : range(input.volume_to_mat.size()))
         {
@@ -105,9 +108,8 @@ GeoMaterialParams::GeoMaterialParams(Input input)
                 continue;
             }
 
-            auto [prev, inserted]
-                = lab_to_id.insert({std::move(input.volume_labels[idx]),
-                                    input.volume_to_mat[idx]});
+            auto [prev, inserted] = lab_to_id.insert(
+                {std::move(input.volume_labels[idx]), idx});
             if (!inserted)
             {
                 duplicates.insert(prev->first);
@@ -119,10 +121,12 @@ GeoMaterialParams::GeoMaterialParams(Input input)
                        << join(duplicates.begin(), duplicates.end(), "\", \"")
                        << '"');
 
-        // Set material ids based on volume names
+        // Set material and region ids based on volume names
         std::vector<Label> missing_volumes;
         GeoParams const& geo = *input.geometry;
-        input.volume_to_mat.assign(geo.num_volumes(), MaterialId{});
+        std::vector<MaterialId> volume_to_mat(geo.num_volumes());
+        std::vector<RegionId> volume_to_region(
+            has_regions ? geo.num_volumes() : 0);
         for (auto volume_id : range(VolumeId{geo.num_volumes()}))
         {
             auto iter = lab_to_id.find(geo.id_to_label(volume_id));
@@ -146,9 +150,17 @@ GeoMaterialParams::GeoMaterialParams(Input input)
             }
             else
             {
-                input.volume_to_mat[volume_id.unchecked_get()] = iter->second;
+                volume_to_mat[volume_id.unchecked_get()]
+                    = input.volume_to_mat[iter->second];
+                if (has_regions)
+                {
+                    volume_to_region[volume_id.unchecked_get()]
+                        = input.volume_to_region[iter->second];
+                }
             }
         }
+        input.volume_to_mat = std::move(volume_to_mat);
+        input.volume_to_region = std::move(volume_to_region);
         if (!missing_volumes.empty())
         {
             CELER_LOG(warning)
@@ -162,6 +174,22 @@ GeoMaterialParams::GeoMaterialParams(Input input)
     materials.insert_back(input.volume_to_mat.begin(),
                           input.volume_to_mat.end());
 
+    if (has_regions)
+    {
+        // Assign unspecified volumes to the default region
+        for (RegionId& r : input.volume_to_region)
+        {
+            if (!r)
+            {
+                r = RegionId{0};
+            }
+            num_regions_ = std::max(num_regions_, r.unchecked_get() + 1);
+        }
+        make_builder(&host_data.regions)
+            .insert_back(input.volume_to_region.begin(),
+                         input.volume_to_region.end());
+    }
+
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<GeoMaterialParamsData>{std::move(host_data)};
     CELER_ENSURE(data_);
@@ -25,7 +25,7 @@ struct ImportData;
 
 //---------------------------------------------------------------------------//
 /*!
- * Map a track's geometry state to a material ID.
+ * Map a track's geometry state to a material ID and region ID.
  *
  * For the forseeable future this class should just be a vector of MaterialIds,
  * one per volume.
@@ -35,6 +35,12 @@ struct ImportData;
  * the list of `volume_names` strings is provided, it must be the same size as
  * `volume_to_mat` and indicate a mapping for the geometry's volume IDs.
  * Otherwise, the array is required to have exactly one entry per volume ID.
+ *
+ * The optional `volume_to_region` array groups volumes into "regions" (akin
+ * to Geant4's \c G4Region ) that can have their own production cuts and step
+ * limits. If provided, it must be the same size as `volume_to_mat` and use
+ * the same indexing. Volumes with a null region ID are assigned to the
+ * default region, \c RegionId{0} .
  */
 class GeoMaterialParams
 {
@@ -55,6 +61,7 @@ class GeoMaterialParams
         SPConstMaterial materials;
         std::vector<MaterialId> volume_to_mat;
         std::vector<Label> volume_labels;  // Optional
+        std::vector<RegionId> volume_to_region;  // Optional
     };
 
   public:
@@ -67,6 +74,9 @@ class GeoMaterialParams
     // Construct from geometry and material params
     explicit GeoMaterialParams(Input);
 
+    //! Number of regions (at least one: the default region)
+    RegionId::size_type num_regions() const { return num_regions_; }
+
     //! Access material properties on the host
     HostRef const& host_ref() const { return data_.host(); }
 
@@ -75,6 +85,7 @@ class GeoMaterialParams
 
   private:
     CollectionMirror<GeoMaterialParamsData> data_;
+    RegionId::size_type num_regions_{1};
 
     using HostValue = HostVal<GeoMaterialParamsData>;
 };
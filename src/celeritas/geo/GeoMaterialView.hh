@@ -13,7 +13,7 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Access geometry-to-material conversion.
+ * Access geometry-to-material and geometry-to-region conversion.
  */
 class GeoMaterialView
 {
@@ -30,6 +30,15 @@ class GeoMaterialView
     // Return material for the given volume
     inline CELER_FUNCTION MaterialId material_id(VolumeId volume) const;
 
+    //! Whether volumes are mapped to more than the default region
+    CELER_FUNCTION bool has_regions() const
+    {
+        return !params_.regions.empty();
+    }
+
+    // Return region for the given volume
+    inline CELER_FUNCTION RegionId region_id(VolumeId volume) const;
+
   private:
     GeoMaterialData const& params_;
 };
@@ -59,5 +68,21 @@ CELER_FUNCTION MaterialId GeoMaterialView::material_id(VolumeId volume) const
     return params_.materials[volume];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return region for the given volume.
+ *
+ * If no regions were specified, every volume is in the default region.
+ */
+CELER_FUNCTION RegionId GeoMaterialView::region_id(VolumeId volume) const
+{
+    if (!this->has_regions())
+    {
+        return RegionId{0};
+    }
+    CELER_EXPECT(volume < params_.regions.size());
+    return params_.regions[volume];
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -36,6 +36,7 @@ inline CELER_FUNCTION void boundary_track(celeritas::CoreTrackView const& track)
         return;
     }
     CELER_EXPECT(sim.status() == TrackStatus::alive);
+    track.tally_action(track.boundary_action());
 
     auto geo = track.make_geo_view();
     CELER_EXPECT(geo.is_on_boundary());
@@ -8,12 +8,14 @@
 //---------------------------------------------------------------------------//
 #include "BoundaryAction.hh"
 
+#include <string>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/global/TrackLauncher.hh"
 #include "../detail/BoundaryActionImpl.hh" // IWYU pragma: associated
@@ -28,13 +30,18 @@ void BoundaryAction::execute(CoreHostRef const& data) const
 
     MultiExceptionHandler capture_exception;
     auto launch = make_track_launcher(data, detail::boundary_track);
-    #pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
+    std::string const label = this->label();
+    #pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(data, ThreadId{i}, this->label()));
+        ScopedTrace trace("omp", label.c_str());
+        #pragma omp for
+        for (size_type i = 0; i < data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(data, ThreadId{i}, this->label()));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionEfficiency.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fraction of launched threads that did work in a single explicit action.
+ *
+ * Every action is launched over all track slots, but most threads exit early
+ * because their track is inactive or is not undergoing the action. The
+ * "useful" count is the number of tracks that passed the action's
+ * applicability checks, summed over all steps. Actions that don't tally their
+ * tracks (e.g. user step gathering) report zero useful tracks.
+ *
+ * The accumulated time is only available for host execution or when the
+ * device is synchronized after each action.
+ */
+struct ActionEfficiency
+{
+    using Count = unsigned long long int;
+
+    std::string label;
+    size_type num_launches{};  //!< Number of steps executed
+    Count launched{};  //!< Total threads launched
+    Count useful{};  //!< Total tracks that did work
+    double time{};  //!< Accumulated time [s], or zero if unavailable
+
+    //! Fraction of launched threads that did work
+    double efficiency() const
+    {
+        return launched > 0 ? static_cast<double>(useful) / launched : 0;
+    }
+};
+
+//! Efficiency of each action in an action sequence
+using VecActionEfficiency = std::vector<ActionEfficiency>;
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
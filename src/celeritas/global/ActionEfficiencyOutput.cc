@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionEfficiencyOutput.cc
+//---------------------------------------------------------------------------//
+#include "ActionEfficiencyOutput.hh"
+
+#include <utility>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/io/JsonPimpl.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from per-action efficiency tallies.
+ */
+ActionEfficiencyOutput::ActionEfficiencyOutput(VecActionEfficiency actions)
+    : actions_(std::move(actions))
+{
+    CELER_EXPECT(!actions_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void ActionEfficiencyOutput::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    auto obj = nlohmann::json::array();
+    for (ActionEfficiency const& action : actions_)
+    {
+        nlohmann::json entry{
+            {"label", action.label},
+            {"launches", action.num_launches},
+            {"launched", action.launched},
+            {"useful", action.useful},
+            {"efficiency", action.efficiency()},
+        };
+        if (action.time > 0)
+        {
+            entry["time"] = action.time;
+            if (action.useful > 0)
+            {
+                entry["time_per_useful"] = action.time / action.useful;
+            }
+        }
+        obj.push_back(std::move(entry));
+    }
+    j->obj = std::move(obj);
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
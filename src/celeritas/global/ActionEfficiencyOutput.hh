@@ -0,0 +1,43 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionEfficiencyOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/io/OutputInterface.hh"
+
+#include "ActionEfficiency.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Save the fraction of launched threads that did work in each action.
+ *
+ * Each entry lists the number of launched threads and useful tracks, their
+ * ratio, and (if timing is available) the time per useful track.
+ */
+class ActionEfficiencyOutput final : public OutputInterface
+{
+  public:
+    // Construct from per-action efficiency tallies
+    explicit ActionEfficiencyOutput(VecActionEfficiency actions);
+
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+
+    //! Name of the entry inside the category.
+    std::string label() const final { return "action_efficiency"; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    VecActionEfficiency actions_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/CoreMemoryOutput.cc
+//---------------------------------------------------------------------------//
+#include "CoreMemoryOutput.hh"
+
+#include <utility>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/io/JsonPimpl.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+#if CELERITAS_USE_JSON
+//---------------------------------------------------------------------------//
+nlohmann::json to_json(CoreMemoryUsage::MapComponentBytes const& components)
+{
+    auto obj = nlohmann::json::object();
+    for (auto const& comp : components)
+    {
+        std::size_t bytes{0};
+        for (auto const& coll : comp.second)
+        {
+            bytes += coll.second;
+        }
+        obj[comp.first] = {{"bytes", bytes}, {"collections", comp.second}};
+    }
+    return {{"bytes", total_bytes(components)}, {"components", obj}};
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tallied memory usage.
+ */
+CoreMemoryOutput::CoreMemoryOutput(CoreMemoryUsage usage)
+    : usage_(std::move(usage))
+{
+    CELER_EXPECT(!usage_.params.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void CoreMemoryOutput::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    auto params = to_json(usage_.params);
+    params["excludes"] = "data owned by models other than the hardwired "
+                         "models, and by user actions";
+    auto obj = nlohmann::json{{"params", std::move(params)}};
+    if (usage_)
+    {
+        auto state_bytes = total_bytes(usage_.states);
+        obj["states"] = to_json(usage_.states);
+        obj["num_track_slots"] = usage_.num_track_slots;
+        obj["bytes_per_track_slot"]
+            = static_cast<double>(state_bytes) / usage_.num_track_slots;
+        obj["initializers"] = {{"capacity", usage_.initializer_capacity},
+                               {"peak", usage_.peak_initializers}};
+        obj["secondaries"] = {{"capacity", usage_.secondary_capacity},
+                              {"peak", nullptr}};
+        if (usage_.peak_secondaries)
+        {
+            obj["secondaries"]["peak"] = *usage_.peak_secondaries;
+        }
+    }
+    j->obj = std::move(obj);
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,46 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/CoreMemoryOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/io/OutputInterface.hh"
+
+#include "CoreMemoryUsage.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Save the memory footprint of core params and states.
+ *
+ * The output lists the bytes used by each collection, grouped by component,
+ * along with the per-track-slot cost of the states and the capacity and peak
+ * use of the secondary stack and track initializer vector. The params total
+ * is labeled with the data it excludes, and the secondary peak is null if it
+ * wasn't measured.
+ */
+class CoreMemoryOutput final : public OutputInterface
+{
+  public:
+    // Construct from tallied memory usage
+    explicit CoreMemoryOutput(CoreMemoryUsage usage);
+
+    //! Category of data to write
+    Category category() const final { return Category::internal; }
+
+    //! Name of the entry inside the category.
+    std::string label() const final { return "memory"; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    CoreMemoryUsage usage_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,268 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/CoreMemoryUsage.cc
+//---------------------------------------------------------------------------//
+#include "CoreMemoryUsage.hh"
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/data/Collection.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the size of collections into a labeled map.
+ */
+class MemoryTally
+{
+  public:
+    using MapBytes = CoreMemoryUsage::MapBytes;
+
+    explicit MemoryTally(MapBytes* dst) : dst_(dst) { CELER_EXPECT(dst_); }
+
+    template<class T, Ownership W, MemSpace M, class I>
+    void operator()(char const* label, Collection<T, W, M, I> const& c)
+    {
+        (*dst_)[label] += sizeof(T) * static_cast<std::size_t>(c.size());
+    }
+
+  private:
+    MapBytes* dst_;
+};
+
+//---------------------------------------------------------------------------//
+template<Ownership W, MemSpace M>
+void tally_geo_params(OrangeParamsData<W, M> const& data, MemoryTally tally)
+{
+    tally("universe_type", data.universe_type);
+    tally("universe_index", data.universe_index);
+    tally("simple_unit", data.simple_unit);
+    tally("surface_ids", data.surface_ids);
+    tally("volume_ids", data.volume_ids);
+    tally("real_ids", data.real_ids);
+    tally("logic_ints", data.logic_ints);
+    tally("reals", data.reals);
+    tally("surface_types", data.surface_types);
+    tally("connectivities", data.connectivities);
+    tally("volume_records", data.volume_records);
+    tally("translations", data.translations);
+    tally("unit_indexer.surfaces", data.unit_indexer_data.surfaces);
+    tally("unit_indexer.volumes", data.unit_indexer_data.volumes);
+}
+
+//---------------------------------------------------------------------------//
+template<Ownership W, MemSpace M>
+void tally_geo_states(OrangeStateData<W, M> const& data, MemoryTally tally)
+{
+    tally("level", data.level);
+    tally("next_level", data.next_level);
+    tally("pos", data.pos);
+    tally("dir", data.dir);
+    tally("vol", data.vol);
+    tally("universe", data.universe);
+    tally("surf", data.surf);
+    tally("sense", data.sense);
+    tally("boundary", data.boundary);
+    tally("temp_sense", data.temp_sense);
+    tally("temp_face", data.temp_face);
+    tally("temp_distance", data.temp_distance);
+    tally("temp_isect", data.temp_isect);
+}
+
+#if CELERITAS_USE_VECGEOM
+//---------------------------------------------------------------------------//
+template<Ownership W, MemSpace M>
+void tally_geo_params(VecgeomParamsData<W, M> const&, MemoryTally)
+{
+    // VecGeom manages its own geometry storage
+}
+
+//---------------------------------------------------------------------------//
+template<Ownership W, MemSpace M>
+void tally_geo_states(VecgeomStateData<W, M> const& data, MemoryTally tally)
+{
+    // Navigation state pools are opaque
+    tally("pos", data.pos);
+    tally("dir", data.dir);
+    tally("next_step", data.next_step);
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the bytes used by the core params.
+ */
+void tally_memory(HostCRef<CoreParamsData> const& params,
+                  CoreMemoryUsage* usage)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(usage);
+
+    auto& components = usage->params;
+    tally_geo_params(params.geometry, MemoryTally{&components["geometry"]});
+    {
+        MemoryTally tally{&components["geo_mats"]};
+        tally("materials", params.geo_mats.materials);
+        tally("regions", params.geo_mats.regions);
+    }
+    {
+        MemoryTally tally{&components["materials"]};
+        tally("elements", params.materials.elements);
+        tally("elcomponents", params.materials.elcomponents);
+        tally("materials", params.materials.materials);
+    }
+    {
+        MemoryTally tally{&components["particles"]};
+        tally("particles", params.particles.particles);
+    }
+    {
+        MemoryTally tally{&components["cutoffs"]};
+        tally("cutoffs", params.cutoffs.cutoffs);
+        tally("id_to_index", params.cutoffs.id_to_index);
+    }
+    {
+        auto const& phys = params.physics;
+        MemoryTally tally{&components["physics"]};
+        tally("reals", phys.reals);
+        tally("pmodel_ids", phys.pmodel_ids);
+        tally("value_grids", phys.value_grids);
+        tally("value_grid_ids", phys.value_grid_ids);
+        tally("process_ids", phys.process_ids);
+        tally("value_tables", phys.value_tables);
+        tally("value_table_ids", phys.value_table_ids);
+        tally("integral_xs", phys.integral_xs);
+        tally("model_groups", phys.model_groups);
+        tally("process_groups", phys.process_groups);
+        tally("model_ids", phys.model_ids);
+        tally("model_xs", phys.model_xs);
+        tally("fixed_step_limiters", phys.fixed_step_limiters);
+        tally("tracking_cuts", phys.tracking_cuts);
+        tally("range_rejection", phys.range_rejection);
+
+        auto const& hardwired = phys.hardwired;
+        auto const& pe_xs = hardwired.livermore_pe_data.xs;
+        tally("hardwired.livermore_pe.reals", pe_xs.reals);
+        tally("hardwired.livermore_pe.shells", pe_xs.shells);
+        tally("hardwired.livermore_pe.elements", pe_xs.elements);
+        auto const& relax = hardwired.relaxation_data;
+        tally("hardwired.relaxation.transitions", relax.transitions);
+        tally("hardwired.relaxation.shells", relax.shells);
+        tally("hardwired.relaxation.elements", relax.elements);
+    }
+    {
+        // RNG params have no collections
+        components["rng"]["params"] += sizeof(params.rng);
+    }
+    {
+        MemoryTally tally{&components["init"]};
+        tally("importance", params.init.importance);
+        tally("roulette", params.init.roulette);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the bytes and capacities of the core states.
+ *
+ * Only the sizes of the collections are accessed, so this is safe to call
+ * with device states.
+ */
+template<MemSpace M>
+void tally_memory(CoreStateData<Ownership::reference, M> const& states,
+                  CoreMemoryUsage* usage)
+{
+    CELER_EXPECT(states);
+    CELER_EXPECT(usage);
+
+    auto& components = usage->states;
+    tally_geo_states(states.geometry, MemoryTally{&components["geometry"]});
+    {
+        MemoryTally tally{&components["materials"]};
+        tally("state", states.materials.state);
+        tally("element_scratch", states.materials.element_scratch);
+    }
+    {
+        MemoryTally tally{&components["particles"]};
+        tally("state", states.particles.state);
+    }
+    {
+        auto const& phys = states.physics;
+        MemoryTally tally{&components["physics"]};
+        tally("state", phys.state);
+        tally("msc_step", phys.msc_step);
+        tally("per_process_xs", phys.per_process_xs);
+        tally("secondaries.storage", phys.secondaries.storage);
+        tally("secondaries.size", phys.secondaries.size);
+    }
+    {
+        MemoryTally tally{&components["rng"]};
+#if CELERITAS_RNG == CELERITAS_RNG_XORWOW
+        tally("state", states.rng.state);
+#else
+        tally("rng", states.rng.rng);
+#endif
+    }
+    {
+        MemoryTally tally{&components["sim"]};
+        tally("state", states.sim.state);
+    }
+    {
+        auto const& init = states.init;
+        MemoryTally tally{&components["init"]};
+        tally("initializers", init.initializers.storage);
+        tally("vacancies", init.vacancies.storage);
+        tally("parents", init.parents);
+        tally("secondary_counts", init.secondary_counts);
+        tally("clone_counts", init.clone_counts);
+        tally("track_counters", init.track_counters);
+    }
+    {
+        // Empty unless per-action track counting is enabled
+        MemoryTally tally{&components["actions"]};
+        tally("action_tracks", states.action_tracks);
+    }
+
+    usage->num_track_slots = states.size();
+    usage->initializer_capacity = states.init.initializers.capacity();
+    usage->secondary_capacity = states.physics.secondaries.storage.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total number of bytes in a component map.
+ */
+std::size_t total_bytes(CoreMemoryUsage::MapComponentBytes const& components)
+{
+    std::size_t result{0};
+    for (auto const& comp : components)
+    {
+        for (auto const& coll : comp.second)
+        {
+            result += coll.second;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template void
+tally_memory(CoreStateData<Ownership::reference, MemSpace::host> const&,
+             CoreMemoryUsage*);
+template void
+tally_memory(CoreStateData<Ownership::reference, MemSpace::device> const&,
+             CoreMemoryUsage*);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
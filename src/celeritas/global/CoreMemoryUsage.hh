@@ -0,0 +1,73 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/CoreMemoryUsage.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+
+#include "corecel/Types.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Memory footprint of the core params and states.
+ *
+ * The byte counts are grouped by component (e.g. "physics", "geometry") and
+ * then by collection name, using the member names of the corresponding data
+ * structures. Capacities and high-water marks of the dynamically sized
+ * secondary stack and track initializer vector are tallied by the stepper.
+ *
+ * The params tally is partial: it includes everything in \c CoreParamsData
+ * (including the hardwired physics models) but not data owned by the other
+ * models (e.g. Seltzer-Berger tables and Urban MSC parameters) or by
+ * user-defined actions.
+ */
+struct CoreMemoryUsage
+{
+    //!@{
+    //! \name Type aliases
+    using MapBytes = std::map<std::string, std::size_t>;
+    using MapComponentBytes = std::map<std::string, MapBytes>;
+    //!@}
+
+    MapComponentBytes params;  //!< Bytes per params collection
+    MapComponentBytes states;  //!< Bytes per state collection
+
+    size_type num_track_slots{};
+    size_type initializer_capacity{};
+    size_type secondary_capacity{};
+    size_type peak_initializers{};  //!< Max queued initializers in a step
+    //! Max secondaries allocated in a step, if measured
+    std::optional<size_type> peak_secondaries;
+
+    //! True if states have been tallied
+    explicit operator bool() const { return num_track_slots > 0; }
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Add the bytes used by the core params
+void tally_memory(HostCRef<CoreParamsData> const& params,
+                  CoreMemoryUsage* usage);
+
+// Add the bytes and capacities of the core states
+template<MemSpace M>
+void tally_memory(CoreStateData<Ownership::reference, M> const& states,
+                  CoreMemoryUsage* usage);
+
+// Total number of bytes in a component map
+std::size_t total_bytes(CoreMemoryUsage::MapComponentBytes const& components);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -98,6 +98,14 @@ struct CoreStateData
     SimStateData<W, M> sim;
     TrackInitStateData<W, M> init;
 
+    //! Number of tracks that did work in each action (optional)
+    Collection<unsigned long long int, W, M, ActionId> action_tracks;
+    //! Number of per-thread partial sums in action_tracks
+    size_type num_action_tallies{0};
+
+    //! Index of this set of states among all concurrent states
+    StreamId stream_id;
+
     //! Number of state elements
     CELER_FUNCTION size_type size() const { return particles.size(); }
 
@@ -120,6 +128,9 @@ struct CoreStateData
         rng = other.rng;
         sim = other.sim;
         init = other.init;
+        action_tracks = other.action_tracks;
+        num_action_tallies = other.num_action_tallies;
+        stream_id = other.stream_id;
         return *this;
     }
 };
@@ -157,11 +168,14 @@ using CoreDeviceRef = CoreRef<MemSpace::device>;
 template<MemSpace M>
 inline void resize(CoreStateData<Ownership::value, M>* state,
                    HostCRef<CoreParamsData> const& params,
+                   StreamId stream_id,
                    size_type size)
 {
     CELER_EXPECT(state);
     CELER_EXPECT(params);
+    CELER_EXPECT(stream_id);
     CELER_EXPECT(size > 0);
+    state->stream_id = stream_id;
     resize(&state->geometry, params.geometry, size);
     resize(&state->materials, params.materials, size);
     resize(&state->particles, params.particles, size);
@@ -171,5 +185,17 @@ inline void resize(CoreStateData<Ownership::value, M>* state,
     resize(&state->init, params.init, size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Resize states for a single stream in host code.
+ */
+template<MemSpace M>
+inline void resize(CoreStateData<Ownership::value, M>* state,
+                   HostCRef<CoreParamsData> const& params,
+                   size_type size)
+{
+    resize(state, params, StreamId{0}, size);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
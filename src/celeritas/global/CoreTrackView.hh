@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/math/Atomics.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/geo/GeoMaterialView.hh"
 #include "celeritas/geo/GeoTrackView.hh"
@@ -20,6 +21,10 @@
 
 #include "CoreTrackData.hh"
 
+#if defined(_OPENMP) && !CELER_DEVICE_COMPILE
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
@@ -59,6 +64,9 @@ class CoreTrackView
     // Return a cutoff view
     inline CELER_FUNCTION CutoffView make_cutoff_view() const;
 
+    // Get the region of the track's current volume
+    inline CELER_FUNCTION RegionId region_id() const;
+
     // Return a physics view
     inline CELER_FUNCTION PhysicsTrackView make_physics_view() const;
 
@@ -77,6 +85,9 @@ class CoreTrackView
     // Action ID for some other propagation limit (e.g. field stepping)
     inline CELER_FUNCTION ActionId propagation_limit_action() const;
 
+    // Count this track as having done work in the given action
+    inline CELER_FUNCTION void tally_action(ActionId action) const;
+
   private:
     StateRef const& states_;
     ParamsRef const& params_;
@@ -157,6 +168,22 @@ CELER_FUNCTION auto CoreTrackView::make_cutoff_view() const -> CutoffView
     return CutoffView{params_.cutoffs, mat_id};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the region of the track's current volume.
+ *
+ * The geometry is only queried if the problem has user-defined regions.
+ */
+CELER_FUNCTION RegionId CoreTrackView::region_id() const
+{
+    auto geo_mat = this->make_geo_material_view();
+    if (!geo_mat.has_regions())
+    {
+        return RegionId{0};
+    }
+    return geo_mat.region_id(this->make_geo_view().volume_id());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a physics view.
@@ -213,5 +240,51 @@ CELER_FUNCTION ActionId CoreTrackView::propagation_limit_action() const
     return params_.scalars.propagation_limit_action;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Count this track as having done work in the given action.
+ *
+ * This should be called once per track by each action after it has
+ * determined that the track is applicable. It does nothing unless the
+ * stepper was constructed with \c count_tracks enabled.
+ *
+ * To avoid contention on a single counter, on device the threads of a warp
+ * that tally the same action are combined into a single atomic add, and on
+ * host each OpenMP thread increments its own partial sum. The partial sums
+ * are added when the efficiency is reported.
+ */
+CELER_FUNCTION void CoreTrackView::tally_action(ActionId action) const
+{
+    if (states_.action_tracks.empty())
+    {
+        return;
+    }
+
+    // Partial sums are padded to separate cache lines
+    size_type const stride = states_.action_tracks.size()
+                             / states_.num_action_tallies;
+    CELER_EXPECT(action < stride);
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 700)
+    // Let the lowest lane of each group of matching threads add for the group
+    unsigned int const peers
+        = __match_any_sync(__activemask(), action.unchecked_get());
+    if (static_cast<int>(threadIdx.x % warpSize) == __ffs(peers) - 1)
+    {
+        atomic_add(&states_.action_tracks[action],
+                   static_cast<unsigned long long int>(__popc(peers)));
+    }
+#elif CELER_DEVICE_COMPILE
+    atomic_add(&states_.action_tracks[action], 1ull);
+#else
+    size_type tally = 0;
+#    ifdef _OPENMP
+    tally = omp_get_thread_num() % states_.num_action_tallies;
+#    endif
+    atomic_add(
+        &states_.action_tracks[ActionId{tally * stride + action.get()}],
+        1ull);
+#endif
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,22 +7,62 @@
 //---------------------------------------------------------------------------//
 #include "Stepper.hh"
 
+#include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/Copier.hh"
 #include "corecel/data/Ref.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "orange/OrangeData.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/random/XorwowRngData.hh"
 #include "celeritas/track/TrackInitData.hh"
 #include "celeritas/track/TrackInitUtils.hh"
 
+#include "ActionRegistry.hh"
 #include "CoreParams.hh"
 #include "detail/ActionSequence.hh"
 
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of secondaries allocated during the current step.
+ */
+template<MemSpace M>
+size_type
+get_num_secondaries(PhysicsStateData<Ownership::reference, M> const& phys)
+{
+    size_type result{0};
+    Copier<size_type, M> copy{phys.secondaries.size[AllItems<size_type, M>{}]};
+    copy(MemSpace::host, {&result, 1});
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of track counters for each thread, padded to a 64-byte cache line.
+ */
+size_type action_tally_stride(ActionRegistry const& reg)
+{
+    constexpr size_type per_line = 64 / sizeof(ActionEfficiency::Count);
+    return ceil_div(reg.num_actions(), per_line) * per_line;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with problem parameters and setup options.
@@ -33,13 +73,41 @@ Stepper<M>::Stepper(Input input) : params_(std::move(input.params))
     CELER_EXPECT(params_);
     CELER_VALIDATE(input.num_track_slots > 0,
                    << "number of track slots has not been set");
-    states_ = CollectionStateStore<CoreStateData, M>(params_->host_ref(),
-                                                     input.num_track_slots);
+    CELER_EXPECT(input.stream_id);
+    {
+        CoreStateData<Ownership::value, M> states;
+        resize(&states,
+               params_->host_ref(),
+               input.stream_id,
+               input.num_track_slots);
+        if (input.count_tracks)
+        {
+            // Allocate and zero the per-action track counters, with a
+            // separately padded set of partial sums for each host thread
+            size_type num_tallies = 1;
+#ifdef _OPENMP
+            if (M == MemSpace::host)
+            {
+                num_tallies = omp_get_max_threads();
+            }
+#endif
+            states.num_action_tallies = num_tallies;
+            std::vector<ActionEfficiency::Count> zeros(
+                num_tallies * action_tally_stride(*params_->action_reg()), 0);
+            resize(&states.action_tracks, zeros.size());
+            Copier<ActionEfficiency::Count, MemSpace::host> copy{
+                make_span(zeros)};
+            copy(M,
+                 states.action_tracks[AllItems<ActionEfficiency::Count, M>{}]);
+        }
+        states_ = CollectionStateStore<CoreStateData, M>(std::move(states));
+    }
 
     // Create action sequence
     {
         ActionSequence::Options opts;
         opts.sync = input.sync;
+        opts.perf_counters = PerfCounters::names_from_environment();
         actions_
             = std::make_shared<ActionSequence>(*params_->action_reg(), opts);
     }
@@ -47,6 +115,10 @@ Stepper<M>::Stepper(Input input) : params_(std::move(input.params))
     core_ref_.params = get_ref<M>(*params_);
     core_ref_.states = states_.ref();
 
+    // Reading the secondary allocation size from the device requires a
+    // synchronization, so only do it if the device is already synchronized
+    count_secondaries_ = (M == MemSpace::host || input.sync);
+
     CELER_ENSURE(actions_ && *actions_);
 }
 
@@ -67,13 +139,22 @@ auto Stepper<M>::operator()() -> result_type
 {
     CELER_EXPECT(*this);
 
+    ScopedTrace trace("stepper", "step");
+    trace.arg("stream", core_ref_.states.stream_id.unchecked_get());
+
     result_type result;
 
     // Create new tracks from queued primaries or secondaries
     initialize_tracks(core_ref_);
     result.active = states_.size() - core_ref_.states.init.vacancies.size();
+    trace.arg("active", result.active);
 
     actions_->execute(core_ref_);
+    if (count_secondaries_)
+    {
+        peak_secondaries_ = std::max(
+            peak_secondaries_, get_num_secondaries(core_ref_.states.physics));
+    }
 
     // Create track initializers from surviving secondaries
     extend_from_secondaries(core_ref_);
@@ -81,6 +162,9 @@ auto Stepper<M>::operator()() -> result_type
     // Get the number of track initializers and active tracks
     result.alive = states_.size() - core_ref_.states.init.vacancies.size();
     result.queued = core_ref_.states.init.initializers.size();
+    peak_initializers_ = std::max(peak_initializers_, result.queued);
+    trace.arg("alive", result.alive);
+    trace.arg("queued", result.queued);
 
     return result;
 }
@@ -104,11 +188,91 @@ auto Stepper<M>::operator()(SpanConstPrimary primaries) -> result_type
                    << ") for primaries (" << primaries.size() << ")");
 
     // Create track initializers
-    extend_from_primaries(core_ref_, primaries);
+    {
+        ScopedTrace trace("track_init", "extend_from_primaries");
+        trace.arg("num_primaries", primaries.size());
+        extend_from_primaries(core_ref_, primaries);
+    }
+    peak_initializers_ = std::max(peak_initializers_,
+                                  core_ref_.states.init.initializers.size());
 
     return (*this)();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get memory footprint and peak dynamic allocations so far.
+ *
+ * The secondary peak is the largest number of secondaries allocated in a
+ * single step, and the initializer peak is the largest number of queued
+ * track initializers at any point. The secondary peak is only measured on
+ * host or when the device is synchronized after each action.
+ */
+template<MemSpace M>
+CoreMemoryUsage Stepper<M>::memory_usage() const
+{
+    CELER_EXPECT(*this);
+
+    CoreMemoryUsage result;
+    tally_memory(params_->host_ref(), &result);
+    tally_memory(core_ref_.states, &result);
+    result.peak_initializers = peak_initializers_;
+    if (count_secondaries_)
+    {
+        result.peak_secondaries = peak_secondaries_;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the fraction of launched threads that did work in each action.
+ *
+ * Every action is launched once per step over all track slots. Timing is
+ * only reported for host execution or if the device is synchronized after
+ * each action.
+ */
+template<MemSpace M>
+VecActionEfficiency Stepper<M>::action_efficiency() const
+{
+    CELER_EXPECT(*this);
+    auto const& tracks = core_ref_.states.action_tracks;
+    CELER_VALIDATE(!tracks.empty(),
+                   << "per-action track counting was not enabled in the "
+                      "stepper input");
+
+    std::vector<ActionEfficiency::Count> partial(tracks.size());
+    copy_to_host(tracks, make_span(partial));
+
+    // Add the partial sums from each thread
+    size_type const stride = action_tally_stride(*params_->action_reg());
+    CELER_ASSERT(partial.size()
+                 == stride * core_ref_.states.num_action_tallies);
+    std::vector<ActionEfficiency::Count> useful(stride, 0);
+    for (auto i : range(partial.size()))
+    {
+        useful[i % stride] += partial[i];
+    }
+
+    bool const has_time = (M == MemSpace::host || actions_->sync());
+    auto const& actions = actions_->actions();
+    VecActionEfficiency result(actions.size());
+    for (auto i : range(actions.size()))
+    {
+        ActionEfficiency& eff = result[i];
+        eff.label = actions[i]->label();
+        eff.num_launches = actions_->num_executions();
+        eff.launched = ActionEfficiency::Count{eff.num_launches}
+                       * states_.size();
+        eff.useful = useful[actions[i]->action_id().unchecked_get()];
+        if (has_time)
+        {
+            eff.time = actions_->accum_time()[i];
+        }
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
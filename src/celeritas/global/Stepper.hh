@@ -15,6 +15,8 @@
 #include "corecel/data/CollectionStateStore.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/geo/GeoParamsFwd.hh"
+#include "celeritas/global/ActionEfficiency.hh"
+#include "celeritas/global/CoreMemoryUsage.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/phys/Primary.hh"
 #include "celeritas/random/RngParamsFwd.hh"
@@ -38,15 +40,21 @@ class ActionSequence;
  * - \c params : Problem definition
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  * - \c sync : Whether to synchronize device between actions
+ * - \c count_tracks : Whether to count the tracks that do work in each action
  */
 struct StepperInput
 {
     std::shared_ptr<CoreParams const> params;
     size_type num_track_slots{};
     bool sync{false};
+    bool count_tracks{false};
+    StreamId stream_id{0};  //!< Index of this stepper's states
 
     //! True if defined
-    explicit operator bool() const { return params && num_track_slots > 0; }
+    explicit operator bool() const
+    {
+        return params && num_track_slots > 0 && stream_id;
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -144,6 +152,12 @@ class Stepper final : public StepperInterface
     //! Access core data for debugging
     CoreRef<M> const& core_data() const { return core_ref_; }
 
+    // Get memory footprint and peak dynamic allocations so far
+    CoreMemoryUsage memory_usage() const;
+
+    // Get the fraction of launched threads that did work in each action
+    VecActionEfficiency action_efficiency() const;
+
   private:
     // Params and call sequence
     std::shared_ptr<CoreParams const> params_;
@@ -154,6 +168,11 @@ class Stepper final : public StepperInterface
 
     // Combined param/state for action calls
     CoreRef<M> core_ref_;
+
+    // High-water marks of dynamic allocations
+    size_type peak_initializers_{0};
+    size_type peak_secondaries_{0};
+    bool count_secondaries_{false};
 };
 
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/OpaqueId.hh"
 #include "corecel/Types.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "orange/Types.hh"
 #include "celeritas/Types.hh"
 
@@ -39,7 +40,11 @@ inline CELER_FUNCTION void along_step(MH&& msc,
     // within-step MSC
     AlongStepLocalState local;
     local.step_limit = sim.step_limit();
-    CELER_ASSERT(local.step_limit);
+    // Particles without discrete interactions have no action until they
+    // reach a boundary
+    CELER_ASSERT(local.step_limit
+                 || local.step_limit.step
+                        == numeric_limits<real_type>::infinity());
     if (local.step_limit.step == 0)
     {
         // Track is stopped: no movement or energy loss will happen
@@ -54,6 +59,33 @@ inline CELER_FUNCTION void along_step(MH&& msc,
         return;
     }
 
+    {
+        auto phys = track.make_physics_view();
+        if (phys.eloss_ppid() && phys.range_rejection(track.region_id())
+            && phys.dedx_range() < track.make_geo_view().find_safety())
+        {
+            // Charged track can't leave the current volume: deposit its
+            // energy locally rather than transporting it
+            auto particle = track.make_particle_view();
+            track.make_physics_step_view().deposit_energy(particle.energy());
+            particle.subtract_energy(particle.energy());
+            if (!phys.has_at_rest())
+            {
+                sim.status(TrackStatus::killed);
+                local.step_limit.action = phys.scalars().range_action();
+            }
+            else
+            {
+                // Force an at-rest interaction (e.g. positron annihilation)
+                local.step_limit.action = phys.scalars().discrete_action();
+            }
+            local.step_limit.step = 0;
+            sim.force_step_limit(local.step_limit);
+            sim.increment_num_steps();
+            return;
+        }
+    }
+
     local.geo_step = local.step_limit.step;
     bool use_msc = msc.is_applicable(track, local.geo_step);
     if (use_msc)
@@ -128,7 +160,8 @@ inline CELER_FUNCTION void along_step(MH&& msc,
         }
         // Energy loss helper *must* apply the tracking cutoff
         CELER_ASSERT(particle.energy()
-                         >= track.make_physics_view().scalars().eloss_calc_limit
+                         >= track.make_physics_view().tracking_cut(
+                             track.region_id())
                      || !apply_cut || particle.is_stopped());
     }
 
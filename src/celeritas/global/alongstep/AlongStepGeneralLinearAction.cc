@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "AlongStepGeneralLinearAction.hh"
 
+#include <string>
 #include <utility>
 
 #include "corecel/Assert.hh"
@@ -14,6 +15,7 @@
 #include "corecel/data/Ref.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/em/FluctuationParams.hh"
 #include "celeritas/em/UrbanMscParams.hh"
@@ -76,18 +78,24 @@ void AlongStepGeneralLinearAction::execute(CoreHostRef const& data) const
 
     MultiExceptionHandler capture_exception;
     auto launch = make_along_step_launcher(data,
+                                           this->action_id(),
                                            host_data_.msc,
                                            NoData{},
                                            host_data_.fluct,
                                            detail::along_step_general_linear);
 
-#pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
+    std::string const label = this->label();
+#pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(data, ThreadId{i}, this->label()));
+        ScopedTrace trace("omp", label.c_str());
+#pragma omp for
+        for (size_type i = 0; i < data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(data, ThreadId{i}, this->label()));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
@@ -25,12 +25,14 @@ namespace celeritas
 template<class M, class P, class E, class F>
 CELER_FUNCTION detail::AlongStepLauncherImpl<M, P, E, F>
 make_along_step_launcher(CoreRef<MemSpace::native> const& core_data,
+                         ActionId action,
                          M&& msc_data,
                          P&& propagator_data,
                          E&& eloss_data,
                          F&& call_with_track)
 {
     return {core_data,
+            action,
             ::celeritas::forward<M>(msc_data),
             ::celeritas::forward<P>(propagator_data),
             ::celeritas::forward<E>(eloss_data),
@@ -7,10 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "AlongStepNeutralAction.hh"
 
+#include <string>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/KernelContextException.hh"
@@ -38,15 +40,24 @@ void AlongStepNeutralAction::execute(CoreHostRef const& data) const
     CELER_EXPECT(data);
 
     MultiExceptionHandler capture_exception;
-    auto launch = make_along_step_launcher(
-        data, NoData{}, NoData{}, NoData{}, detail::along_step_neutral);
-#pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
+    auto launch = make_along_step_launcher(data,
+                                           this->action_id(),
+                                           NoData{},
+                                           NoData{},
+                                           NoData{},
+                                           detail::along_step_neutral);
+    std::string const label = this->label();
+#pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(data, ThreadId{i}, this->label()));
+        ScopedTrace trace("omp", label.c_str());
+#pragma omp for
+        for (size_type i = 0; i < data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(data, ThreadId{i}, this->label()));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
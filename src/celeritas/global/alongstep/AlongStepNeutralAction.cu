@@ -21,14 +21,19 @@ namespace celeritas
 namespace
 {
 //---------------------------------------------------------------------------//
-__global__ void along_step_neutral_kernel(CoreDeviceRef const data)
+__global__ void
+along_step_neutral_kernel(CoreDeviceRef const data, ActionId const action)
 {
     auto tid = KernelParamCalculator::thread_id();
     if (!(tid < data.states.size()))
         return;
 
-    auto launch = make_along_step_launcher(
-        data, NoData{}, NoData{}, NoData{}, detail::along_step_neutral);
+    auto launch = make_along_step_launcher(data,
+                                           action,
+                                           NoData{},
+                                           NoData{},
+                                           NoData{},
+                                           detail::along_step_neutral);
     launch(tid);
 }
 //---------------------------------------------------------------------------//
@@ -44,7 +49,8 @@ void AlongStepNeutralAction::execute(CoreDeviceRef const& data) const
     CELER_LAUNCH_KERNEL(along_step_neutral,
                         celeritas::device().default_block_size(),
                         data.states.size(),
-                        data);
+                        data,
+                        this->action_id());
 }
 
 //---------------------------------------------------------------------------//
@@ -23,6 +23,7 @@ namespace
 //---------------------------------------------------------------------------//
 __global__ void
 along_step_uniform_msc_kernel(CoreRef<MemSpace::device> const track_data,
+                              ActionId const action,
                               DeviceCRef<UrbanMscData> const msc_data,
                               UniformFieldParams const field_params)
 {
@@ -31,6 +32,7 @@ along_step_uniform_msc_kernel(CoreRef<MemSpace::device> const track_data,
         return;
 
     auto launch = make_along_step_launcher(track_data,
+                                           action,
                                            msc_data,
                                            field_params,
                                            NoData{},
@@ -51,6 +53,7 @@ void AlongStepUniformMscAction::execute(CoreDeviceRef const& data) const
                         celeritas::device().default_block_size(),
                         data.states.size(),
                         data,
+                        this->action_id(),
                         device_data_.msc,
                         field_params_);
 }
@@ -41,6 +41,7 @@ struct AlongStepLauncherImpl
     //// DATA ////
 
     CoreRefNative const& core_data;
+    ActionId action;
     M msc_data;
     P propagator_data;
     E eloss_data;
@@ -73,8 +74,14 @@ AlongStepLauncherImpl<M, P, E, F>::operator()(ThreadId thread) const
             CELER_ASSERT(!sim.step_limit());
             return;
         }
+        if (sim.along_step_action())
+        {
+            // Track is transported by a different along-step action
+            return;
+        }
         CELER_ASSERT(sim.status() != TrackStatus::killed);
     }
+    track.tally_action(this->action);
 
     this->call_with_track(msc_data, propagator_data, eloss_data, track);
 }
@@ -94,7 +94,7 @@ struct NoELoss
  * kernel:
  * \code
  * auto launch = make_along_step_launcher(
- *     NoData{}, NoData{}, NoData{},
+ *     core_data, action_id, NoData{}, NoData{}, NoData{},
  *     along_step_neutral);
  * \endcode
  */
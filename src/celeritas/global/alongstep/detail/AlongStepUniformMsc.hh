@@ -27,6 +27,9 @@ namespace detail
 /*!
  * Implementation of the "along step" action with Urban MSC and a uniform
  * magnetic field.
+ *
+ * The field driver's trial substep length is stored in the track's sim state
+ * so that it's reused as the initial guess on the next step.
  */
 inline CELER_FUNCTION void
 along_step_uniform_msc(NativeCRef<UrbanMscData> const& msc,
@@ -36,9 +39,14 @@ along_step_uniform_msc(NativeCRef<UrbanMscData> const& msc,
 {
     return along_step(
         UrbanMsc{msc},
-        [&field](ParticleTrackView const& particle, GeoTrackView* geo) {
+        [&field, &track](ParticleTrackView const& particle,
+                         GeoTrackView* geo) {
             return make_mag_field_propagator<DormandPrinceStepper>(
-                UniformField(field.field), field.options, particle, geo);
+                UniformField(field.field),
+                field.options,
+                particle,
+                geo,
+                &track.make_sim_view().field_substep());
         },
         MeanELoss{},
         track);
@@ -101,8 +101,9 @@ CELER_FUNCTION auto FluctELoss::calc_eloss(CoreTrackView const& track,
 
     auto particle = track.make_particle_view();
     auto phys = track.make_physics_view();
+    auto const tracking_cut = phys.tracking_cut(track.region_id());
 
-    if (apply_cut && particle.energy() < phys.scalars().eloss_calc_limit)
+    if (apply_cut && particle.energy() < tracking_cut)
     {
         // Deposit all energy immediately when we start below the tracking cut
         return particle.energy();
@@ -158,7 +159,7 @@ CELER_FUNCTION auto FluctELoss::calc_eloss(CoreTrackView const& track,
     }
 
     if (apply_cut
-        && (particle.energy() - eloss <= phys.scalars().eloss_calc_limit))
+        && (particle.energy() - eloss <= tracking_cut))
     {
         // Deposit all energy when we end below the tracking cut
         return particle.energy();
@@ -65,8 +65,9 @@ CELER_FUNCTION auto MeanELoss::calc_eloss(CoreTrackView const& track,
 
     auto particle = track.make_particle_view();
     auto phys = track.make_physics_view();
+    auto const tracking_cut = phys.tracking_cut(track.region_id());
 
-    if (apply_cut && particle.energy() < phys.scalars().eloss_calc_limit)
+    if (apply_cut && particle.energy() < tracking_cut)
     {
         // Deposit all energy when we start below the tracking cut
         return particle.energy();
@@ -76,7 +77,7 @@ CELER_FUNCTION auto MeanELoss::calc_eloss(CoreTrackView const& track,
     Energy eloss = calc_mean_energy_loss(particle, phys, step);
 
     if (apply_cut
-        && (particle.energy() - eloss <= phys.scalars().eloss_calc_limit))
+        && (particle.energy() - eloss <= tracking_cut))
     {
         // Deposit all energy when we end below the tracking cut
         return particle.energy();
@@ -17,6 +17,7 @@
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/sys/Stopwatch.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/global/ActionInterface.hh"
 
 #include "../ActionRegistry.hh"
@@ -66,10 +67,34 @@ ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
                          < std::make_tuple(b->order(), b->action_id());
               });
 
-    // Initialize timing
+    // Initialize timing and trace labels
     accum_time_.resize(actions_.size());
+    for (auto const& action : actions_)
+    {
+        labels_.push_back(action->label());
+    }
+
+    if (!options_.perf_counters.empty())
+    {
+        // Open hardware counters on every host thread
+        perf_ = std::make_shared<PerfCounters>(options_.perf_counters);
+#pragma omp parallel
+        {
+            perf_->add_thread();
+        }
+        if (*perf_)
+        {
+            accum_counters_.assign(actions_.size(),
+                                   VecCount(perf_->names().size(), 0));
+        }
+        else
+        {
+            perf_.reset();
+        }
+    }
 
     CELER_ENSURE(actions_.size() == accum_time_.size());
+    CELER_ENSURE(actions_.size() == labels_.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -81,11 +106,17 @@ ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
 template<MemSpace M>
 void ActionSequence::execute(CoreRef<M> const& data)
 {
+    ++num_executions_;
     if (M == MemSpace::host || options_.sync)
     {
         // Execute all actions and record the time elapsed
         for (auto i : range(actions_.size()))
         {
+            ScopedTrace trace("action", labels_[i].c_str());
+            if (M == MemSpace::host && perf_)
+            {
+                perf_->start();
+            }
             Stopwatch get_time;
             actions_[i]->execute(data);
             if (M == MemSpace::device)
@@ -93,14 +124,19 @@ void ActionSequence::execute(CoreRef<M> const& data)
                 CELER_DEVICE_CALL_PREFIX(DeviceSynchronize());
             }
             accum_time_[i] += get_time();
+            if (M == MemSpace::host && perf_)
+            {
+                perf_->stop(&accum_counters_[i]);
+            }
         }
     }
     else
     {
         // Just loop over the actions
-        for (SPConstExplicit const& sp_action : actions_)
+        for (auto i : range(actions_.size()))
         {
-            sp_action->execute(data);
+            ScopedTrace trace("action", labels_[i].c_str());
+            actions_[i]->execute(data);
         }
     }
 }
@@ -8,9 +8,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "corecel/Types.hh"
+#include "corecel/sys/PerfCounters.hh"
 
 #include "../ActionInterface.hh"
 #include "../CoreTrackDataFwd.hh"
@@ -34,12 +36,16 @@ class ActionSequence
     using SPConstExplicit = std::shared_ptr<ExplicitActionInterface const>;
     using VecAction = std::vector<SPConstExplicit>;
     using VecDouble = std::vector<double>;
+    using VecString = std::vector<std::string>;
+    using VecCount = PerfCounters::VecCount;
+    using VecVecCount = std::vector<VecCount>;
     //!@}
 
     //! Construction/execution options
     struct Options
     {
         bool sync{false};  //!< Call DeviceSynchronize and add timer
+        VecString perf_counters;  //!< Hardware events to count on host
     };
 
   public:
@@ -69,10 +75,27 @@ class ActionSequence
     //! Get the corresponding accumulated time, if 'sync' or host called
     VecDouble const& accum_time() const { return accum_time_; }
 
+    //! Number of times the sequence has been executed
+    size_type num_executions() const { return num_executions_; }
+
+    //! Names of the hardware events counted, if available
+    VecString const& counter_names() const
+    {
+        static VecString const empty;
+        return perf_ ? perf_->names() : empty;
+    }
+
+    //! Accumulated hardware counts [action][event], if host called
+    VecVecCount const& accum_counters() const { return accum_counters_; }
+
   private:
     Options options_;
     VecAction actions_;
     VecDouble accum_time_;
+    std::vector<std::string> labels_;
+    size_type num_executions_{0};
+    std::shared_ptr<PerfCounters> perf_;
+    VecVecCount accum_counters_;
 };
 
 //---------------------------------------------------------------------------//
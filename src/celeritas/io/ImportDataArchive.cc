@@ -0,0 +1,444 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportDataArchive.cc
+//---------------------------------------------------------------------------//
+#include "ImportDataArchive.hh"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write imported data structures field by field.
+ *
+ * Vectors of trivially copyable values are written as aligned arrays; other
+ * containers are written as a size followed by each element.
+ */
+class ImportDataWriter
+{
+  public:
+    explicit ImportDataWriter(BinaryOutArchive* ar) : ar_(*ar) {}
+
+    template<class T>
+    void operator()(T const& value)
+    {
+        this->write(value);
+    }
+
+  private:
+    BinaryOutArchive& ar_;
+
+    template<class T>
+    void write(T const& value)
+    {
+        ar_(value);
+    }
+
+    void write(std::string const& value) { ar_(value); }
+
+    template<class T>
+    void write(std::vector<T> const& values)
+    {
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            ar_(make_span(values));
+        }
+        else
+        {
+            ar_(static_cast<std::size_t>(values.size()));
+            for (T const& v : values)
+            {
+                this->write(v);
+            }
+        }
+    }
+
+    template<class K, class V>
+    void write(std::map<K, V> const& values)
+    {
+        ar_(static_cast<std::size_t>(values.size()));
+        for (auto const& kv : values)
+        {
+            this->write(kv.first);
+            this->write(kv.second);
+        }
+    }
+
+    void write(ImportParticle const& v)
+    {
+        this->write(v.name);
+        this->write(v.pdg);
+        this->write(v.mass);
+        this->write(v.charge);
+        this->write(v.spin);
+        this->write(v.lifetime);
+        this->write(v.is_stable);
+    }
+
+    void write(ImportElement const& v)
+    {
+        this->write(v.name);
+        this->write(v.atomic_number);
+        this->write(v.atomic_mass);
+        this->write(v.radiation_length_tsai);
+        this->write(v.coulomb_factor);
+    }
+
+    void write(ImportMaterial const& v)
+    {
+        this->write(v.name);
+        this->write(v.state);
+        this->write(v.temperature);
+        this->write(v.density);
+        this->write(v.electron_density);
+        this->write(v.number_density);
+        this->write(v.radiation_length);
+        this->write(v.nuclear_int_length);
+        this->write(v.pdg_cutoffs);
+        this->write(v.elements);
+    }
+
+    void write(ImportPhysicsVector const& v)
+    {
+        this->write(v.vector_type);
+        this->write(v.x);
+        this->write(v.y);
+    }
+
+    void write(ImportPhysicsTable const& v)
+    {
+        this->write(v.table_type);
+        this->write(v.x_units);
+        this->write(v.y_units);
+        this->write(v.physics_vectors);
+    }
+
+    void write(ImportModelMaterial const& v)
+    {
+        this->write(v.energy);
+        this->write(v.micro_xs);
+    }
+
+    void write(ImportModel const& v)
+    {
+        this->write(v.model_class);
+        this->write(v.materials);
+    }
+
+    void write(ImportMscModel const& v)
+    {
+        this->write(v.particle_pdg);
+        this->write(v.model_class);
+        this->write(v.xs_table);
+    }
+
+    void write(ImportProcess const& v)
+    {
+        this->write(v.particle_pdg);
+        this->write(v.secondary_pdg);
+        this->write(v.process_type);
+        this->write(v.process_class);
+        this->write(v.models);
+        this->write(v.tables);
+    }
+
+    void write(ImportVolume const& v)
+    {
+        this->write(v.material_id);
+        this->write(v.name);
+        this->write(v.solid_name);
+    }
+
+    void write(ImportSBTable const& v)
+    {
+        this->write(v.x);
+        this->write(v.y);
+        this->write(v.value);
+    }
+
+    void write(ImportLivermoreSubshell const& v)
+    {
+        this->write(v.binding_energy);
+        this->write(v.param_lo);
+        this->write(v.param_hi);
+        this->write(v.xs);
+        this->write(v.energy);
+    }
+
+    void write(ImportLivermorePE const& v)
+    {
+        this->write(v.xs_lo);
+        this->write(v.xs_hi);
+        this->write(v.thresh_lo);
+        this->write(v.thresh_hi);
+        this->write(v.shells);
+    }
+
+    void write(ImportAtomicSubshell const& v)
+    {
+        this->write(v.designator);
+        this->write(v.fluor);
+        this->write(v.auger);
+    }
+
+    void write(ImportAtomicRelaxation const& v) { this->write(v.shells); }
+
+    void write(ImportData const& v)
+    {
+        this->write(v.particles);
+        this->write(v.elements);
+        this->write(v.materials);
+        this->write(v.processes);
+        this->write(v.msc_models);
+        this->write(v.volumes);
+        this->write(v.em_params);
+        this->write(v.sb_data);
+        this->write(v.livermore_pe_data);
+        this->write(v.atomic_relaxation_data);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read imported data structures written by \c ImportDataWriter .
+ */
+class ImportDataReader
+{
+  public:
+    explicit ImportDataReader(BinaryInArchive* ar) : ar_(*ar) {}
+
+    template<class T>
+    void operator()(T* value)
+    {
+        this->read(value);
+    }
+
+  private:
+    BinaryInArchive& ar_;
+
+    template<class T>
+    void read(T* value)
+    {
+        ar_(value);
+    }
+
+    void read(std::string* value) { ar_(value); }
+
+    template<class T>
+    void read(std::vector<T>* values)
+    {
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            auto span = ar_.template read_span<T>();
+            values->assign(span.begin(), span.end());
+        }
+        else
+        {
+            std::size_t size{};
+            ar_(&size);
+            // Each element occupies at least one byte
+            CELER_VALIDATE(size <= ar_.remaining(),
+                           << "invalid vector size " << size
+                           << " in binary archive");
+            values->resize(size);
+            for (T& v : *values)
+            {
+                this->read(&v);
+            }
+        }
+    }
+
+    template<class K, class V>
+    void read(std::map<K, V>* values)
+    {
+        std::size_t size{};
+        ar_(&size);
+        CELER_VALIDATE(size <= ar_.remaining(),
+                       << "invalid map size " << size << " in binary archive");
+        values->clear();
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            K key{};
+            this->read(&key);
+            this->read(&(*values)[key]);
+        }
+    }
+
+    void read(ImportParticle* v)
+    {
+        this->read(&v->name);
+        this->read(&v->pdg);
+        this->read(&v->mass);
+        this->read(&v->charge);
+        this->read(&v->spin);
+        this->read(&v->lifetime);
+        this->read(&v->is_stable);
+    }
+
+    void read(ImportElement* v)
+    {
+        this->read(&v->name);
+        this->read(&v->atomic_number);
+        this->read(&v->atomic_mass);
+        this->read(&v->radiation_length_tsai);
+        this->read(&v->coulomb_factor);
+    }
+
+    void read(ImportMaterial* v)
+    {
+        this->read(&v->name);
+        this->read(&v->state);
+        this->read(&v->temperature);
+        this->read(&v->density);
+        this->read(&v->electron_density);
+        this->read(&v->number_density);
+        this->read(&v->radiation_length);
+        this->read(&v->nuclear_int_length);
+        this->read(&v->pdg_cutoffs);
+        this->read(&v->elements);
+    }
+
+    void read(ImportPhysicsVector* v)
+    {
+        this->read(&v->vector_type);
+        this->read(&v->x);
+        this->read(&v->y);
+    }
+
+    void read(ImportPhysicsTable* v)
+    {
+        this->read(&v->table_type);
+        this->read(&v->x_units);
+        this->read(&v->y_units);
+        this->read(&v->physics_vectors);
+    }
+
+    void read(ImportModelMaterial* v)
+    {
+        this->read(&v->energy);
+        this->read(&v->micro_xs);
+    }
+
+    void read(ImportModel* v)
+    {
+        this->read(&v->model_class);
+        this->read(&v->materials);
+    }
+
+    void read(ImportMscModel* v)
+    {
+        this->read(&v->particle_pdg);
+        this->read(&v->model_class);
+        this->read(&v->xs_table);
+    }
+
+    void read(ImportProcess* v)
+    {
+        this->read(&v->particle_pdg);
+        this->read(&v->secondary_pdg);
+        this->read(&v->process_type);
+        this->read(&v->process_class);
+        this->read(&v->models);
+        this->read(&v->tables);
+    }
+
+    void read(ImportVolume* v)
+    {
+        this->read(&v->material_id);
+        this->read(&v->name);
+        this->read(&v->solid_name);
+    }
+
+    void read(ImportSBTable* v)
+    {
+        this->read(&v->x);
+        this->read(&v->y);
+        this->read(&v->value);
+    }
+
+    void read(ImportLivermoreSubshell* v)
+    {
+        this->read(&v->binding_energy);
+        this->read(&v->param_lo);
+        this->read(&v->param_hi);
+        this->read(&v->xs);
+        this->read(&v->energy);
+    }
+
+    void read(ImportLivermorePE* v)
+    {
+        this->read(&v->xs_lo);
+        this->read(&v->xs_hi);
+        this->read(&v->thresh_lo);
+        this->read(&v->thresh_hi);
+        this->read(&v->shells);
+    }
+
+    void read(ImportAtomicSubshell* v)
+    {
+        this->read(&v->designator);
+        this->read(&v->fluor);
+        this->read(&v->auger);
+    }
+
+    void read(ImportAtomicRelaxation* v) { this->read(&v->shells); }
+
+    void read(ImportData* v)
+    {
+        this->read(&v->particles);
+        this->read(&v->elements);
+        this->read(&v->materials);
+        this->read(&v->processes);
+        this->read(&v->msc_models);
+        this->read(&v->volumes);
+        this->read(&v->em_params);
+        this->read(&v->sb_data);
+        this->read(&v->livermore_pe_data);
+        this->read(&v->atomic_relaxation_data);
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all imported data to an archive.
+ */
+void archive(BinaryOutArchive& ar, ImportData const& data)
+{
+    ImportDataWriter write(&ar);
+    write(data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace imported data with data from an archive.
+ *
+ * Invalid archive data (e.g. from a truncated file) raises a \c RuntimeError.
+ */
+void unarchive(BinaryInArchive& ar, ImportData* data)
+{
+    CELER_EXPECT(data);
+    ImportData result;
+    ImportDataReader read(&ar);
+    read(&result);
+    *data = std::move(result);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportDataArchive.hh
+//! \brief Write and read imported data to binary archives
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/io/BinaryArchive.hh"
+
+#include "ImportData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Write all imported data to an archive
+void archive(BinaryOutArchive& ar, ImportData const& data);
+
+// Replace imported data with data from an archive
+void unarchive(BinaryInArchive& ar, ImportData* data);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -9,10 +9,37 @@
 
 #include <TBranch.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
+#include <TVirtualMutex.h>
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Enable ROOT thread safety before creating any ROOT file.
+ *
+ * This changes global ROOT state for the whole process, so it should be
+ * called once by the application (not by a library class) before any file
+ * that is written from another thread is opened.
+ */
+void RootFileManager::enable_thread_safety()
+{
+    ROOT::EnableThreadSafety();
+    CELER_ENSURE(RootFileManager::thread_safe());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether ROOT thread safety has been enabled.
+ *
+ * ROOT creates its global mutex when thread safety is enabled.
+ */
+bool RootFileManager::thread_safe()
+{
+    return gGlobalMutex != nullptr;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with ROOT filename.
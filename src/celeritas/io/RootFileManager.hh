@@ -25,10 +25,20 @@ namespace celeritas
  *
  * If this is expanded to store one TFile per thread, we will need to expand
  * `make_tree("name, "title")` to include a thread id as input parameter.
+ *
+ * Writers that fill trees from a background thread (such as
+ * `RootStepWriter`) require ROOT's global thread safety, which must be
+ * enabled once by the application before the file is created.
  */
 class RootFileManager
 {
   public:
+    // Enable ROOT thread safety before creating any ROOT file
+    static void enable_thread_safety();
+
+    // Whether ROOT thread safety has been enabled
+    static bool thread_safe();
+
     // Construct with filename
     explicit RootFileManager(char const* filename);
 
@@ -44,6 +54,16 @@ class RootFileManager
 
 //---------------------------------------------------------------------------//
 #if !CELERITAS_USE_ROOT
+inline void RootFileManager::enable_thread_safety()
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
+
+inline bool RootFileManager::thread_safe()
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
+
 inline RootFileManager::RootFileManager(char const*)
 {
     CELER_NOT_CONFIGURED("ROOT");
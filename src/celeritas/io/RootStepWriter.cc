@@ -7,12 +7,25 @@
 //---------------------------------------------------------------------------//
 #include "RootStepWriter.hh"
 
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <TBranch.h>
 #include <TFile.h>
 #include <TTree.h>
 
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
 
+namespace celeritas
+{
 namespace
 {
 //---------------------------------------------------------------------------//
@@ -29,16 +42,246 @@ void copy_if_selected(const T1& src, T2& dst)
 /*!
  * Copy StepPointStateData Real3 position and direction to TStepPoint arrays.
  */
-void copy_if_selected(celeritas::Real3 const& src, std::array<double, 3>& dst)
+void copy_if_selected(Real3 const& src, std::array<double, 3>& dst)
 {
     std::memcpy(&dst, &src, sizeof(src));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Selected step attributes for many steps, stored by column.
+ *
+ * The naming convention matches TStepData.
+ */
+struct StepColumns
+{
+    template<class T>
+    using Vec = std::vector<T>;
+
+    struct Point
+    {
+        Vec<size_type> volume_id;
+        Vec<real_type> energy;
+        Vec<real_type> time;
+        Vec<Real3> pos;
+        Vec<Real3> dir;
+    };
+
+    Vec<size_type> track_id;
+    Vec<size_type> event_id;
+    Vec<size_type> parent_id;
+    Vec<size_type> action_id;
+    Vec<size_type> track_step_count;
+    Vec<int> particle;
+    Vec<real_type> energy_deposition;
+    Vec<real_type> step_length;
+    Vec<real_type> weight;
+    EnumArray<StepPoint, Point> points;
+
+    //! Number of buffered steps
+    size_type size() const { return track_id.size(); }
+
+    //! Remove all steps, keeping the allocations
+    void clear()
+    {
+        auto clear_column = [](auto& col) { col.clear(); };
+        clear_column(track_id);
+        clear_column(event_id);
+        clear_column(parent_id);
+        clear_column(action_id);
+        clear_column(track_step_count);
+        clear_column(particle);
+        clear_column(energy_deposition);
+        clear_column(step_length);
+        clear_column(weight);
+        for (auto sp : range(StepPoint::size_))
+        {
+            clear_column(points[sp].volume_id);
+            clear_column(points[sp].energy);
+            clear_column(points[sp].time);
+            clear_column(points[sp].pos);
+            clear_column(points[sp].dir);
+        }
+    }
+};
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
-namespace celeritas
+//---------------------------------------------------------------------------//
+/*!
+ * Per-stream buffers and background writer thread.
+ *
+ * A stream's buffer is only accessed by the thread executing that stream until
+ * it's full, when it is moved to the queue and replaced by an empty one. The
+ * mutex guards the stream map, the queue, and the recycled buffers.
+ */
+struct RootStepWriter::Impl
+{
+    struct StreamBuffer
+    {
+        StepColumns columns;
+        std::vector<ThreadId> rows;
+    };
+
+    size_type buffer_size{16384};
+
+    std::mutex mutex;
+    std::map<StreamId::size_type, std::unique_ptr<StreamBuffer>> streams;
+    std::deque<StepColumns> queued;
+    std::vector<StepColumns> spare;
+    size_type num_writing{0};
+    bool stopped{false};
+    std::exception_ptr error;
+
+    std::condition_variable columns_queued;
+    std::condition_variable columns_written;
+    std::thread writer;
+
+    // Get the buffer for a stream
+    StreamBuffer& get_stream(StreamId sid);
+
+    // Hand a full buffer to the writer (caller holds lock)
+    void enqueue(StepColumns* columns);
+
+    // Fill the tree with queued columns until stopped
+    void write_loop(RootStepWriter* rsw);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the buffer for a stream, creating it if needed.
+ */
+auto RootStepWriter::Impl::get_stream(StreamId sid) -> StreamBuffer&
+{
+    CELER_EXPECT(sid);
+    std::lock_guard<std::mutex> scoped_lock(mutex);
+    auto& result = streams[sid.get()];
+    if (!result)
+    {
+        result = std::make_unique<StreamBuffer>();
+    }
+    return *result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hand a full buffer to the writer and replace it with an empty one.
+ */
+void RootStepWriter::Impl::enqueue(StepColumns* columns)
+{
+    CELER_EXPECT(columns && columns->size() > 0);
+    queued.push_back(std::move(*columns));
+    if (!spare.empty())
+    {
+        *columns = std::move(spare.back());
+        spare.pop_back();
+    }
+    else
+    {
+        *columns = StepColumns{};
+    }
+    columns_queued.notify_one();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the tree with queued columns until stopped.
+ *
+ * This is the only thread that accesses the tree and its branch addresses
+ * during execution. Each buffered step is copied into the branch addresses
+ * and written as a separate entry so that the file layout is independent of
+ * the buffering.
+ */
+void RootStepWriter::Impl::write_loop(RootStepWriter* rsw)
+{
+#define RSW_LOAD(ATTR)                                           \
+    do                                                           \
+    {                                                            \
+        if (rsw->selection_.ATTR)                                \
+        {                                                        \
+            copy_if_selected(columns.ATTR[i], rsw->tstep_.ATTR); \
+        }                                                        \
+    } while (0)
+
+    TTree& tree = *rsw->tstep_tree_;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        columns_queued.wait(lock,
+                            [this] { return stopped || !queued.empty(); });
+        if (queued.empty())
+        {
+            return;
+        }
+        StepColumns columns = std::move(queued.front());
+        queued.pop_front();
+        ++num_writing;
+        lock.unlock();
+
+        try
+        {
+            for (auto i : range(columns.size()))
+            {
+                rsw->tstep_.track_id = columns.track_id[i];
+                RSW_LOAD(event_id);
+                RSW_LOAD(parent_id);
+                RSW_LOAD(action_id);
+                RSW_LOAD(energy_deposition);
+                RSW_LOAD(step_length);
+                RSW_LOAD(weight);
+                RSW_LOAD(track_step_count);
+                RSW_LOAD(particle);
+                for (auto const sp : range(StepPoint::size_))
+                {
+                    RSW_LOAD(points[sp].volume_id);
+                    RSW_LOAD(points[sp].energy);
+                    RSW_LOAD(points[sp].time);
+                    RSW_LOAD(points[sp].dir);
+                    RSW_LOAD(points[sp].pos);
+                }
+                CELER_VALIDATE(tree.Fill() > 0,
+                               << "failed to write step to ROOT tree '"
+                               << tree.GetName() << "'");
+            }
+        }
+        catch (...)
+        {
+            lock.lock();
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+            lock.unlock();
+        }
+        columns.clear();
+
+        lock.lock();
+        spare.push_back(std::move(columns));
+        --num_writing;
+        columns_written.notify_all();
+    }
+#undef RSW_LOAD
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop the writer thread.
+ */
+void RootStepWriter::ImplDeleter::operator()(Impl* impl)
 {
+    {
+        std::lock_guard<std::mutex> scoped_lock(impl->mutex);
+        impl->stopped = true;
+    }
+    impl->columns_queued.notify_all();
+    if (impl->writer.joinable())
+    {
+        impl->writer.join();
+    }
+    delete impl;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct writer with user-defined data filtering.
@@ -52,10 +295,15 @@ RootStepWriter::RootStepWriter(SPRootFileManager root_manager,
     , particles_(particle_params)
     , selection_(selection)
     , filter_(filter)
-
+    , impl_(new Impl)
 {
     CELER_EXPECT(root_manager_);
+    CELER_VALIDATE(RootFileManager::thread_safe(),
+                   << "ROOT thread safety must be enabled (see "
+                      "RootFileManager::enable_thread_safety) before "
+                      "creating the ROOT file for RootStepWriter");
     this->make_tree();
+    impl_->writer = std::thread([this] { impl_->write_loop(this); });
 }
 
 //---------------------------------------------------------------------------//
@@ -68,9 +316,25 @@ RootStepWriter::RootStepWriter(SPRootFileManager root_manager,
     : RootStepWriter(std::move(root_manager),
                      std::move(particle_params),
                      std::move(selection),
-                     [](RootStepWriter::TStepData const&) { return true; })
+                     WriteFilter{})
+{
+}
 
+//---------------------------------------------------------------------------//
+/*!
+ * Write any remaining steps and stop the writer thread.
+ */
+RootStepWriter::~RootStepWriter()
 {
+    try
+    {
+        this->flush();
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(error) << "Failed to write buffered steps to ROOT: "
+                         << e.what();
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -90,23 +354,80 @@ void RootStepWriter::set_auto_flush(long num_entries)
 
 //---------------------------------------------------------------------------//
 /*!
- * Collect step data and fill the ROOT TTree for all active threads.
+ * Set the number of steps buffered by each stream before writing.
+ *
+ * This should be called before execution.
+ */
+void RootStepWriter::set_buffer_size(size_type num_steps)
+{
+    CELER_EXPECT(num_steps > 0);
+    std::lock_guard<std::mutex> scoped_lock(impl_->mutex);
+    impl_->buffer_size = num_steps;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all buffered steps to the tree.
+ *
+ * This must not be called while any stream is executing.
+ */
+void RootStepWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(impl_->mutex);
+    for (auto& kv : impl_->streams)
+    {
+        if (kv.second->columns.size() > 0)
+        {
+            impl_->enqueue(&kv.second->columns);
+        }
+    }
+    impl_->columns_written.wait(lock, [this] {
+        return impl_->queued.empty() && impl_->num_writing == 0;
+    });
+    if (impl_->error)
+    {
+        std::rethrow_exception(std::exchange(impl_->error, nullptr));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the selected step data of active tracks into the stream's buffer.
+ *
+ * Each selected attribute is copied as a whole column. If a user filter is
+ * present, the full step data for each active track is assembled first to
+ * decide which tracks are written.
  */
 void RootStepWriter::execute(StateHostRef const& steps)
 {
-#define RSW_STORE(ATTR, GETTER)                                    \
-    do                                                             \
-    {                                                              \
-        if (selection_.ATTR)                                       \
-        {                                                          \
-            copy_if_selected(steps.ATTR[tid] GETTER, tstep_.ATTR); \
-        }                                                          \
+#define RSW_STORE(ATTR, GETTER)                                   \
+    do                                                            \
+    {                                                             \
+        if (selection_.ATTR)                                      \
+        {                                                         \
+            copy_if_selected(steps.ATTR[tid] GETTER, tstep.ATTR); \
+        }                                                         \
+    } while (0)
+#define RSW_APPEND(ATTR, GETTER)                                     \
+    do                                                               \
+    {                                                                \
+        if (selection_.ATTR)                                         \
+        {                                                            \
+            columns.ATTR.reserve(columns.ATTR.size() + rows.size()); \
+            for (ThreadId tid : rows)                                \
+            {                                                        \
+                columns.ATTR.push_back(steps.ATTR[tid] GETTER);      \
+            }                                                        \
+        }                                                            \
     } while (0)
 
     CELER_EXPECT(steps);
-    tstep_ = TStepData();
 
-    // Loop over thread ids and fill TTree
+    auto& buffer = impl_->get_stream(steps.stream_id);
+    auto& rows = buffer.rows;
+
+    // Select active tracks that pass the filter
+    rows.clear();
     for (auto const tid : range(ThreadId{steps.size()}))
     {
         if (!steps.track_id[tid])
@@ -114,37 +435,86 @@ void RootStepWriter::execute(StateHostRef const& steps)
             // Track id not found; skip inactive track slot
             continue;
         }
-
-        // Track id is always set
-        tstep_.track_id = steps.track_id[tid].unchecked_get();
-
-        RSW_STORE(event_id, .get());
-        RSW_STORE(parent_id, .unchecked_get());
-        RSW_STORE(action_id, .get());
-        RSW_STORE(energy_deposition, .value());
-        RSW_STORE(step_length, /* no getter */);
-        RSW_STORE(track_step_count, /* no getter */);
-        if (selection_.particle)
+        if (filter_)
         {
-            copy_if_selected(particles_->id_to_pdg(steps.particle[tid]).get(),
-                             tstep_.particle);
+            TStepData tstep;
+            tstep.track_id = steps.track_id[tid].unchecked_get();
+            RSW_STORE(event_id, .get());
+            RSW_STORE(parent_id, .unchecked_get());
+            RSW_STORE(action_id, .get());
+            RSW_STORE(energy_deposition, .value());
+            RSW_STORE(step_length, /* no getter */);
+            RSW_STORE(weight, /* no getter */);
+            RSW_STORE(track_step_count, /* no getter */);
+            if (selection_.particle)
+            {
+                tstep.particle
+                    = particles_->id_to_pdg(steps.particle[tid]).get();
+            }
+            for (auto const sp : range(StepPoint::size_))
+            {
+                RSW_STORE(points[sp].volume_id, .unchecked_get());
+                RSW_STORE(points[sp].energy, .value());
+                RSW_STORE(points[sp].time, /* no getter */);
+                RSW_STORE(points[sp].dir, /* no getter */);
+                RSW_STORE(points[sp].pos, /* no getter */);
+            }
+            if (!filter_(tstep))
+            {
+                continue;
+            }
         }
+        rows.push_back(tid);
+    }
 
-        for (auto const sp : range(StepPoint::size_))
+    // Append each selected column
+    auto& columns = buffer.columns;
+    columns.track_id.reserve(columns.track_id.size() + rows.size());
+    for (ThreadId tid : rows)
+    {
+        columns.track_id.push_back(steps.track_id[tid].unchecked_get());
+    }
+    RSW_APPEND(event_id, .get());
+    RSW_APPEND(parent_id, .unchecked_get());
+    RSW_APPEND(action_id, .get());
+    RSW_APPEND(energy_deposition, .value());
+    RSW_APPEND(step_length, /* no getter */);
+    RSW_APPEND(weight, /* no getter */);
+    RSW_APPEND(track_step_count, /* no getter */);
+    if (selection_.particle)
+    {
+        columns.particle.reserve(columns.particle.size() + rows.size());
+        for (ThreadId tid : rows)
         {
-            RSW_STORE(points[sp].volume_id, .unchecked_get());
-            RSW_STORE(points[sp].energy, .value());
-            RSW_STORE(points[sp].time, /* no getter */);
-            RSW_STORE(points[sp].dir, /* no getter */);
-            RSW_STORE(points[sp].pos, /* no getter */);
+            columns.particle.push_back(
+                particles_->id_to_pdg(steps.particle[tid]).get());
         }
+    }
+    for (auto const sp : range(StepPoint::size_))
+    {
+        RSW_APPEND(points[sp].volume_id, .unchecked_get());
+        RSW_APPEND(points[sp].energy, .value());
+        RSW_APPEND(points[sp].time, /* no getter */);
+        RSW_APPEND(points[sp].dir, /* no getter */);
+        RSW_APPEND(points[sp].pos, /* no getter */);
+    }
 
-        if (filter_(tstep_))
+    if (columns.size() >= impl_->buffer_size)
+    {
+        // Wait for the writer if each stream already has a full buffer queued
+        std::unique_lock<std::mutex> lock(impl_->mutex);
+        impl_->columns_written.wait(lock, [this] {
+            return impl_->queued.size() < impl_->streams.size()
+                   || impl_->error;
+        });
+        if (impl_->error)
         {
-            tstep_tree_->Fill();
+            std::rethrow_exception(std::exchange(impl_->error, nullptr));
         }
+        impl_->enqueue(&columns);
     }
 
+#undef RSW_APPEND
 #undef RSW_STORE
 }
 
@@ -176,6 +546,7 @@ void RootStepWriter::make_tree()
     RSW_CREATE_BRANCH(track_step_count, "track_step_count");
     RSW_CREATE_BRANCH(action_id, "action_id");
     RSW_CREATE_BRANCH(step_length, "step_length");
+    RSW_CREATE_BRANCH(weight, "weight");
     RSW_CREATE_BRANCH(particle, "particle");
     RSW_CREATE_BRANCH(energy_deposition, "energy_deposition");
     // Pre-step
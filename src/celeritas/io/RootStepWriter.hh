@@ -8,6 +8,8 @@
 #pragma once
 
 #include <array>
+#include <functional>
+#include <memory>
 
 #include "celeritas_config.h"
 #include "corecel/Assert.hh"
@@ -22,13 +24,26 @@ namespace celeritas
 /*!
  * Write "MC truth" data to ROOT at every step.
  *
- * `TTree::Fill()` is called for each step and thread id, making each ROOT
- * entry a step. Since the ROOT data is stored in branches with primitive types
- * instead of a full struct, no dictionaries are needed for reading the output
- * file.
+ * Each ROOT entry is a single step of a single track. Since the ROOT data is
+ * stored in branches with primitive types instead of a full struct, no
+ * dictionaries are needed for reading the output file.
  *
  * The step data that is written to the ROOT file can be filtered by providing
  * a user-defined `WriteFilter` function.
+ *
+ * During \c execute, the selected attributes of the active (and unfiltered)
+ * tracks are copied column by column into a buffer owned by the calling
+ * stream, so multiple streams can execute simultaneously. When a stream's
+ * buffer reaches the buffer size, it is handed to a background thread that
+ * fills the tree one step at a time (serializing and compressing the ROOT
+ * baskets) while transport continues. At most one full buffer per stream is
+ * queued: beyond that, \c execute waits for the writer. Call \c flush before
+ * reading the tree; the destructor writes any remaining steps.
+ *
+ * Because the tree is filled from another thread, ROOT thread safety must be
+ * enabled with \c RootFileManager::enable_thread_safety before the ROOT file
+ * is created. Between the first \c execute and \c flush, only the writer
+ * thread may access the ROOT file.
  */
 class RootStepWriter final : public StepInterface
 {
@@ -60,6 +75,7 @@ class RootStepWriter final : public StepInterface
         int particle = unspecified();  //!< PDG number
         real_type energy_deposition = unspecified();  //!< [MeV]
         real_type step_length = unspecified();  //!< [cm]
+        real_type weight = unspecified();
         EnumArray<StepPoint, TStepPoint> points;
     };
 
@@ -82,9 +98,18 @@ class RootStepWriter final : public StepInterface
                    SPParticleParams particle_params,
                    StepSelection selection);
 
+    // Write any remaining steps and stop the writer thread
+    ~RootStepWriter();
+
     // Set number of entries stored in memory before being flushed to disk
     void set_auto_flush(long num_entries);
 
+    // Set the number of steps buffered by each stream before writing
+    void set_buffer_size(size_type num_steps);
+
+    // Write all buffered steps to the tree
+    void flush();
+
     // Process step data on the host and fill step tree
     void execute(StateHostRef const& steps) final;
 
@@ -100,6 +125,13 @@ class RootStepWriter final : public StepInterface
     // No detector filtering selection is implemented
     Filters filters() const final { return {}; }
 
+  private:
+    struct Impl;
+    struct ImplDeleter
+    {
+        void operator()(Impl*);
+    };
+
   private:
     // Create steps tree based on selection_ booleans
     void make_tree();
@@ -110,7 +142,8 @@ class RootStepWriter final : public StepInterface
     StepSelection selection_;
     UPRootWritable<TTree> tstep_tree_;
     TStepData tstep_;  // Members are used as refs of the TTree branches
-    std::function<bool(TStepData const&)> filter_;
+    WriteFilter filter_;
+    std::unique_ptr<Impl, ImplDeleter> impl_;
 };
 
 //---------------------------------------------------------------------------//
@@ -123,10 +156,39 @@ inline RootStepWriter::RootStepWriter(SPRootFileManager,
     CELER_NOT_CONFIGURED("ROOT");
 }
 
+inline RootStepWriter::RootStepWriter(SPRootFileManager,
+                                      SPParticleParams,
+                                      StepSelection)
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
+
+inline RootStepWriter::~RootStepWriter() = default;
+
+inline void RootStepWriter::set_auto_flush(long)
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
+
+inline void RootStepWriter::set_buffer_size(size_type)
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
+
+inline void RootStepWriter::flush()
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
+
 inline void RootStepWriter::execute(StateHostRef const&)
 {
     CELER_NOT_CONFIGURED("ROOT");
 }
+
+inline void RootStepWriter::ImplDeleter::operator()(Impl*)
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
 #endif
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/StepColumnReader.cc
+//---------------------------------------------------------------------------//
+#include "StepColumnReader.hh"
+
+#include <algorithm>
+#include <numeric>
+
+#include "corecel/io/BinaryArchive.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file and read the column layout and chunk index.
+ */
+StepColumnReader::StepColumnReader(std::string const& filename)
+    : file_(filename)
+{
+    CELER_VALIDATE(file_,
+                   << "failed to open step output file '" << filename << "'");
+
+    BinaryInArchive ar(file_.data());
+    std::uint64_t magic{};
+    std::uint32_t version{};
+    ar(&magic);
+    ar(&version);
+    CELER_VALIDATE(magic == detail::step_column_magic,
+                   << "'" << filename << "' is not a step output file");
+    CELER_VALIDATE(version == detail::step_column_version,
+                   << "unsupported step output file version " << version
+                   << " (expected " << detail::step_column_version << ")");
+
+    std::uint32_t num_columns{};
+    ar(&num_columns);
+    columns_.resize(num_columns);
+    for (auto& col : columns_)
+    {
+        std::uint32_t scalar_size{};
+        std::uint32_t components{};
+        ar(&col.name);
+        ar(&col.type);
+        ar(&scalar_size);
+        ar(&components);
+        col.scalar_size = scalar_size;
+        col.components = components;
+    }
+
+    // Read the trailer: index offset and magic number
+    auto data = file_.data();
+    std::uint64_t index_offset{};
+    constexpr std::size_t trailer_size = sizeof(index_offset) + sizeof(magic);
+    magic = 0;
+    std::size_t header_size = data.size() - ar.remaining();
+    if (data.size() >= header_size + trailer_size)
+    {
+        char const* trailer = data.data() + data.size() - trailer_size;
+        std::memcpy(&index_offset, trailer, sizeof(index_offset));
+        std::memcpy(&magic, trailer + sizeof(index_offset), sizeof(magic));
+    }
+    CELER_VALIDATE(magic == detail::step_column_magic,
+                   << "step output file '" << filename
+                   << "' has no chunk index (was the writer finalized?)");
+
+    ar.seek(index_offset);
+    auto offsets = ar.read_span<std::uint64_t>();
+    auto rows = ar.read_span<std::uint64_t>();
+    CELER_VALIDATE(offsets.size() == rows.size(),
+                   << "inconsistent chunk index in step output file '"
+                   << filename << "'");
+    chunk_offsets_.assign(offsets.begin(), offsets.end());
+    chunk_rows_.assign(rows.begin(), rows.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the index of a column by name.
+ *
+ * If the column is not present, the result is the number of columns.
+ */
+size_type StepColumnReader::find(std::string const& name) const
+{
+    auto iter = std::find_if(columns_.begin(),
+                             columns_.end(),
+                             [&name](ColumnInfo const& col) {
+                                 return col.name == name;
+                             });
+    return iter - columns_.begin();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total number of steps.
+ */
+size_type StepColumnReader::num_rows() const
+{
+    return static_cast<size_type>(std::accumulate(
+        chunk_rows_.begin(), chunk_rows_.end(), std::uint64_t{0}));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access the bytes of one column in a chunk.
+ *
+ * The result points into the mapped file if the column is stored raw, or into
+ * the scratch space if it has to be decoded.
+ */
+Span<char const> StepColumnReader::read(size_type chunk,
+                                        size_type column,
+                                        std::vector<char>* scratch) const
+{
+    CELER_EXPECT(chunk < this->num_chunks());
+    CELER_EXPECT(column < columns_.size());
+    CELER_EXPECT(scratch);
+
+    BinaryInArchive ar(file_.data());
+    ar.seek(chunk_offsets_[chunk]);
+    std::uint32_t codec{};
+    Span<char const> encoded;
+    for (size_type i = 0; i <= column; ++i)
+    {
+        ar(&codec);
+        encoded = ar.read_span<char>();
+    }
+
+    auto const& info = columns_[column];
+    std::size_t size = chunk_rows_[chunk] * info.width();
+    switch (static_cast<detail::ColumnCodec>(codec))
+    {
+        case detail::ColumnCodec::raw:
+            CELER_VALIDATE(encoded.size() == size,
+                           << "step column '" << info.name << "' in chunk "
+                           << chunk << " has " << encoded.size()
+                           << " bytes but expected " << size);
+            return encoded;
+        case detail::ColumnCodec::shuffle_rle:
+            scratch->resize(size);
+            detail::decode_shuffle_rle(
+                encoded, info.scalar_size, make_span(*scratch));
+            return make_span(*scratch);
+        default:
+            CELER_VALIDATE(false,
+                           << "unknown encoding " << codec
+                           << " for step column '" << info.name << "'");
+    }
+    CELER_ASSERT_UNREACHABLE();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/StepColumnReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/sys/MappedFile.hh"
+
+#include "detail/StepColumnIO.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read step data written by \c StepColumnWriter.
+ *
+ * The file is memory mapped, and columns that were stored uncompressed are
+ * accessed without copying.
+ *
+ * \code
+    StepColumnReader read_steps("steps.celersteps");
+    auto track_ids = read_steps.read_all<unsigned int>("track_id");
+    auto pre_pos = read_steps.read_all<Real3>("pre_pos");
+   \endcode
+ */
+class StepColumnReader
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using ColumnInfo = detail::StepColumnInfo;
+    using SpanConstColumn = Span<ColumnInfo const>;
+    //!@}
+
+  public:
+    // Map the file and read the column layout and chunk index
+    explicit StepColumnReader(std::string const& filename);
+
+    //! Layout of the columns in the file
+    SpanConstColumn columns() const { return make_span(columns_); }
+
+    // Find the index of a column by name
+    size_type find(std::string const& name) const;
+
+    //! Number of chunks
+    size_type num_chunks() const { return chunk_offsets_.size(); }
+
+    //! Number of steps in a chunk
+    size_type num_rows(size_type chunk) const
+    {
+        CELER_EXPECT(chunk < this->num_chunks());
+        return chunk_rows_[chunk];
+    }
+
+    // Total number of steps
+    size_type num_rows() const;
+
+    // Access the bytes of one column in a chunk
+    Span<char const> read(size_type chunk,
+                          size_type column,
+                          std::vector<char>* scratch) const;
+
+    // Read a column from all chunks
+    template<class T>
+    inline std::vector<T> read_all(std::string const& name) const;
+
+  private:
+    MappedFile file_;
+    std::vector<ColumnInfo> columns_;
+    std::vector<std::uint64_t> chunk_offsets_;
+    std::vector<std::uint64_t> chunk_rows_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Read a column from all chunks.
+ *
+ * The value type must have the same size as a row of the column.
+ */
+template<class T>
+std::vector<T> StepColumnReader::read_all(std::string const& name) const
+{
+    size_type column = this->find(name);
+    CELER_VALIDATE(column < columns_.size(),
+                   << "no step column named '" << name << "'");
+    CELER_VALIDATE(sizeof(T) == columns_[column].width(),
+                   << "cannot read step column '" << name << "' with "
+                   << columns_[column].width() << "-byte rows into "
+                   << sizeof(T) << "-byte values");
+
+    std::vector<T> result(this->num_rows());
+    std::vector<char> scratch;
+    char* out = reinterpret_cast<char*>(result.data());
+    for (auto chunk : range(this->num_chunks()))
+    {
+        auto data = this->read(chunk, column, &scratch);
+        std::memcpy(out, data.data(), data.size());
+        out += data.size();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,389 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/StepColumnWriter.cc
+//---------------------------------------------------------------------------//
+#include "StepColumnWriter.hh"
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/OpaqueId.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/Quantity.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fixed-width layout of a state value written as raw bytes.
+ */
+template<class T>
+struct ColumnTraits
+{
+    static_assert(std::is_arithmetic<T>::value, "unsupported column type");
+
+    static constexpr char type = std::is_floating_point<T>::value ? 'f'
+                                 : std::is_signed<T>::value       ? 'i'
+                                                                  : 'u';
+    static constexpr size_type scalar_size = sizeof(T);
+    static constexpr size_type components = 1;
+};
+
+template<class V, class S>
+struct ColumnTraits<OpaqueId<V, S>> : ColumnTraits<S>
+{
+};
+
+template<class U, class V>
+struct ColumnTraits<Quantity<U, V>> : ColumnTraits<V>
+{
+};
+
+template<class T, size_type N>
+struct ColumnTraits<Array<T, N>> : ColumnTraits<T>
+{
+    static constexpr size_type components = N;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a view to all track slots of a state collection.
+ */
+template<class T, Ownership W, MemSpace M, class I>
+Span<T const> all_items(Collection<T, W, M, I> const& c)
+{
+    return c[AllItems<T, M>{}];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append the raw bytes of the selected rows to a column.
+ */
+template<class T>
+void append_rows(Span<T const> src,
+                 Span<ThreadId const> rows,
+                 std::vector<char>* dst)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "step columns must be trivially copyable");
+    std::size_t start = dst->size();
+    dst->resize(start + rows.size() * sizeof(T));
+    char* out = dst->data() + start;
+    if (rows.size() == src.size())
+    {
+        // All track slots are active
+        std::memcpy(out, src.data(), src.size() * sizeof(T));
+        return;
+    }
+    for (ThreadId tid : rows)
+    {
+        std::memcpy(out, src.data() + tid.unchecked_get(), sizeof(T));
+        out += sizeof(T);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open the file and write the column layout.
+ */
+StepColumnWriter::StepColumnWriter(std::string const& filename,
+                                   SPConstParticles particles,
+                                   StepSelection selection)
+    : particles_(std::move(particles))
+    , selection_(selection)
+    , os_(filename, std::ios::out | std::ios::binary)
+    , ar_(&os_)
+{
+#define SCW_ADD_COLUMN(ATTR, NAME)                                 \
+    do                                                             \
+    {                                                              \
+        if (selection_.ATTR)                                       \
+        {                                                          \
+            this->add_column(NAME, [](StateHostRef const& steps) { \
+                return all_items(steps.ATTR);                      \
+            });                                                    \
+        }                                                          \
+    } while (0)
+
+    CELER_EXPECT(particles_ || !selection_.particle);
+    CELER_VALIDATE(os_,
+                   << "failed to open step output file '" << filename
+                   << "' for writing");
+
+    this->add_column("track_id", [](StateHostRef const& steps) {
+        return all_items(steps.track_id);
+    });
+    SCW_ADD_COLUMN(event_id, "event_id");
+    SCW_ADD_COLUMN(parent_id, "parent_id");
+    SCW_ADD_COLUMN(track_step_count, "track_step_count");
+    SCW_ADD_COLUMN(action_id, "action_id");
+    SCW_ADD_COLUMN(step_length, "step_length");
+    SCW_ADD_COLUMN(weight, "weight");
+    if (selection_.particle)
+    {
+        Column col;
+        col.info.name = "particle";
+        col.info.type = 'i';
+        col.info.scalar_size = sizeof(int);
+        col.append = [particles = particles_.get()](StateHostRef const& steps,
+                                                    SpanConstThreadId rows,
+                                                    std::vector<char>* dst) {
+            std::size_t start = dst->size();
+            dst->resize(start + rows.size() * sizeof(int));
+            char* out = dst->data() + start;
+            for (ThreadId tid : rows)
+            {
+                int pdg = particles->id_to_pdg(steps.particle[tid]).get();
+                std::memcpy(out, &pdg, sizeof(int));
+                out += sizeof(int);
+            }
+        };
+        columns_.push_back(std::move(col));
+    }
+    SCW_ADD_COLUMN(energy_deposition, "energy_deposition");
+    SCW_ADD_COLUMN(points[StepPoint::pre].volume_id, "pre_volume_id");
+    SCW_ADD_COLUMN(points[StepPoint::pre].dir, "pre_dir");
+    SCW_ADD_COLUMN(points[StepPoint::pre].pos, "pre_pos");
+    SCW_ADD_COLUMN(points[StepPoint::pre].energy, "pre_energy");
+    SCW_ADD_COLUMN(points[StepPoint::pre].time, "pre_time");
+    SCW_ADD_COLUMN(points[StepPoint::post].volume_id, "post_volume_id");
+    SCW_ADD_COLUMN(points[StepPoint::post].dir, "post_dir");
+    SCW_ADD_COLUMN(points[StepPoint::post].pos, "post_pos");
+    SCW_ADD_COLUMN(points[StepPoint::post].energy, "post_energy");
+    SCW_ADD_COLUMN(points[StepPoint::post].time, "post_time");
+
+    ar_(detail::step_column_magic);
+    ar_(detail::step_column_version);
+    ar_(static_cast<std::uint32_t>(columns_.size()));
+    for (auto const& col : columns_)
+    {
+        ar_(col.info.name);
+        ar_(col.info.type);
+        ar_(static_cast<std::uint32_t>(col.info.scalar_size));
+        ar_(static_cast<std::uint32_t>(col.info.components));
+    }
+#undef SCW_ADD_COLUMN
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write remaining steps and the index if not finalized.
+ */
+StepColumnWriter::~StepColumnWriter()
+{
+    if (os_.is_open())
+    {
+        try
+        {
+            this->finalize();
+        }
+        catch (std::exception const& e)
+        {
+            CELER_LOG(error) << "Failed to finalize step output: " << e.what();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the number of steps per chunk.
+ *
+ * Each stream writes a chunk once it has buffered at least this many steps.
+ * This should be called before execution.
+ */
+void StepColumnWriter::set_chunk_size(size_type num_steps)
+{
+    CELER_EXPECT(num_steps > 0);
+    chunk_size_ = num_steps;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all buffered steps and the chunk index, and close the file.
+ *
+ * This must not be called while any stream is executing.
+ */
+void StepColumnWriter::finalize()
+{
+    CELER_EXPECT(os_.is_open());
+
+    for (auto& kv : streams_)
+    {
+        if (kv.second->num_rows > 0)
+        {
+            this->write_chunk(kv.second.get());
+        }
+    }
+
+    std::uint64_t index_offset = ar_.offset();
+    using SpanConstU64 = Span<std::uint64_t const>;
+    ar_(SpanConstU64{make_span(chunk_offsets_)});
+    ar_(SpanConstU64{make_span(chunk_rows_)});
+    ar_(index_offset);
+    ar_(detail::step_column_magic);
+    os_.close();
+    CELER_VALIDATE(os_, << "failed to close step output file");
+    CELER_LOG(debug) << "Wrote " << chunk_offsets_.size()
+                     << " step chunks in " << ar_.offset() << " bytes";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Buffer step data and write full chunks.
+ */
+void StepColumnWriter::execute(StateHostRef const& steps)
+{
+    CELER_EXPECT(steps);
+    CELER_EXPECT(os_.is_open());
+
+    auto& buffer = this->get_stream(steps.stream_id);
+
+    // Select active tracks
+    buffer.rows.clear();
+    for (auto tid : range(ThreadId{steps.size()}))
+    {
+        if (steps.track_id[tid])
+        {
+            buffer.rows.push_back(tid);
+        }
+    }
+    if (buffer.rows.empty())
+    {
+        return;
+    }
+
+    // Append each column
+    for (auto i : range(columns_.size()))
+    {
+        columns_[i].append(steps, make_span(buffer.rows), &buffer.columns[i]);
+    }
+    buffer.num_rows += buffer.rows.size();
+
+    if (buffer.num_rows >= chunk_size_)
+    {
+        this->write_chunk(&buffer);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a column of raw state values.
+ */
+template<class F>
+void StepColumnWriter::add_column(char const* name, F&& get)
+{
+    using SpanT = decltype(get(std::declval<StateHostRef const&>()));
+    using T = std::remove_const_t<typename SpanT::element_type>;
+    using Traits = ColumnTraits<T>;
+    static_assert(sizeof(T) == Traits::scalar_size * Traits::components,
+                  "step column values must be tightly packed");
+
+    Column col;
+    col.info.name = name;
+    col.info.type = Traits::type;
+    col.info.scalar_size = Traits::scalar_size;
+    col.info.components = Traits::components;
+    col.append = [get = std::forward<F>(get)](StateHostRef const& steps,
+                                              SpanConstThreadId rows,
+                                              std::vector<char>* dst) {
+        append_rows(get(steps), rows, dst);
+    };
+    columns_.push_back(std::move(col));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the buffer for a stream, creating it if needed.
+ */
+auto StepColumnWriter::get_stream(StreamId sid) -> StreamBuffer&
+{
+    CELER_EXPECT(sid);
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    auto& result = streams_[sid.get()];
+    if (!result)
+    {
+        result = std::make_unique<StreamBuffer>();
+        result->columns.resize(columns_.size());
+    }
+    return *result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Encode a stream's buffered columns and append them to the file.
+ *
+ * Encoding is done by the calling thread so that multiple streams can
+ * compress simultaneously; only the file write is serialized. Columns that
+ * don't compress are written raw so that the reader can access them without
+ * copying.
+ */
+void StepColumnWriter::write_chunk(StreamBuffer* buffer)
+{
+    CELER_EXPECT(buffer && buffer->num_rows > 0);
+
+    // Encode columns into a single buffer
+    std::vector<std::pair<detail::ColumnCodec, std::size_t>> encoded_end(
+        columns_.size());
+    buffer->encoded.clear();
+    for (auto i : range(columns_.size()))
+    {
+        auto const& raw = buffer->columns[i];
+        std::size_t start = buffer->encoded.size();
+        detail::encode_shuffle_rle(
+            make_span(raw), columns_[i].info.scalar_size, &buffer->encoded);
+        if (buffer->encoded.size() - start < raw.size())
+        {
+            encoded_end[i] = {detail::ColumnCodec::shuffle_rle,
+                              buffer->encoded.size()};
+        }
+        else
+        {
+            buffer->encoded.resize(start);
+            encoded_end[i] = {detail::ColumnCodec::raw, start};
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> scoped_lock(mutex_);
+        chunk_offsets_.push_back(ar_.offset());
+        chunk_rows_.push_back(buffer->num_rows);
+        std::size_t start = 0;
+        for (auto i : range(columns_.size()))
+        {
+            auto codec = encoded_end[i].first;
+            std::size_t end = encoded_end[i].second;
+            ar_(static_cast<std::uint32_t>(codec));
+            if (codec == detail::ColumnCodec::raw)
+            {
+                ar_(Span<char const>{make_span(buffer->columns[i])});
+            }
+            else
+            {
+                ar_(Span<char const>{buffer->encoded.data() + start,
+                                     end - start});
+                start = end;
+            }
+        }
+    }
+
+    for (auto& col : buffer->columns)
+    {
+        col.clear();
+    }
+    buffer->num_rows = 0;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,128 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/StepColumnWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "corecel/io/BinaryArchive.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/user/StepInterface.hh"
+
+#include "detail/StepColumnIO.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write "MC truth" step data to a chunked columnar binary file.
+ *
+ * This is a dependency-free alternative to \c RootStepWriter. Each selected
+ * step attribute (plus the track ID, which is always written) is a
+ * fixed-width column whose name matches the corresponding ROOT branch. Steps
+ * of active tracks are appended to a buffer owned by the executing stream:
+ * each attribute is copied as a block of raw bytes, with a single \c memcpy
+ * when every track slot is active. When a stream has buffered a chunk's worth
+ * of steps, its columns are byte-shuffled and run-length encoded on that
+ * stream's thread, and the chunk is appended to the file. An index of chunk
+ * offsets is written by \c finalize (or the destructor).
+ *
+ * Values are written in their native representation (e.g. IDs are unsigned
+ * integers with the maximum value marking "invalid") except for the particle
+ * type, which is written as a PDG number. The file is meant to be read by \c
+ * StepColumnReader on an architecture with the same endianness.
+ */
+class StepColumnWriter final : public StepInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticles = std::shared_ptr<ParticleParams const>;
+    //!@}
+
+  public:
+    // Open the file and write the column layout
+    StepColumnWriter(std::string const& filename,
+                     SPConstParticles particles,
+                     StepSelection selection);
+
+    // Write remaining steps and the index if not finalized
+    ~StepColumnWriter();
+
+    // Set the number of steps per chunk
+    void set_chunk_size(size_type num_steps);
+
+    // Write all buffered steps and the chunk index, and close the file
+    void finalize();
+
+    // Buffer step data and write full chunks
+    void execute(StateHostRef const& steps) final;
+
+    // Device execution is not implemented
+    void execute(StateDeviceRef const&) final
+    {
+        CELER_NOT_IMPLEMENTED("StepColumnWriter is host-only.");
+    }
+
+    //! Selection of data to be stored
+    StepSelection selection() const final { return selection_; }
+
+    //! No detector filtering selection is implemented
+    Filters filters() const final { return {}; }
+
+  private:
+    //// TYPES ////
+
+    using SpanConstThreadId = Span<ThreadId const>;
+    using AppendColumn = std::function<void(
+        StateHostRef const&, SpanConstThreadId, std::vector<char>*)>;
+
+    struct Column
+    {
+        detail::StepColumnInfo info;
+        AppendColumn append;
+    };
+
+    struct StreamBuffer
+    {
+        std::vector<ThreadId> rows;
+        std::vector<std::vector<char>> columns;
+        std::vector<char> encoded;
+        size_type num_rows{0};
+    };
+
+    //// DATA ////
+
+    SPConstParticles particles_;
+    StepSelection selection_;
+    std::vector<Column> columns_;
+    size_type chunk_size_{65536};
+
+    std::mutex mutex_;
+    std::map<StreamId::size_type, std::unique_ptr<StreamBuffer>> streams_;
+    std::ofstream os_;
+    BinaryOutArchive ar_;
+    std::vector<std::uint64_t> chunk_offsets_;
+    std::vector<std::uint64_t> chunk_rows_;
+
+    //// HELPER FUNCTIONS ////
+
+    template<class F>
+    void add_column(char const* name, F&& get);
+    StreamBuffer& get_stream(StreamId sid);
+    void write_chunk(StreamBuffer* buffer);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
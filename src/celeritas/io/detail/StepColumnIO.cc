@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/detail/StepColumnIO.cc
+//---------------------------------------------------------------------------//
+#include "StepColumnIO.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Repeated bytes are encoded as a control byte >= 128 and the byte value
+constexpr std::size_t min_run = 3;
+constexpr std::size_t max_run = 255 - 128 + min_run;
+// Other bytes are encoded as a control byte < 128 and up to 128 literals
+constexpr std::size_t max_literal = 128;
+
+//---------------------------------------------------------------------------//
+//! Whether a run of repeated bytes starts at the given position
+bool is_run(unsigned char const* data, std::size_t i, std::size_t size)
+{
+    return i + min_run <= size && data[i] == data[i + 1]
+           && data[i] == data[i + 2];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shuffle the bytes of fixed-size scalars and run-length encode them.
+ *
+ * Grouping the bytes by significance (as in the HDF5 "shuffle" filter) turns
+ * the mostly-constant high bytes of IDs, counters, and floating point
+ * exponents into long runs, which are then compressed with a PackBits-like
+ * run-length encoding. The result is appended to the destination.
+ */
+void encode_shuffle_rle(Span<char const> src,
+                        size_type scalar_size,
+                        std::vector<char>* dst)
+{
+    CELER_EXPECT(scalar_size > 0 && src.size() % scalar_size == 0);
+    CELER_EXPECT(dst);
+
+    // Shuffle bytes so that byte b of every scalar is contiguous
+    std::size_t const num_values = src.size() / scalar_size;
+    std::vector<unsigned char> shuffled(src.size());
+    for (std::size_t b = 0; b < scalar_size; ++b)
+    {
+        unsigned char* out = shuffled.data() + b * num_values;
+        char const* in = src.data() + b;
+        for (std::size_t i = 0; i < num_values; ++i)
+        {
+            out[i] = static_cast<unsigned char>(in[i * scalar_size]);
+        }
+    }
+
+    // Run-length encode
+    unsigned char const* data = shuffled.data();
+    std::size_t const size = shuffled.size();
+    std::size_t i = 0;
+    while (i < size)
+    {
+        if (is_run(data, i, size))
+        {
+            std::size_t run = min_run;
+            while (i + run < size && run < max_run && data[i + run] == data[i])
+            {
+                ++run;
+            }
+            dst->push_back(static_cast<char>(128 + run - min_run));
+            dst->push_back(static_cast<char>(data[i]));
+            i += run;
+            continue;
+        }
+
+        std::size_t start = i++;
+        while (i < size && i - start < max_literal && !is_run(data, i, size))
+        {
+            ++i;
+        }
+        dst->push_back(static_cast<char>(i - start - 1));
+        dst->insert(dst->end(), data + start, data + i);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Decode and unshuffle data into a buffer of the original size.
+ */
+void decode_shuffle_rle(Span<char const> src,
+                        size_type scalar_size,
+                        Span<char> dst)
+{
+    CELER_EXPECT(scalar_size > 0 && dst.size() % scalar_size == 0);
+
+    // Run-length decode
+    std::vector<unsigned char> shuffled(dst.size());
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < src.size();)
+    {
+        std::size_t control = static_cast<unsigned char>(src[i++]);
+        if (control >= 128)
+        {
+            std::size_t run = control - 128 + min_run;
+            CELER_VALIDATE(i < src.size() && out + run <= shuffled.size(),
+                           << "corrupt run-length encoded step column");
+            std::fill_n(shuffled.data() + out,
+                        run,
+                        static_cast<unsigned char>(src[i++]));
+            out += run;
+        }
+        else
+        {
+            std::size_t count = control + 1;
+            CELER_VALIDATE(i + count <= src.size()
+                               && out + count <= shuffled.size(),
+                           << "corrupt run-length encoded step column");
+            std::memcpy(shuffled.data() + out, src.data() + i, count);
+            i += count;
+            out += count;
+        }
+    }
+    CELER_VALIDATE(out == shuffled.size(),
+                   << "run-length encoded step column has " << out
+                   << " bytes but expected " << shuffled.size());
+
+    // Unshuffle
+    std::size_t const num_values = dst.size() / scalar_size;
+    for (std::size_t b = 0; b < scalar_size; ++b)
+    {
+        unsigned char const* in = shuffled.data() + b * num_values;
+        char* dst_b = dst.data() + b;
+        for (std::size_t i = 0; i < num_values; ++i)
+        {
+            dst_b[i * scalar_size] = static_cast<char>(in[i]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
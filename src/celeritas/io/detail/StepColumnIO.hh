@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/detail/StepColumnIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Step column file identifier ("CLRSTEPS")
+constexpr std::uint64_t step_column_magic = 0x5350455453524c43ull;
+//! Increment when the file layout changes
+constexpr std::uint32_t step_column_version = 1;
+
+//---------------------------------------------------------------------------//
+//! Encoding of a single column in a chunk
+enum class ColumnCodec : std::uint32_t
+{
+    raw,  //!< Native-endian values
+    shuffle_rle,  //!< Byte-shuffled and run-length encoded
+    size_
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Name and fixed-width layout of a step column.
+ *
+ * The type is 'u' (unsigned integer), 'i' (signed integer), or 'f' (floating
+ * point). Each row has \c components values of \c scalar_size bytes.
+ */
+struct StepColumnInfo
+{
+    std::string name;
+    char type{};
+    size_type scalar_size{};
+    size_type components{1};
+
+    //! Number of bytes per row
+    size_type width() const { return scalar_size * components; }
+};
+
+//---------------------------------------------------------------------------//
+// Shuffle the bytes of fixed-size scalars and run-length encode them
+void encode_shuffle_rle(Span<char const> src,
+                        size_type scalar_size,
+                        std::vector<char>* dst);
+
+// Decode and unshuffle data into a buffer of the original size
+void decode_shuffle_rle(Span<char const> src,
+                        size_type scalar_size,
+                        Span<char> dst);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -225,6 +225,7 @@ struct PhysicsParamsScalars
     Energy eloss_calc_limit{};  //!< Lowest energy for eloss calculation
     real_type linear_loss_limit{};  //!< For scaled range calculation
     real_type fixed_step_limiter{};  //!< Global charged step size limit [cm]
+                                     //!< (inf if only limited by region)
 
     real_type secondary_stack_factor = 3;  //!< Secondary storage per state
                                            //!< size
@@ -235,7 +236,7 @@ struct PhysicsParamsScalars
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return max_particle_processes > 0 && model_to_action >= 4
+        return max_particle_processes > 0 && model_to_action >= 5
                && num_models > 0 && min_range > 0 && max_step_over_range > 0
                && min_eprime_over_e > 0 && eloss_calc_limit > zero_quantity()
                && linear_loss_limit > 0 && secondary_stack_factor > 0
@@ -243,6 +244,12 @@ struct PhysicsParamsScalars
                    == static_cast<bool>(fixed_step_action));
     }
 
+    //! Set up the beginning of a physics step
+    CELER_FORCEINLINE_FUNCTION ActionId pre_step_action() const
+    {
+        return ActionId{model_to_action - 5};
+    }
+
     //! Stop early due to MSC limitation
     CELER_FORCEINLINE_FUNCTION ActionId msc_action() const
     {
@@ -301,6 +308,8 @@ struct PhysicsParamsData
     using ParticleItems = Collection<T, W, M, ParticleId>;
     template<class T>
     using ParticleModelItems = Collection<T, W, M, ParticleModelId>;
+    template<class T>
+    using RegionItems = Collection<T, W, M, RegionId>;
 
     //// DATA ////
 
@@ -317,6 +326,9 @@ struct PhysicsParamsData
     ParticleItems<ProcessGroup> process_groups;
     ParticleModelItems<ModelId> model_ids;
     ParticleModelItems<ModelXsTable> model_xs;
+    RegionItems<real_type> fixed_step_limiters;  //!< Optional [cm]
+    RegionItems<units::MevEnergy> tracking_cuts;  //!< Optional
+    RegionItems<char> range_rejection;  //!< Optional: kill contained tracks
 
     // Special data
     HardwiredModels<W, M> hardwired;
@@ -329,7 +341,8 @@ struct PhysicsParamsData
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !process_groups.empty() && !model_ids.empty() && scalars;
+        return !process_groups.empty() && !model_ids.empty() && scalars
+               && (fixed_step_limiters.empty() || scalars.fixed_step_action);
     }
 
     //! Assign from another set of data
@@ -350,6 +363,9 @@ struct PhysicsParamsData
         process_groups = other.process_groups;
         model_ids = other.model_ids;
         model_xs = other.model_xs;
+        fixed_step_limiters = other.fixed_step_limiters;
+        tracking_cuts = other.tracking_cuts;
+        range_rejection = other.range_rejection;
 
         hardwired = other.hardwired;
 
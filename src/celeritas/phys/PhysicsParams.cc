@@ -9,8 +9,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <set>
+#include <sstream>
 #include <tuple>
 #include <type_traits>
 
@@ -19,9 +21,14 @@
 #include "corecel/cont/Label.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionArchive.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
+#include "corecel/io/BinaryCache.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/MpiSharedBuffer.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/em/AtomicRelaxationParams.hh"  // IWYU pragma: keep
 #include "celeritas/em/data/AtomicRelaxationData.hh"
@@ -132,12 +139,50 @@ PhysicsParams::PhysicsParams(Input inp)
     // Construct data
     HostValue host_data;
     this->build_options(inp.options, &host_data);
-    this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
-    this->build_model_xs(*inp.materials, &host_data);
+    this->build_hardwired(&host_data);
+    std::uint64_t const cache_key = this->calc_cache_key(inp);
+    if (inp.shared_comm && celeritas::device())
+    {
+        CELER_LOG(warning) << "Ignoring request to share physics tables "
+                              "between processes: tables are stored on "
+                              "the device";
+    }
+    else if (inp.shared_comm)
+    {
+        // Load or build the tables on one process per node
+        shared_tables_ = std::make_shared<MpiSharedBuffer>(
+            *inp.shared_comm, [this, &inp, &host_data, cache_key] {
+                HostValue temp = host_data;
+                this->load_or_build_tables(
+                    inp, cache_key, /* map_tables = */ false, &temp);
+                std::ostringstream os;
+                BinaryOutArchive ar(&os);
+                this->archive_tables(ar, temp);
+                return os.str();
+            });
+        CELER_LOG_LOCAL(debug)
+            << "Sharing " << shared_tables_->data().size()
+            << " bytes of physics tables among "
+            << shared_tables_->num_sharing() << " processes";
+
+        // Copy the small mappings; the tables are referenced later
+        BinaryInArchive ar(shared_tables_->data());
+        this->unarchive_tables(ar, /* map_tables = */ true, &host_data);
+    }
+    if (!shared_tables_)
+    {
+        this->load_or_build_tables(
+            inp, cache_key, /* map_tables = */ !celeritas::device(), &host_data);
+    }
+    CELER_ASSERT(host_data);
 
     // Add step limiter if being used (TODO: remove this hack from physics)
-    if (inp.options.fixed_step_limiter > 0)
+    auto const& region_limits = inp.options.region_step_limiters;
+    bool const has_region_limits
+        = std::any_of(region_limits.begin(),
+                      region_limits.end(),
+                      [](real_type limit) { return limit > 0; });
+    if (inp.options.fixed_step_limiter > 0 || has_region_limits)
     {
         using std::make_shared;
         auto& action_reg = *inp.action_registry;
@@ -147,14 +192,37 @@ PhysicsParams::PhysicsParams(Input inp)
             "physics-fixed-step",
             "fixed step limiter for charged particles");
         inp.action_registry->insert(fixed_step_action);
-        host_data.scalars.fixed_step_limiter = inp.options.fixed_step_limiter;
+        // Without a global limit, only regions with a limit are restricted
+        host_data.scalars.fixed_step_limiter
+            = inp.options.fixed_step_limiter > 0
+                  ? inp.options.fixed_step_limiter
+                  : std::numeric_limits<real_type>::infinity();
         host_data.scalars.fixed_step_action = fixed_step_action->action_id();
         fixed_step_action_ = std::move(fixed_step_action);
+        if (has_region_limits)
+        {
+            make_builder(&host_data.fixed_step_limiters)
+                .insert_back(region_limits.begin(), region_limits.end());
+        }
     }
 
     // Copy data to device
     data_ = CollectionMirror<PhysicsParamsData>{std::move(host_data)};
+    host_ref_ = data_.host_ref();
+    if (shared_tables_)
+    {
+        BinaryInArchive ar(shared_tables_->data());
+        this->reference_tables(ar);
+    }
+    else if (cached_tables_)
+    {
+        auto& ar = cached_tables_->archive();
+        ar.seek(cached_tables_offset_);
+        this->reference_tables(ar);
+    }
 
+    CELER_ENSURE(pre_step_action_->action_id()
+                 == host_ref().scalars.pre_step_action());
     CELER_ENSURE(range_action_->action_id()
                  == host_ref().scalars.range_action());
     CELER_ENSURE(discrete_action_->action_id()
@@ -235,6 +303,42 @@ void PhysicsParams::build_options(Options const& opts, HostValue* data) const
     data->scalars.eloss_calc_limit = opts.eloss_calc_limit;
     data->scalars.linear_loss_limit = opts.linear_loss_limit;
     data->scalars.secondary_stack_factor = opts.secondary_stack_factor;
+
+    for (real_type limit : opts.region_step_limiters)
+    {
+        CELER_VALIDATE(limit >= 0,
+                       << "invalid region step limiter=" << limit
+                       << " (should be nonnegative)");
+    }
+
+    for (Options::Energy cut : opts.region_tracking_cuts)
+    {
+        CELER_VALIDATE(cut >= zero_quantity(),
+                       << "invalid region tracking cut=" << cut.value()
+                       << " (should be nonnegative)");
+    }
+    if (!opts.region_tracking_cuts.empty())
+    {
+        make_builder(&data->tracking_cuts)
+            .insert_back(opts.region_tracking_cuts.begin(),
+                         opts.region_tracking_cuts.end());
+    }
+
+    if (!opts.range_rejection_regions.empty())
+    {
+        std::vector<char> range_rejection;
+        for (RegionId region : opts.range_rejection_regions)
+        {
+            CELER_VALIDATE(region, << "invalid range rejection region");
+            if (region.get() >= range_rejection.size())
+            {
+                range_rejection.resize(region.get() + 1, false);
+            }
+            range_rejection[region.get()] = true;
+        }
+        make_builder(&data->range_rejection)
+            .insert_back(range_rejection.begin(), range_rejection.end());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -365,8 +469,16 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
     }
     data->scalars.max_particle_processes = max_particle_processes;
     data->scalars.num_models = this->num_models();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Assign hardwired models that do on-the-fly xs calculation.
+ */
+void PhysicsParams::build_hardwired(HostValue* data) const
+{
+    CELER_EXPECT(data);
 
-    // Assign hardwired models that do on-the-fly xs calculation
     for (auto model_idx : range(this->num_models()))
     {
         Model const& model = *models_[model_idx].first;
@@ -392,8 +504,6 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
         // host/device reference
         data->hardwired.relaxation_data = relaxation_->host_ref();
     }
-
-    CELER_ENSURE(*data);
 }
 
 //---------------------------------------------------------------------------//
@@ -724,5 +834,225 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the external cache key with the physics configuration.
+ *
+ * This accounts for the processes, models, and action IDs, as well as the
+ * options that affect the constructed tables. Changes to the external data
+ * used to build the processes must be reflected in \c Input::cache_key .
+ */
+std::uint64_t PhysicsParams::calc_cache_key(Input const& inp) const
+{
+    // Increment when the layout of the cached data changes
+    constexpr int cache_layout_version = 2;
+
+    std::size_t result = hash_combine(inp.cache_key,
+                                      cache_layout_version,
+                                      inp.particles->size(),
+                                      inp.materials->size(),
+                                      inp.options.min_range,
+                                      inp.options.max_step_over_range,
+                                      inp.options.min_eprime_over_e,
+                                      inp.options.linear_loss_limit,
+                                      inp.options.disable_integral_xs);
+    for (auto const& process : processes_)
+    {
+        result = hash_combine(result, process->label());
+    }
+    for (auto const& model_process : models_)
+    {
+        Model const& model = *model_process.first;
+        result = hash_combine(result,
+                              model.label(),
+                              model.action_id().get(),
+                              model_process.second.get());
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load cross section tables and model mappings from the cache or build them.
+ *
+ * If the tables are built and a cache file is requested, it is written.
+ */
+void PhysicsParams::load_or_build_tables(Input const& inp,
+                                         std::uint64_t key,
+                                         bool map_tables,
+                                         HostValue* data)
+{
+    if (!inp.cache_filename.empty()
+        && this->load_cache(inp.cache_filename, key, map_tables, data))
+    {
+        return;
+    }
+
+    this->build_ids(*inp.particles, data);
+    this->build_xs(inp.options, *inp.materials, data);
+    this->build_model_xs(*inp.materials, data);
+    if (!inp.cache_filename.empty())
+    {
+        this->save_cache(inp.cache_filename, key, *data);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load cross section tables and model mappings from a cache file.
+ *
+ * If \c map_tables is true, the cross section tables are not copied: the
+ * cache file stays mapped, and \c host_ref_ must be updated to reference it
+ * after the rest of the data is constructed.
+ *
+ * A cache file that is truncated or inconsistent with the current physics is
+ * ignored so that the tables are rebuilt.
+ *
+ * \return Whether a valid cache was found
+ */
+bool PhysicsParams::load_cache(std::string const& filename,
+                               std::uint64_t key,
+                               bool map_tables,
+                               HostValue* data)
+{
+    CELER_EXPECT(data);
+
+    auto read_cache = std::make_shared<BinaryCacheReader>(filename, key);
+    if (!*read_cache)
+    {
+        return false;
+    }
+
+    // Load into a copy so that a failure leaves the options untouched
+    HostValue temp = *data;
+    std::size_t const tables_offset = read_cache->archive().offset();
+    try
+    {
+        this->unarchive_tables(read_cache->archive(), map_tables, &temp);
+    }
+    catch (RuntimeError const& e)
+    {
+        CELER_LOG(warning) << "Ignoring invalid physics cache file '"
+                           << filename << "': " << e.what();
+        return false;
+    }
+
+    *data = std::move(temp);
+    if (map_tables)
+    {
+        cached_tables_ = std::move(read_cache);
+        cached_tables_offset_ = tables_offset;
+    }
+    CELER_LOG(info) << "Loaded physics tables from '" << filename << "'";
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save cross section tables and model mappings to a cache file.
+ */
+void PhysicsParams::save_cache(std::string const& filename,
+                               std::uint64_t key,
+                               HostValue const& data) const
+{
+    BinaryCacheWriter write_cache(filename, key);
+    this->archive_tables(write_cache.archive(), data);
+    write_cache.finalize();
+    CELER_LOG(info) << "Saved physics tables to '" << filename << "'";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write cross section tables and model mappings.
+ *
+ * The cross section tables are written first and in the same order as \c
+ * reference_tables reads them.
+ */
+void PhysicsParams::archive_tables(BinaryOutArchive& ar,
+                                   HostValue const& data) const
+{
+    archive(ar, data.reals);
+    archive(ar, data.value_grids);
+    archive(ar, data.value_grid_ids);
+    archive(ar, data.value_tables);
+    archive(ar, data.value_table_ids);
+    archive(ar, data.pmodel_ids);
+    archive(ar, data.process_ids);
+    archive(ar, data.integral_xs);
+    archive(ar, data.model_groups);
+    archive(ar, data.process_groups);
+    archive(ar, data.model_ids);
+    archive(ar, data.model_xs);
+    ar(data.scalars.max_particle_processes);
+    ar(data.scalars.model_to_action);
+    ar(data.scalars.num_models);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read and validate cross section tables and model mappings.
+ *
+ * If \c map_tables is true, the cross section tables are skipped (but their
+ * sizes are validated) so that they can be referenced in place.
+ */
+void PhysicsParams::unarchive_tables(BinaryInArchive& ar,
+                                     bool map_tables,
+                                     HostValue* data) const
+{
+    CELER_EXPECT(data);
+
+    if (map_tables)
+    {
+        ar.read_span<real_type>();
+        ar.read_span<XsGridData>();
+        ar.read_span<ValueGridId>();
+        ar.read_span<ValueTable>();
+        ar.read_span<ValueTableId>();
+    }
+    else
+    {
+        unarchive(ar, &data->reals);
+        unarchive(ar, &data->value_grids);
+        unarchive(ar, &data->value_grid_ids);
+        unarchive(ar, &data->value_tables);
+        unarchive(ar, &data->value_table_ids);
+    }
+    unarchive(ar, &data->pmodel_ids);
+    unarchive(ar, &data->process_ids);
+    unarchive(ar, &data->integral_xs);
+    unarchive(ar, &data->model_groups);
+    unarchive(ar, &data->process_groups);
+    unarchive(ar, &data->model_ids);
+    unarchive(ar, &data->model_xs);
+    ar(&data->scalars.max_particle_processes);
+    ar(&data->scalars.model_to_action);
+    ar(&data->scalars.num_models);
+
+    auto const first_model_action = this->model(ModelId{0})->action_id();
+    CELER_VALIDATE(data->scalars.num_models == this->num_models()
+                       && data->scalars.model_to_action
+                              == first_model_action.get()
+                       && data->model_xs.size() == this->num_models()
+                       && ar.remaining() == 0,
+                   << "physics tables are inconsistent with the current "
+                      "processes");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reference cross section tables stored outside the host data.
+ *
+ * The archive must reference memory that outlives this object: a mapped
+ * cache file or a shared memory window.
+ */
+void PhysicsParams::reference_tables(BinaryInArchive& ar)
+{
+    unarchive(ar, &host_ref_.reals);
+    unarchive(ar, &host_ref_.value_grids);
+    unarchive(ar, &host_ref_.value_grid_ids);
+    unarchive(ar, &host_ref_.value_tables);
+    unarchive(ar, &host_ref_.value_table_ids);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -29,7 +32,12 @@ namespace celeritas
 {
 class ActionRegistry;
 class AtomicRelaxationParams;
+class BinaryCacheReader;
+class BinaryInArchive;
+class BinaryOutArchive;
 class MaterialParams;
+class MpiCommunicator;
+class MpiSharedBuffer;
 class ParticleParams;
 
 //---------------------------------------------------------------------------//
@@ -44,6 +52,17 @@ class ParticleParams;
  *   range.
  * - \c fixed_step_limiter: if nonzero, prevent any tracks from taking a step
  *   longer than this length.
+ * - \c region_step_limiters: optional fixed step limiter for each region
+ *   (indexed by \c RegionId ) that overrides the global value; a zero entry
+ *   uses \c fixed_step_limiter .
+ * - \c region_tracking_cuts: optional energy for each region (indexed by \c
+ *   RegionId ) below which charged particles are killed at the end of a step.
+ *   The larger of this and \c eloss_calc_limit is used. Production cuts, and
+ *   the energy loss and cross section tables built from them, are the same
+ *   in every region.
+ * - \c range_rejection_regions: regions in which a charged track whose
+ *   energy loss range is shorter than the distance to the nearest boundary
+ *   is killed and deposits its remaining energy locally.
  * - \c min_eprime_over_e: energy scaling fraction used to estimate the maximum
  *   cross section over the step in the integral approach for energy loss
  *   processes.
@@ -73,6 +92,8 @@ struct PhysicsParamsOptions
     real_type min_range = 1 * units::millimeter;
     real_type max_step_over_range = 0.2;
     real_type fixed_step_limiter = 0;
+    std::vector<real_type> region_step_limiters;
+    std::vector<RegionId> range_rejection_regions;
     //!@}
 
     //!@{
@@ -80,6 +101,7 @@ struct PhysicsParamsOptions
     real_type min_eprime_over_e = 0.8;
     real_type linear_loss_limit = 0.01;
     Energy eloss_calc_limit = Energy{0.001};
+    std::vector<Energy> region_tracking_cuts;
     //!@}
 
     real_type secondary_stack_factor = 3;
@@ -127,7 +149,24 @@ class PhysicsParams
     using DeviceRef = celeritas::DeviceCRef<PhysicsParamsData>;
     //!@}
 
-    //! Physics parameter construction arguments
+    /*!
+     * Physics parameter construction arguments.
+     *
+     * If \c cache_filename is given, the cross section tables are loaded from
+     * that file when it was written from the same processes, options, and
+     * \c cache_key (which should identify the external data, e.g. the
+     * imported Geant4 physics, used to construct the processes). Otherwise,
+     * or if the file is invalid, the tables are built and the cache file is
+     * written. For host-only runs the tables are used directly from the
+     * memory-mapped file.
+     *
+     * If \c shared_comm is given for a host-only run, only one process on
+     * each node loads or builds the tables, and the largest tables are
+     * stored in memory shared by the processes on the node rather than
+     * duplicated by each process. Construction is collective over the
+     * communicator, and the shared tables are released when MPI is
+     * finalized.
+     */
     struct Input
     {
         SPConstParticles particles;
@@ -137,6 +176,10 @@ class PhysicsParams
         ActionRegistry* action_registry = nullptr;
 
         Options options;
+
+        std::string cache_filename;  //!< Optional table cache
+        std::uint64_t cache_key{0};  //!< Hash of external inputs
+        MpiCommunicator const* shared_comm{nullptr};  //!< Optional sharing
     };
 
   public:
@@ -173,7 +216,7 @@ class PhysicsParams
     SpanConstProcessId processes(ParticleId) const;
 
     //! Access physics properties on the host
-    HostRef const& host_ref() const { return data_.host(); }
+    HostRef const& host_ref() const { return host_ref_; }
 
     //! Access physics properties on the device
     DeviceRef const& device_ref() const { return data_.device(); }
@@ -199,15 +242,37 @@ class PhysicsParams
 
     // Host/device storage and reference
     CollectionMirror<PhysicsParamsData> data_;
+    std::shared_ptr<MpiSharedBuffer const> shared_tables_;
+    std::shared_ptr<BinaryCacheReader> cached_tables_;
+    std::size_t cached_tables_offset_{0};
+    HostRef host_ref_;
 
   private:
     VecModel build_models(ActionRegistry*) const;
     void build_options(Options const& opts, HostValue* data) const;
     void build_ids(ParticleParams const& particles, HostValue* data) const;
+    void build_hardwired(HostValue* data) const;
     void build_xs(Options const& opts,
                   MaterialParams const& mats,
                   HostValue* data) const;
     void build_model_xs(MaterialParams const& mats, HostValue* data) const;
+    std::uint64_t calc_cache_key(Input const& inp) const;
+    void load_or_build_tables(Input const& inp,
+                              std::uint64_t key,
+                              bool map_tables,
+                              HostValue* data);
+    bool load_cache(std::string const& filename,
+                    std::uint64_t key,
+                    bool map_tables,
+                    HostValue* data);
+    void save_cache(std::string const& filename,
+                    std::uint64_t key,
+                    HostValue const& data) const;
+    void archive_tables(BinaryOutArchive& ar, HostValue const& data) const;
+    void unarchive_tables(BinaryInArchive& ar,
+                          bool map_tables,
+                          HostValue* data) const;
+    void reference_tables(BinaryInArchive& ar);
 };
 
 //---------------------------------------------------------------------------//
@@ -33,12 +33,15 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Calculate physics step limits based on cross sections and range limiters.
+ *
+ * The region of the track's current volume selects the fixed step limiter.
  */
 inline CELER_FUNCTION StepLimit
 calc_physics_step_limit(MaterialTrackView const& material,
                         ParticleTrackView const& particle,
                         PhysicsTrackView& physics,
-                        PhysicsStepView& pstep)
+                        PhysicsStepView& pstep,
+                        RegionId region = RegionId{0})
 {
     CELER_EXPECT(physics.has_interaction_mfp());
 
@@ -81,7 +84,16 @@ calc_physics_step_limit(MaterialTrackView const& material,
     limit.action = physics.scalars().discrete_action();
     if (!particle.is_stopped())
     {
-        limit.step = physics.interaction_mfp() / total_macro_xs;
+        if (total_macro_xs > 0)
+        {
+            limit.step = physics.interaction_mfp() / total_macro_xs;
+        }
+        else
+        {
+            // No discrete interactions for this particle
+            limit.step = numeric_limits<real_type>::infinity();
+            limit.action = {};
+        }
 
         if (auto ppid = physics.eloss_ppid())
         {
@@ -100,7 +112,7 @@ calc_physics_step_limit(MaterialTrackView const& material,
             }
 
             // Limit charged particle step size
-            real_type fixed_limit = physics.scalars().fixed_step_limiter;
+            real_type fixed_limit = physics.fixed_step_limiter(region);
             if (fixed_limit > 0 && fixed_limit < limit.step)
             {
                 limit.step = fixed_limit;
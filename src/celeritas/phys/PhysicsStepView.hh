@@ -87,6 +87,9 @@ class PhysicsStepView
     // Access secondaries created by an interaction
     inline CELER_FUNCTION Span<Secondary const> secondaries() const;
 
+    // Access secondaries for modification (e.g. population control)
+    inline CELER_FUNCTION Span<Secondary> secondaries();
+
     // Access scratch space for particle-process cross section calculations
     inline CELER_FUNCTION real_type& per_process_xs(ParticleProcessId);
     inline CELER_FUNCTION real_type per_process_xs(ParticleProcessId) const;
@@ -248,6 +251,15 @@ CELER_FUNCTION Span<Secondary const> PhysicsStepView::secondaries() const
     return this->state().secondaries;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access secondaries for modification (e.g. population control).
+ */
+CELER_FUNCTION Span<Secondary> PhysicsStepView::secondaries()
+{
+    return this->state().secondaries;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access scratch space for particle-process cross section calculations.
@@ -140,6 +140,15 @@ class PhysicsTrackView
     // Calculate scaled step range
     inline CELER_FUNCTION real_type range_to_step(real_type range) const;
 
+    // Fixed step limit for charged particles in a region
+    inline CELER_FUNCTION real_type fixed_step_limiter(RegionId region) const;
+
+    // Energy below which charged particles are killed in a region
+    inline CELER_FUNCTION Energy tracking_cut(RegionId region) const;
+
+    // Whether contained charged tracks are killed in a region
+    inline CELER_FUNCTION bool range_rejection(RegionId region) const;
+
     // Access scalar properties
     CELER_FORCEINLINE_FUNCTION PhysicsParamsScalars const& scalars() const;
 
@@ -631,6 +640,58 @@ CELER_FUNCTION real_type PhysicsTrackView::range_to_step(real_type range) const
     return step;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fixed step limit for charged particles in a region.
+ *
+ * A region-specific limit takes precedence over the global limit. A result of
+ * zero (or infinity, if only some regions are limited) means the step is not
+ * limited.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::fixed_step_limiter(RegionId region) const
+{
+    if (region < params_.fixed_step_limiters.size())
+    {
+        if (real_type limit = params_.fixed_step_limiters[region]; limit > 0)
+        {
+            return limit;
+        }
+    }
+    return params_.scalars.fixed_step_limiter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy below which charged particles are killed in a region.
+ *
+ * A region's tracking cut can only raise the global energy loss limit.
+ */
+CELER_FUNCTION auto PhysicsTrackView::tracking_cut(RegionId region) const
+    -> Energy
+{
+    Energy result = params_.scalars.eloss_calc_limit;
+    if (region < params_.tracking_cuts.size()
+        && params_.tracking_cuts[region] > result)
+    {
+        result = params_.tracking_cuts[region];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether contained charged tracks are killed in a region.
+ *
+ * A track whose energy loss range is shorter than the distance to the nearest
+ * boundary can be deposited locally without being transported.
+ */
+CELER_FUNCTION bool PhysicsTrackView::range_rejection(RegionId region) const
+{
+    return region < params_.range_rejection.size()
+           && params_.range_rejection[region];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access scalar properties (options, IDs).
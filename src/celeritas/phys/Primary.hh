@@ -27,6 +27,7 @@ struct Primary
     Real3 position{0, 0, 0};
     Real3 direction{0, 0, 0};
     real_type time{};
+    real_type weight{1};
     EventId event_id;
     TrackId track_id;
 };
@@ -45,6 +45,7 @@ discrete_select_track(celeritas::CoreTrackView const& track)
         // This kernel does not apply
         return;
     }
+    track.tally_action(phys.scalars().discrete_action());
 
     // Reset the MFP counter, to be resampled if the track survives the
     // interaction
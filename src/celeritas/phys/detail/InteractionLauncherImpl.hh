@@ -59,6 +59,7 @@ InteractionLauncherImpl<D, F>::operator()(ThreadId thread) const
     auto sim = track.make_sim_view();
     if (sim.step_limit().action != model_data.ids.action)
         return;
+    track.tally_action(model_data.ids.action);
 
     Interaction result = this->call_with_track(model_data, track);
 
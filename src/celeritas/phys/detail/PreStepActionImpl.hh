@@ -61,8 +61,16 @@ inline CELER_FUNCTION void pre_step_track(celeritas::CoreTrackView const& track)
         step.element({});
     }
 
+    if (sim.along_step_action())
+    {
+        // The replacement along-step action sets the step limit
+        sim.reset_step_limit();
+        return;
+    }
+
     // Sample mean free path
     auto phys = track.make_physics_view();
+    track.tally_action(phys.scalars().pre_step_action());
     if (!phys.has_interaction_mfp())
     {
         auto rng = track.make_rng_engine();
@@ -73,7 +81,8 @@ inline CELER_FUNCTION void pre_step_track(celeritas::CoreTrackView const& track)
     // Calculate physics step limits and total macro xs
     auto mat = track.make_material_view();
     auto particle = track.make_particle_view();
-    StepLimit limit = calc_physics_step_limit(mat, particle, phys, step);
+    StepLimit limit = calc_physics_step_limit(
+        mat, particle, phys, step, track.region_id());
     sim.reset_step_limit(limit);
 }
 
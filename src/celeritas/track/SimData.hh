@@ -32,9 +32,13 @@ struct SimTrackState
     EventId event_id;  //!< ID of originating event
     size_type num_steps{0};  //!< Total number of steps taken
     real_type time{0};  //!< Time elapsed in lab frame since start of event [s]
+    real_type weight{1};  //!< Statistical weight of the track
+    real_type importance{0};  //!< Region importance of the weight (0 if unset)
 
     TrackStatus status{TrackStatus::inactive};
     StepLimit step_limit;
+    ActionId along_step_action;  //!< Replacement along-step (null if default)
+    real_type field_substep{0};  //!< Field driver's next trial substep [len]
 };
 
 using SimTrackInitializer = SimTrackState;
@@ -44,6 +44,12 @@ class SimTrackView
     // Increment the total number of steps
     CELER_FORCEINLINE_FUNCTION void increment_num_steps();
 
+    // Set the statistical weight
+    inline CELER_FUNCTION void weight(real_type);
+
+    // Set the importance corresponding to the weight
+    inline CELER_FUNCTION void importance(real_type);
+
     // Set whether the track is alive
     inline CELER_FUNCTION void status(TrackStatus);
 
@@ -62,6 +68,9 @@ class SimTrackView
     // Limit the step by this distance and action
     inline CELER_FUNCTION bool step_limit(StepLimit const& sl);
 
+    // Transport the track with a replacement along-step action
+    inline CELER_FUNCTION void along_step_action(ActionId action);
+
     //// DYNAMIC PROPERTIES ////
 
     // Unique track identifier
@@ -79,12 +88,24 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event [s]
     CELER_FORCEINLINE_FUNCTION real_type time() const;
 
+    // Statistical weight of the track
+    CELER_FORCEINLINE_FUNCTION real_type weight() const;
+
+    // Importance of the region where the weight was last set
+    CELER_FORCEINLINE_FUNCTION real_type importance() const;
+
     // Whether the track is alive or inactive or dying
     CELER_FORCEINLINE_FUNCTION TrackStatus status() const;
 
     // Limiting step and action to take
     CELER_FORCEINLINE_FUNCTION StepLimit const& step_limit() const;
 
+    // Replacement along-step action, if any
+    CELER_FORCEINLINE_FUNCTION ActionId along_step_action() const;
+
+    // Trial substep length remembered by the field driver across steps
+    CELER_FORCEINLINE_FUNCTION real_type& field_substep();
+
   private:
     SimStateRef const& states_;
     const ThreadId thread_;
@@ -123,6 +144,26 @@ CELER_FUNCTION void SimTrackView::add_time(real_type delta)
     states_.state[thread_].time += delta;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Set the statistical weight.
+ */
+CELER_FUNCTION void SimTrackView::weight(real_type w)
+{
+    CELER_EXPECT(w > 0);
+    states_.state[thread_].weight = w;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the importance corresponding to the weight.
+ */
+CELER_FUNCTION void SimTrackView::importance(real_type imp)
+{
+    CELER_EXPECT(imp > 0);
+    states_.state[thread_].importance = imp;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Increment the total number of steps.
@@ -207,6 +248,20 @@ CELER_FUNCTION bool SimTrackView::step_limit(StepLimit const& sl)
     return is_limiting;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Transport the track with a replacement along-step action.
+ *
+ * The problem's along-step action skips the track for the rest of its life,
+ * and the given action is responsible for moving it and setting its step
+ * limit.
+ */
+CELER_FUNCTION void SimTrackView::along_step_action(ActionId action)
+{
+    CELER_EXPECT(action);
+    states_.state[thread_].along_step_action = action;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Set whether the track is active, dying, or inactive.
@@ -264,6 +319,30 @@ CELER_FUNCTION real_type SimTrackView::time() const
     return states_.state[thread_].time;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Statistical weight of the track.
+ *
+ * The weight is unity unless variance reduction has been applied to the track
+ * or one of its ancestors.
+ */
+CELER_FUNCTION real_type SimTrackView::weight() const
+{
+    return states_.state[thread_].weight;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Importance of the region where the weight was last set.
+ *
+ * This is zero if the problem has no importance map or the track has not yet
+ * been located.
+ */
+CELER_FUNCTION real_type SimTrackView::importance() const
+{
+    return states_.state[thread_].importance;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
@@ -282,5 +361,29 @@ CELER_FUNCTION StepLimit const& SimTrackView::step_limit() const
     return states_.state[thread_].step_limit;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Replacement along-step action, if any.
+ *
+ * This is null for a track transported by the problem's along-step action.
+ */
+CELER_FUNCTION ActionId SimTrackView::along_step_action() const
+{
+    return states_.state[thread_].along_step_action;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trial substep length remembered by the field driver across steps.
+ *
+ * This is zero for a newly initialized track, or if the track has not been
+ * propagated through a field. It's a mutable reference so that the field
+ * driver can update it after each accepted substep.
+ */
+CELER_FUNCTION real_type& SimTrackView::field_substep()
+{
+    return states_.state[thread_].field_substep;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -14,6 +14,7 @@
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "orange/Types.hh"
+#include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/phys/ParticleData.hh"
 #include "celeritas/phys/Primary.hh"
@@ -22,6 +23,27 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Russian roulette for low-energy secondaries produced in a region.
+ *
+ * Secondaries below the roulette energy survive with the given probability
+ * and have their weight increased accordingly. The default values disable
+ * the roulette.
+ */
+struct EnergyRoulette
+{
+    units::MevEnergy energy{0};  //!< Roulette secondaries below this energy
+    real_type survival_probability{1};  //!< Probability of surviving
+
+    //! Whether the options are valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return energy >= zero_quantity() && survival_probability > 0
+               && survival_probability <= 1;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Persistent data for track initialization.
@@ -36,6 +58,12 @@ struct TrackInitParamsData
     size_type capacity{0};  //!< Track initializer storage size
     size_type max_events{0};  //!< Maximum number of events that can be run
 
+    //! Optional importance of each region for geometry splitting
+    Collection<real_type, W, M, RegionId> importance;
+
+    //! Optional low-energy secondary roulette in each region
+    Collection<EnergyRoulette, W, M, RegionId> roulette;
+
     //// METHODS ////
 
     //! Whether the data are assigned
@@ -51,6 +79,8 @@ struct TrackInitParamsData
         CELER_EXPECT(other);
         capacity = other.capacity;
         max_events = other.max_events;
+        importance = other.importance;
+        roulette = other.roulette;
         return *this;
     }
 };
@@ -148,6 +178,8 @@ struct ResizableData
  * - \c track_counters stores the total number of particles that have been
  *   created per event.
  * - \c secondary_counts stores the number of secondaries created by each track
+ * - \c clone_counts stores the number of copies of each track created by
+ *   importance splitting
  */
 template<Ownership W, MemSpace M>
 struct TrackInitStateData
@@ -167,6 +199,7 @@ struct TrackInitStateData
     ResizableItems<size_type> vacancies;
     StateItems<ThreadId> parents;
     StateItems<size_type> secondary_counts;
+    StateItems<size_type> clone_counts;
     EventItems<TrackId::size_type> track_counters;
 
     size_type num_secondaries{};  //!< Number of secondaries produced in a step
@@ -177,7 +210,8 @@ struct TrackInitStateData
     explicit CELER_FUNCTION operator bool() const
     {
         return initializers && vacancies && !parents.empty()
-               && !secondary_counts.empty() && !track_counters.empty();
+               && !secondary_counts.empty() && !clone_counts.empty()
+               && !track_counters.empty();
     }
 
     //! Assign from another set of data
@@ -189,6 +223,7 @@ struct TrackInitStateData
         parents = other.parents;
         vacancies = other.vacancies;
         secondary_counts = other.secondary_counts;
+        clone_counts = other.clone_counts;
         track_counters = other.track_counters;
         num_secondaries = other.num_secondaries;
         return *this;
@@ -222,6 +257,7 @@ void resize(TrackInitStateData<Ownership::value, M>* data,
     resize(&data->initializers.storage, params.capacity);
     resize(&data->parents, size);
     resize(&data->secondary_counts, size);
+    resize(&data->clone_counts, size);
     resize(&data->track_counters, params.max_events);
 
     // Start with an empty vector of track initializers
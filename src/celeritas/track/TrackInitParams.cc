@@ -26,6 +26,33 @@ TrackInitParams::TrackInitParams(Input const& inp)
     HostVal<TrackInitParamsData> host_data;
     host_data.capacity = inp.capacity;
     host_data.max_events = inp.max_events;
+
+    if (!inp.region_importance.empty())
+    {
+        for (real_type importance : inp.region_importance)
+        {
+            CELER_VALIDATE(importance > 0,
+                           << "invalid region importance " << importance
+                           << " (should be positive)");
+        }
+        make_builder(&host_data.importance)
+            .insert_back(inp.region_importance.begin(),
+                         inp.region_importance.end());
+    }
+    if (!inp.region_roulette.empty())
+    {
+        for (EnergyRoulette const& roulette : inp.region_roulette)
+        {
+            CELER_VALIDATE(roulette,
+                           << "invalid secondary roulette (energy "
+                           << roulette.energy.value()
+                           << " MeV, survival probability "
+                           << roulette.survival_probability << ")");
+        }
+        make_builder(&host_data.roulette)
+            .insert_back(inp.region_roulette.begin(),
+                         inp.region_roulette.end());
+    }
     CELER_ASSERT(host_data);
     data_ = CollectionMirror<TrackInitParamsData>{std::move(host_data)};
 }
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
 #include "corecel/Types.hh"
 #include "corecel/data/CollectionMirror.hh"
 
@@ -32,6 +34,10 @@ class TrackInitParams
     {
         size_type capacity;  //!< Max number of initializers
         size_type max_events;  //!< Max number of events that can be run
+        //! Optional importance for splitting indexed by RegionId
+        std::vector<real_type> region_importance;
+        //! Optional low-energy secondary roulette indexed by RegionId
+        std::vector<EnergyRoulette> region_roulette;
     };
 
   public:
@@ -12,6 +12,7 @@
 #include "corecel/data/Copier.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/global/CoreTrackData.hh"
 
 #include "TrackInitData.hh"
@@ -73,6 +74,9 @@ inline void initialize_tracks(CoreRef<M>& core_data)
         = std::min(data.vacancies.size(), data.initializers.size());
     if (num_tracks > 0)
     {
+        ScopedTrace trace("track_init", "initialize_tracks");
+        trace.arg("num_tracks", num_tracks);
+
         // Launch a kernel to initialize tracks on device
         auto num_vacancies
             = min(data.vacancies.size(), data.initializers.size());
@@ -145,26 +149,38 @@ inline void extend_from_secondaries(CoreRef<M>& core_data)
     CELER_EXPECT(core_data);
 
     auto& data = core_data.states.init;
+    ScopedTrace trace("track_init", "extend_from_secondaries");
 
     // Resize the vector of vacancies to be equal to the number of tracks
     data.vacancies.resize(core_data.states.size());
 
-    // Launch a kernel to identify which track slots are still alive and count
-    // the number of surviving secondaries per track
-    generated::locate_alive(core_data);
+    {
+        // Launch a kernel to identify which track slots are still alive and
+        // count the number of surviving secondaries per track
+        ScopedTrace trace_phase("track_init", "locate_alive");
+        generated::locate_alive(core_data);
+    }
 
-    // Remove all elements in the vacancy vector that were flagged as active
-    // tracks, leaving the (sorted) indices of the empty slots
-    size_type num_vac = detail::remove_if_alive<M>(data.vacancies.data());
-    data.vacancies.resize(num_vac);
+    {
+        // Remove all elements in the vacancy vector that were flagged as
+        // active tracks, leaving the (sorted) indices of the empty slots
+        ScopedTrace trace_phase("track_init", "remove_if_alive");
+        size_type num_vac = detail::remove_if_alive<M>(data.vacancies.data());
+        data.vacancies.resize(num_vac);
+        trace.arg("num_vacancies", num_vac);
+    }
 
-    // The exclusive prefix sum of the number of secondaries produced by each
-    // track is used to get the start index in the vector of track initializers
-    // for each thread. Starting at that index, each thread creates track
-    // initializers from all surviving secondaries produced in its
-    // interaction.
-    data.num_secondaries = detail::exclusive_scan_counts<M>(
-        data.secondary_counts[AllItems<size_type, M>{}]);
+    {
+        // The exclusive prefix sum of the number of secondaries produced by
+        // each track is used to get the start index in the vector of track
+        // initializers for each thread. Starting at that index, each thread
+        // creates track initializers from all surviving secondaries produced
+        // in its interaction.
+        ScopedTrace trace_phase("track_init", "exclusive_scan_counts");
+        data.num_secondaries = detail::exclusive_scan_counts<M>(
+            data.secondary_counts[AllItems<size_type, M>{}]);
+        trace.arg("num_secondaries", data.num_secondaries);
+    }
 
     // TODO: if we don't have space for all the secondaries, we will need to
     // buffer the current track initializers to create room
@@ -177,6 +193,7 @@ inline void extend_from_secondaries(CoreRef<M>& core_data)
                    << data.num_secondaries + data.initializers.size() << ")");
 
     // Launch a kernel to create track initializers from secondaries
+    ScopedTrace trace_phase("track_init", "process_secondaries");
     data.initializers.resize(data.initializers.size() + data.num_secondaries);
     generated::process_secondaries(core_data);
 }
@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/BiasingUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/Secondary.hh"
+#include "celeritas/random/distribution/BernoulliDistribution.hh"
+
+#include "../TrackInitData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the importance of a region.
+ *
+ * Regions past the end of the importance map have unit importance.
+ */
+template<class T>
+CELER_FUNCTION real_type region_importance(T const& importance,
+                                           RegionId region)
+{
+    CELER_EXPECT(!importance.empty());
+    if (region < importance.size())
+    {
+        return importance[region];
+    }
+    return 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the importance of the track's region if it can be split or killed.
+ *
+ * Population control is applied at the end of the first step that leaves a
+ * track strictly inside a region whose importance differs from the track's.
+ * Copies of a track on a boundary could not be reliably initialized from its
+ * position, so tracks that stop on a boundary wait until their next step.
+ * The result is zero if no importance change should be applied.
+ */
+template<class T>
+CELER_FUNCTION real_type find_importance(T const& importance,
+                                         CoreTrackView const& track)
+{
+    if (importance.empty())
+    {
+        return 0;
+    }
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive || !(sim.importance() > 0))
+    {
+        return 0;
+    }
+    auto geo = track.make_geo_view();
+    if (geo.is_outside() || geo.is_on_boundary())
+    {
+        return 0;
+    }
+    real_type result = region_importance(importance, track.region_id());
+    if (result == sim.importance())
+    {
+        return 0;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the number of copies of a track for an importance ratio.
+ *
+ * The ratio is the new region's importance over the old one. A track moving
+ * to a less important region plays Russian roulette (zero or one copy), and a
+ * track moving to a more important region is split into the integer part of
+ * the ratio, plus one more copy with the probability of the remainder. Each
+ * copy has the original weight divided by the ratio so that the expected
+ * total weight is conserved.
+ */
+template<class Engine>
+CELER_FUNCTION size_type sample_num_copies(real_type ratio, Engine& rng)
+{
+    CELER_EXPECT(ratio > 0);
+    auto result = static_cast<size_type>(ratio);
+    real_type remainder = ratio - static_cast<real_type>(result);
+    if (remainder > 0 && BernoulliDistribution(remainder)(rng))
+    {
+        ++result;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the low-energy secondary roulette in the track's region.
+ *
+ * The result is null if secondaries in the region are not rouletted.
+ */
+template<class T>
+CELER_FUNCTION EnergyRoulette const*
+find_roulette(T const& roulette, CoreTrackView const& track)
+{
+    if (roulette.empty() || track.make_geo_view().is_outside())
+    {
+        return nullptr;
+    }
+    RegionId region = track.region_id();
+    if (!(region < roulette.size())
+        || roulette[region].survival_probability == 1)
+    {
+        return nullptr;
+    }
+    return &roulette[region];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the weight multiplier of a secondary that survived the roulette.
+ */
+inline CELER_FUNCTION real_type roulette_weight(EnergyRoulette const* roulette,
+                                                Secondary const& secondary)
+{
+    if (roulette && secondary.energy < roulette->energy)
+    {
+        return 1 / roulette->survival_probability;
+    }
+    return 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Play Russian roulette with a low-energy secondary.
+ *
+ * A secondary that loses the roulette is cleared so that it is ignored when
+ * counting and creating track initializers. The weight of a survivor is
+ * increased by \c roulette_weight when its initializer is created.
+ */
+template<class Engine>
+CELER_FUNCTION void
+play_roulette(EnergyRoulette const& roulette, Engine& rng, Secondary* secondary)
+{
+    CELER_EXPECT(secondary && *secondary);
+    if (secondary->energy < roulette.energy
+        && !BernoulliDistribution(roulette.survival_probability)(rng))
+    {
+        secondary->particle_id = {};
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
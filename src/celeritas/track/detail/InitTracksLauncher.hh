@@ -21,6 +21,7 @@
 #include "celeritas/track/TrackInitData.hh"
 
 #include "../SimTrackView.hh"
+#include "BiasingUtils.hh"
 #include "Utils.hh"
 
 #if !CELER_DEVICE_COMPILE
@@ -126,6 +127,14 @@ CELER_FUNCTION void InitTracksLauncher<M>::operator()(ThreadId tid) const
         GeoMaterialView geo_mat(params_.geo_mats);
         MaterialTrackView mat(params_.materials, states_.materials, vacancy);
         mat = {geo_mat.material_id(geo.volume_id())};
+
+        SimTrackView sim(states_.sim, vacancy);
+        if (!params_.init.importance.empty() && !(sim.importance() > 0))
+        {
+            // Primaries start with the importance of their region
+            sim.importance(region_importance(
+                params_.init.importance, geo_mat.region_id(geo.volume_id())));
+        }
     }
 
     // Initialize the physics state
@@ -16,6 +16,7 @@
 #include "celeritas/phys/Secondary.hh"
 
 #include "../SimTrackView.hh"
+#include "BiasingUtils.hh"
 #include "Utils.hh"
 
 namespace celeritas
@@ -30,6 +31,13 @@ namespace detail
  * secondaries created in each interaction. If the track was killed and
  * produced secondaries, the empty track slot is filled with the first
  * secondary.
+ *
+ * Secondaries below the roulette energy of the region they were produced in
+ * play Russian roulette before they are counted.
+ *
+ * If the problem has an importance map, a track that has moved into a region
+ * with a different importance plays roulette (and may be killed here) or is
+ * split; the extra copies are counted along with the secondaries.
  */
 template<MemSpace M>
 class LocateAliveLauncher
@@ -68,12 +76,26 @@ CELER_FUNCTION void LocateAliveLauncher<M>::operator()(ThreadId tid) const
     // Count the number of secondaries produced by each track
     size_type num_secondaries{0};
     SimTrackView sim(states_.sim, tid);
+    CoreTrackView const track(params_, states_, tid);
 
     if (sim.status() != TrackStatus::inactive)
     {
-        PhysicsStepView phys(params_.physics, states_.physics, tid);
-        for (auto const& secondary : phys.secondaries())
+        auto phys = track.make_physics_step_view();
+        Span<Secondary> secondaries = phys.secondaries();
+        EnergyRoulette const* roulette = nullptr;
+        if (!secondaries.empty())
+        {
+            roulette = find_roulette(params_.init.roulette, track);
+        }
+        for (auto& secondary : secondaries)
         {
+            if (roulette && secondary)
+            {
+                // Population control must happen before counting so that
+                // the number of track initializers is consistent
+                auto rng = track.make_rng_engine();
+                play_roulette(*roulette, rng, &secondary);
+            }
             if (secondary)
             {
                 ++num_secondaries;
@@ -81,6 +103,26 @@ CELER_FUNCTION void LocateAliveLauncher<M>::operator()(ThreadId tid) const
         }
     }
 
+    // Play roulette or split the track if its importance changed
+    size_type num_clones{0};
+    if (real_type importance = find_importance(params_.init.importance, track))
+    {
+        auto rng = track.make_rng_engine();
+        size_type num_copies
+            = sample_num_copies(importance / sim.importance(), rng);
+        if (num_copies == 0)
+        {
+            // Lost the roulette: the weight is carried by the survivors
+            sim.status(TrackStatus::killed);
+        }
+        else
+        {
+            num_clones = num_copies - 1;
+        }
+    }
+    states_.init.clone_counts[tid] = num_clones;
+    num_secondaries += num_clones;
+
     if (sim.status() == TrackStatus::alive)
     {
         // The track is alive: mark this track slot as occupied
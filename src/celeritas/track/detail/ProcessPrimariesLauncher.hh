@@ -72,6 +72,10 @@ CELER_FUNCTION void ProcessPrimariesLauncher<M>::operator()(ThreadId tid) const
     ti.sim.event_id = primary.event_id;
     ti.sim.num_steps = 0;
     ti.sim.time = primary.time;
+    ti.sim.weight = primary.weight;
+    ti.sim.importance = 0;
+    ti.sim.along_step_action = {};
+    ti.sim.field_substep = 0;
     ti.sim.status = TrackStatus::alive;
     ti.geo.pos = primary.position;
     ti.geo.dir = primary.direction;
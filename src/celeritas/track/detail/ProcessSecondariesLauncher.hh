@@ -25,6 +25,7 @@
 #include "celeritas/track/TrackInitData.hh"
 
 #include "../SimTrackView.hh"
+#include "BiasingUtils.hh"
 
 namespace celeritas
 {
@@ -33,6 +34,12 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Create track initializers from secondaries.
+ *
+ * Copies of a track split by importance biasing are also created here, after
+ * the parent's weight is reduced. Secondaries produced during the step keep
+ * the parent's weight and importance from before the split so that they are
+ * split or rouletted on their own first step. Low-energy secondaries that
+ * survived the energy roulette have their weight increased.
  */
 template<MemSpace M>
 class ProcessSecondariesLauncher
@@ -60,6 +67,11 @@ class ProcessSecondariesLauncher
   private:
     ParamsRef const& params_;
     StateRef const& states_;
+
+    // Store an initializer and its parent for the next step
+    inline CELER_FUNCTION void store_initializer(TrackInitializer const& ti,
+                                                 ThreadId parent,
+                                                 size_type* offset) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -85,12 +97,22 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
     // A new track was initialized from a secondary in the parent's track slot
     bool initialized = false;
 
-    // Save the parent ID since it will be overwritten if a secondary is
-    // initialized in this slot
+    // Save the parent ID, weight, and importance since they will be
+    // overwritten if a secondary is initialized in this slot
     const TrackId parent_id{sim.track_id()};
+    const real_type parent_weight{sim.weight()};
+    const real_type parent_importance{sim.importance()};
 
     PhysicsStepView phys(params_.physics, states_.physics, tid);
-    for (auto const& secondary : phys.secondaries())
+    Span<Secondary const> secondaries = phys.secondaries();
+    EnergyRoulette const* roulette = nullptr;
+    if (!secondaries.empty())
+    {
+        // Get the roulette before a secondary is initialized in this slot
+        roulette = find_roulette(params_.init.roulette,
+                                 CoreTrackView{params_, states_, tid});
+    }
+    for (auto const& secondary : secondaries)
     {
         if (secondary)
         {
@@ -114,6 +136,9 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
             ti.sim.event_id = sim.event_id();
             ti.sim.num_steps = 0;
             ti.sim.time = sim.time();
+            ti.sim.weight = parent_weight
+                            * roulette_weight(roulette, secondary);
+            ti.sim.importance = parent_importance;
             ti.sim.status = TrackStatus::alive;
             ti.geo.pos = geo.pos();
             ti.geo.dir = secondary.direction;
@@ -144,22 +169,55 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
             }
             else
             {
-                // Store the track initializer
-                CELER_ASSERT(offset > 0 && offset <= data.initializers.size());
-                data.initializers[ThreadId(data.initializers.size() - offset)]
-                    = ti;
-
-                // Store the thread ID of the secondary's parent if the
-                // secondary could be initialized in the next step
-                if (offset <= data.parents.size())
-                {
-                    data.parents[ThreadId(data.parents.size() - offset)] = tid;
-                }
-                --offset;
+                this->store_initializer(ti, tid, &offset);
             }
         }
     }
 
+    // Only a parent that survived in its slot is split or reweighted: a
+    // secondary initialized in place of a killed parent (including one that
+    // lost the roulette) keeps the parent's original weight and importance
+    // like its siblings
+    real_type importance{0};
+    if (!initialized)
+    {
+        importance = find_importance(params_.init.importance,
+                                     CoreTrackView{params_, states_, tid});
+    }
+    if (importance > 0)
+    {
+        // The surviving track and its copies share the weight
+        sim.weight(parent_weight * parent_importance / importance);
+        sim.importance(importance);
+
+        GeoTrackView geo(params_.geometry, states_.geometry, tid);
+        ParticleTrackView particle(params_.particles, states_.particles, tid);
+        for (size_type i = 0, num_clones = data.clone_counts[tid];
+             i < num_clones;
+             ++i)
+        {
+            CELER_ASSERT(sim.event_id() < data.track_counters.size());
+            TrackId::size_type track_id = atomic_add(
+                &data.track_counters[sim.event_id()], size_type{1});
+
+            // Copy the track's current state
+            TrackInitializer ti;
+            ti.sim.track_id = TrackId{track_id};
+            ti.sim.parent_id = parent_id;
+            ti.sim.event_id = sim.event_id();
+            ti.sim.num_steps = 0;
+            ti.sim.time = sim.time();
+            ti.sim.weight = sim.weight();
+            ti.sim.importance = sim.importance();
+            ti.sim.status = TrackStatus::alive;
+            ti.geo.pos = geo.pos();
+            ti.geo.dir = geo.dir();
+            ti.particle.particle_id = particle.particle_id();
+            ti.particle.energy = particle.energy();
+            this->store_initializer(ti, tid, &offset);
+        }
+    }
+
     if (!initialized && sim.status() == TrackStatus::killed)
     {
         // Track is no longer used as part of transport
@@ -168,6 +226,29 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
     CELER_ENSURE(sim.status() != TrackStatus::killed);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Store an initializer and its parent for the next step.
+ */
+template<MemSpace M>
+CELER_FUNCTION void
+ProcessSecondariesLauncher<M>::store_initializer(TrackInitializer const& ti,
+                                                 ThreadId parent,
+                                                 size_type* offset) const
+{
+    auto const& data = states_.init;
+    CELER_ASSERT(*offset > 0 && *offset <= data.initializers.size());
+    data.initializers[ThreadId(data.initializers.size() - *offset)] = ti;
+
+    // Store the thread ID of the secondary's parent if the secondary could be
+    // initialized in the next step
+    if (*offset <= data.parents.size())
+    {
+        data.parents[ThreadId(data.parents.size() - *offset)] = parent;
+    }
+    --*offset;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -10,6 +10,7 @@
 
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "corecel/Types.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/track/detail/InitTracksLauncher.hh" // IWYU pragma: associated
@@ -24,13 +25,17 @@ void init_tracks(
 {
     MultiExceptionHandler capture_exception;
     detail::InitTracksLauncher<MemSpace::host> launch(core_data, num_vacancies);
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < num_vacancies; ++i)
+    #pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{i}, "init_tracks"));
+        ScopedTrace trace("omp", "init_tracks");
+        #pragma omp for
+        for (ThreadId::size_type i = 0; i < num_vacancies; ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{i}, "init_tracks"));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
@@ -10,6 +10,7 @@
 
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "corecel/Types.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/track/detail/LocateAliveLauncher.hh" // IWYU pragma: associated
@@ -23,13 +24,17 @@ void locate_alive(
 {
     MultiExceptionHandler capture_exception;
     detail::LocateAliveLauncher<MemSpace::host> launch(core_data);
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < core_data.states.size(); ++i)
+    #pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{i}, "locate_alive"));
+        ScopedTrace trace("omp", "locate_alive");
+        #pragma omp for
+        for (ThreadId::size_type i = 0; i < core_data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{i}, "locate_alive"));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
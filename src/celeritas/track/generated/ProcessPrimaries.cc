@@ -10,6 +10,7 @@
 
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "corecel/Types.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/track/detail/ProcessPrimariesLauncher.hh" // IWYU pragma: associated
@@ -24,13 +25,17 @@ void process_primaries(
 {
     MultiExceptionHandler capture_exception;
     detail::ProcessPrimariesLauncher<MemSpace::host> launch(core_data, primaries);
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < primaries.size(); ++i)
+    #pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{i}, "process_primaries"));
+        ScopedTrace trace("omp", "process_primaries");
+        #pragma omp for
+        for (ThreadId::size_type i = 0; i < primaries.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{i}, "process_primaries"));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
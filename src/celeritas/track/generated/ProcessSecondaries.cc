@@ -10,6 +10,7 @@
 
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "corecel/Types.hh"
 #include "celeritas/global/KernelContextException.hh"
 #include "celeritas/track/detail/ProcessSecondariesLauncher.hh" // IWYU pragma: associated
@@ -23,13 +24,17 @@ void process_secondaries(
 {
     MultiExceptionHandler capture_exception;
     detail::ProcessSecondariesLauncher<MemSpace::host> launch(core_data);
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < core_data.states.size(); ++i)
+    #pragma omp parallel
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            launch(ThreadId{i}),
-            capture_exception,
-            KernelContextException(core_data, ThreadId{i}, "process_secondaries"));
+        ScopedTrace trace("omp", "process_secondaries");
+        #pragma omp for
+        for (ThreadId::size_type i = 0; i < core_data.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(core_data, ThreadId{i}, "process_secondaries"));
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 }
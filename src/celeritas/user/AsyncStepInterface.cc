@@ -0,0 +1,237 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/AsyncStepInterface.cc
+//---------------------------------------------------------------------------//
+#include "AsyncStepInterface.hh"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/io/Logger.hh"
+
+#include "StepData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Buffers and consumer thread.
+ *
+ * Each buffer index is either in the free list, being filled by a producer,
+ * in the queue, or being processed by the consumer; only the owner of an
+ * index accesses the corresponding buffer, so the mutex only guards the
+ * lists.
+ */
+struct AsyncStepInterface::Impl
+{
+    using StepStateStore = CollectionStateStore<StepStateData, MemSpace::host>;
+
+    std::vector<StepStateStore> buffers;
+    std::deque<size_type> free;
+    std::deque<size_type> queued;
+
+    std::mutex mutex;
+    std::condition_variable buffer_released;
+    std::condition_variable buffer_queued;
+    bool stopped{false};
+    std::exception_ptr error;
+
+    std::thread consumer;
+
+    // Execute the callback on queued buffers until stopped
+    void consume(StepInterface* callback);
+
+    // Rethrow and clear a pending consumer exception (caller holds lock)
+    void rethrow_error()
+    {
+        if (error)
+        {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the callback on queued buffers until stopped.
+ */
+void AsyncStepInterface::Impl::consume(StepInterface* callback)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        buffer_queued.wait(lock,
+                           [this] { return stopped || !queued.empty(); });
+        if (queued.empty())
+        {
+            // Stopped with no more buffers to process
+            return;
+        }
+        size_type index = queued.front();
+        queued.pop_front();
+        lock.unlock();
+
+        std::exception_ptr callback_error;
+        try
+        {
+            callback->execute(buffers[index].ref());
+        }
+        catch (...)
+        {
+            callback_error = std::current_exception();
+        }
+
+        lock.lock();
+        if (callback_error && !error)
+        {
+            error = std::move(callback_error);
+        }
+        free.push_back(index);
+        buffer_released.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with callback and number of buffers.
+ */
+AsyncStepInterface::AsyncStepInterface(SPStepInterface callback,
+                                       size_type num_buffers)
+    : callback_(std::move(callback)), impl_(std::make_unique<Impl>())
+{
+    CELER_EXPECT(callback_);
+    CELER_VALIDATE(num_buffers > 0,
+                   << "number of asynchronous step buffers must be positive");
+
+    impl_->buffers.resize(num_buffers);
+    for (auto i : range(num_buffers))
+    {
+        impl_->free.push_back(i);
+    }
+    impl_->consumer
+        = std::thread([impl = impl_.get(), callback = callback_.get()] {
+              impl->consume(callback);
+          });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process remaining buffers and stop the consumer thread.
+ */
+AsyncStepInterface::~AsyncStepInterface()
+{
+    {
+        std::lock_guard<std::mutex> scoped_lock(impl_->mutex);
+        impl_->stopped = true;
+    }
+    impl_->buffer_queued.notify_all();
+    impl_->consumer.join();
+
+    if (impl_->error)
+    {
+        try
+        {
+            std::rethrow_exception(impl_->error);
+        }
+        catch (std::exception const& e)
+        {
+            CELER_LOG(error) << "Unhandled exception while processing "
+                                "asynchronous step data: "
+                             << e.what();
+        }
+        catch (...)
+        {
+            CELER_LOG(error) << "Unhandled exception while processing "
+                                "asynchronous step data";
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy CPU-generated step data and queue it for processing.
+ */
+void AsyncStepInterface::execute(StateHostRef const& data)
+{
+    this->execute_impl(data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy device-generated step data and queue it for processing.
+ */
+void AsyncStepInterface::execute(StateDeviceRef const& data)
+{
+    this->execute_impl(data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait until all queued step data has been processed.
+ */
+void AsyncStepInterface::flush()
+{
+    std::unique_lock<std::mutex> lock(impl_->mutex);
+    impl_->buffer_released.wait(lock, [this] {
+        return impl_->free.size() == impl_->buffers.size();
+    });
+    impl_->rethrow_error();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy step data into a free buffer and hand it to the consumer.
+ */
+template<MemSpace M>
+void AsyncStepInterface::execute_impl(
+    StepStateData<Ownership::reference, M> const& data)
+{
+    CELER_EXPECT(data);
+
+    size_type index;
+    {
+        // Wait for a free buffer (backpressure)
+        std::unique_lock<std::mutex> lock(impl_->mutex);
+        impl_->buffer_released.wait(lock, [this] {
+            return !impl_->free.empty() || impl_->error;
+        });
+        impl_->rethrow_error();
+        index = impl_->free.front();
+        impl_->free.pop_front();
+    }
+
+    try
+    {
+        // Copy to the host buffer
+        impl_->buffers[index] = data;
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> scoped_lock(impl_->mutex);
+            impl_->free.push_back(index);
+        }
+        impl_->buffer_released.notify_all();
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> scoped_lock(impl_->mutex);
+        impl_->queued.push_back(index);
+    }
+    impl_->buffer_queued.notify_one();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/AsyncStepInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/Types.hh"
+
+#include "StepInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Process gathered step data on a background thread.
+ *
+ * This adapter copies the step data from each step iteration into one of
+ * several host buffers and returns immediately, so that transport can
+ * continue while a consumer thread executes the wrapped callback on the
+ * previously filled buffer. With two buffers this is classic double
+ * buffering. If the consumer falls behind and every buffer is full, \c
+ * execute blocks until one is released.
+ *
+ * The wrapped callback is always executed with host data from the single
+ * consumer thread, so it doesn't need to be thread safe (even if the
+ * collector is shared by multiple streams) and a host-only callback can be
+ * used with device states. It must not depend on thread-local data of the
+ * transporting thread (e.g., Geant4 sensitive detectors).
+ *
+ * An exception from the wrapped callback is rethrown by the next call to \c
+ * execute or \c flush. Call \c flush before using any results of the
+ * callback (e.g. at the end of an event or run); the destructor processes
+ * the remaining buffers.
+ */
+class AsyncStepInterface final : public StepInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPStepInterface = std::shared_ptr<StepInterface>;
+    //!@}
+
+  public:
+    // Construct with callback and number of buffers
+    AsyncStepInterface(SPStepInterface callback, size_type num_buffers);
+
+    // Process remaining buffers and stop the consumer thread
+    ~AsyncStepInterface();
+
+    //! Detector filtering required by the wrapped callback
+    Filters filters() const final { return callback_->filters(); }
+
+    //! Selection of data required by the wrapped callback
+    StepSelection selection() const final { return callback_->selection(); }
+
+    // Copy CPU-generated step data and queue it for processing
+    void execute(StateHostRef const&) final;
+
+    // Copy device-generated step data and queue it for processing
+    void execute(StateDeviceRef const&) final;
+
+    // Wait until all queued step data has been processed
+    void flush();
+
+  private:
+    struct Impl;
+
+    SPStepInterface callback_;
+    std::unique_ptr<Impl> impl_;
+
+    template<MemSpace M>
+    void execute_impl(StepStateData<Ownership::reference, M> const& data);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -65,6 +65,7 @@ struct DetectorStepOutput
     std::vector<TrackId> parent_id;
     std::vector<size_type> track_step_count;
     std::vector<real_type> step_length;
+    std::vector<real_type> weight;
     std::vector<ParticleId> particle;
     std::vector<Energy> energy_deposition;
 
@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/DiagnosticOutput.cc
+//---------------------------------------------------------------------------//
+#include "DiagnosticOutput.hh"
+
+#include <utility>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/io/JsonPimpl.hh"
+
+#include "EnergyDiagnostic.hh"
+#include "ParticleProcessDiagnostic.hh"
+#include "StepDiagnostic.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from diagnostic actions.
+ */
+DiagnosticOutput::DiagnosticOutput(Input inp) : input_(std::move(inp))
+{
+    CELER_EXPECT(input_.steps || input_.processes || input_.energy);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void DiagnosticOutput::output(JsonPimpl* j) const
+{
+#if CELERITAS_USE_JSON
+    auto obj = nlohmann::json::object();
+    if (input_.steps)
+    {
+        obj["steps"] = input_.steps->steps();
+    }
+    if (input_.processes)
+    {
+        obj["process"] = input_.processes->particle_processes();
+    }
+    if (input_.energy)
+    {
+        obj["edep"] = input_.energy->energy_deposition();
+    }
+    j->obj = std::move(obj);
+#else
+    (void)sizeof(j);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/DiagnosticOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/io/OutputInterface.hh"
+
+namespace celeritas
+{
+class EnergyDiagnostic;
+class ParticleProcessDiagnostic;
+class StepDiagnostic;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the tallies from the step diagnostic actions.
+ *
+ * Any of the diagnostics may be null. The tallies are summed over all
+ * streams (but not over MPI processes) when the output is written, so this
+ * should only be written at the end of the run.
+ */
+class DiagnosticOutput final : public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstEnergy = std::shared_ptr<EnergyDiagnostic const>;
+    using SPConstProcess = std::shared_ptr<ParticleProcessDiagnostic const>;
+    using SPConstStep = std::shared_ptr<StepDiagnostic const>;
+    //!@}
+
+    struct Input
+    {
+        SPConstStep steps;
+        SPConstProcess processes;
+        SPConstEnergy energy;
+    };
+
+  public:
+    // Construct from diagnostic actions
+    explicit DiagnosticOutput(Input inp);
+
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+
+    //! Name of the entry inside the category.
+    std::string label() const final { return "diagnostics"; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    Input input_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/EnergyDiagnostic.cc
+//---------------------------------------------------------------------------//
+#include "EnergyDiagnostic.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "detail/EnergyDiagnosticLauncher.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with grid bounds and axis.
+ */
+EnergyDiagnostic::EnergyDiagnostic(ActionId id,
+                                   VecReal const& bounds,
+                                   Axis axis,
+                                   size_type num_streams)
+    : id_(id)
+{
+    CELER_EXPECT(id_);
+    CELER_EXPECT(num_streams > 0);
+    CELER_VALIDATE(axis != Axis::size_,
+                   << "invalid axis for energy deposition diagnostic");
+    CELER_VALIDATE(bounds.size() >= 2
+                       && std::is_sorted(bounds.begin(), bounds.end()),
+                   << "energy deposition grid must have at least two "
+                      "monotonically increasing bounds");
+
+    HostVal<EnergyDiagnosticParamsData> host_data;
+    make_builder(&host_data.bounds).insert_back(bounds.begin(), bounds.end());
+    host_data.axis = axis;
+    CELER_ASSERT(host_data);
+    data_ = CollectionMirror<EnergyDiagnosticParamsData>{std::move(host_data)};
+
+    tallies_ = std::make_unique<detail::TallyStorage<real_type>>(
+        bounds.size() - 1, num_streams);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally energy deposition with host data.
+ */
+void EnergyDiagnostic::execute(CoreHostRef const& core) const
+{
+    auto make_launcher = [&core, this](Span<real_type> tallies) {
+        return detail::EnergyDiagnosticLauncher{
+            core, this->host_ref(), {tallies}};
+    };
+    detail::launch_tally(
+        core, tallies_.get(), make_launcher, "energy-diagnostic");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the weighted energy deposition [MeV] in each bin.
+ *
+ * If a communicator is given, the tallies are summed over all processes.
+ */
+auto EnergyDiagnostic::energy_deposition(MpiCommunicator const& comm) const
+    -> VecReal
+{
+    return tallies_->totals(comm);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void EnergyDiagnostic::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,58 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/EnergyDiagnostic.cu
+//---------------------------------------------------------------------------//
+#include "EnergyDiagnostic.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+#include "detail/EnergyDiagnosticLauncher.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+
+__global__ void
+energy_diagnostic_kernel(CoreDeviceRef const data,
+                         DeviceCRef<EnergyDiagnosticParamsData> const params,
+                         Span<real_type> const tallies)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    detail::EnergyDiagnosticLauncher launch{data, params, {tallies}};
+    launch(tid);
+}
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally energy deposition on device.
+ */
+void EnergyDiagnostic::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    auto& tallies = tallies_->device(data.states.stream_id);
+    CELER_LAUNCH_KERNEL(energy_diagnostic,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        this->device_ref(),
+                        tallies[AllItems<real_type, MemSpace::device>{}]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/EnergyDiagnostic.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "orange/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "EnergyDiagnosticData.hh"
+#include "detail/TallyStorage.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tally weighted energy deposition along a grid on one axis.
+ *
+ * Energy deposited during the step is binned by the midpoint of the step.
+ * Deposition outside the grid is ignored. Tallies are accumulated per OpenMP
+ * thread on host and atomically on device.
+ */
+class EnergyDiagnostic final : public ExplicitActionInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecReal = std::vector<real_type>;
+    //!@}
+
+  public:
+    // Construct with grid bounds and axis
+    EnergyDiagnostic(ActionId id,
+                     VecReal const& bounds,
+                     Axis axis,
+                     size_type num_streams);
+
+    // Tally energy deposition with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Tally energy deposition with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the action
+    std::string label() const final { return "energy-diagnostic"; }
+
+    //! Description of the action for user interaction
+    std::string description() const final
+    {
+        return "binned energy deposition diagnostic";
+    }
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    // Get the weighted energy deposition [MeV] in each bin
+    VecReal energy_deposition(MpiCommunicator const& comm = {}) const;
+
+    //! Access data on the host
+    HostCRef<EnergyDiagnosticParamsData> const& host_ref() const
+    {
+        return data_.host();
+    }
+
+    //! Access data on the device
+    DeviceCRef<EnergyDiagnosticParamsData> const& device_ref() const
+    {
+        return data_.device();
+    }
+
+  private:
+    ActionId id_;
+    CollectionMirror<EnergyDiagnosticParamsData> data_;
+    std::unique_ptr<detail::TallyStorage<real_type>> tallies_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
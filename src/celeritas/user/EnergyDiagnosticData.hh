@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/EnergyDiagnosticData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "orange/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Grid for binning energy deposition along an axis.
+ */
+template<Ownership W, MemSpace M>
+struct EnergyDiagnosticParamsData
+{
+    //// DATA ////
+
+    Collection<real_type, W, M> bounds;  //!< Bin edges
+    Axis axis{Axis::size_};
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return bounds.size() >= 2 && axis != Axis::size_;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    EnergyDiagnosticParamsData&
+    operator=(EnergyDiagnosticParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        bounds = other.bounds;
+        axis = other.axis;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
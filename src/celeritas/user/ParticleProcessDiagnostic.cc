@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/ParticleProcessDiagnostic.cc
+//---------------------------------------------------------------------------//
+#include "ParticleProcessDiagnostic.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+#include "celeritas/phys/Process.hh"
+
+#include "detail/ParticleProcessLauncher.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared problem data.
+ */
+ParticleProcessDiagnostic::ParticleProcessDiagnostic(ActionId id,
+                                                     SPConstParticle particle,
+                                                     SPConstPhysics physics,
+                                                     size_type num_streams)
+    : id_(id), particle_(std::move(particle)), physics_(std::move(physics))
+{
+    CELER_EXPECT(id_);
+    CELER_EXPECT(particle_);
+    CELER_EXPECT(physics_);
+    CELER_EXPECT(num_streams > 0);
+
+    tallies_ = std::make_unique<detail::TallyStorage<size_type>>(
+        particle_->size() * physics_->num_models(), num_streams);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally interactions with host data.
+ */
+void ParticleProcessDiagnostic::execute(CoreHostRef const& core) const
+{
+    auto make_launcher = [&core](Span<size_type> tallies) {
+        return detail::ParticleProcessLauncher{core, {tallies}};
+    };
+    detail::launch_tally(
+        core, tallies_.get(), make_launcher, "process-diagnostic");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of interactions for each process and particle type.
+ *
+ * The keys are the process label followed by the particle name. Models of
+ * the same process are combined. If a communicator is given, the tallies are
+ * summed over all processes.
+ */
+auto ParticleProcessDiagnostic::particle_processes(
+    MpiCommunicator const& comm) const -> MapStringCount
+{
+    auto counts = tallies_->totals(comm);
+
+    MapStringCount result;
+    for (auto model_id : range(ModelId{physics_->num_models()}))
+    {
+        Process const& process
+            = *physics_->process(physics_->process_id(model_id));
+        for (auto particle_id : range(ParticleId{particle_->size()}))
+        {
+            size_type index = model_id.get() * particle_->size()
+                              + particle_id.get();
+            CELER_ASSERT(index < counts.size());
+            if (size_type count = counts[index])
+            {
+                result[process.label() + " "
+                       + particle_->id_to_label(particle_id)]
+                    += count;
+            }
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void ParticleProcessDiagnostic::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -1,54 +1,55 @@
 //---------------------------------*-CUDA-*----------------------------------//
-// Copyright 2021-2023 UT-Battelle, LLC, and other Celeritas developers.
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: (Apache-2.0 OR MIT)
 //---------------------------------------------------------------------------//
-//! \file demo-loop/diagnostic/ParticleProcessDiagnostic.cu
+//! \file celeritas/user/ParticleProcessDiagnostic.cu
 //---------------------------------------------------------------------------//
 #include "ParticleProcessDiagnostic.hh"
 
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 
-using namespace celeritas;
+#include "detail/ParticleProcessLauncher.hh"
 
-namespace demo_loop
+namespace celeritas
+{
+namespace
 {
 //---------------------------------------------------------------------------//
 // KERNELS
 //---------------------------------------------------------------------------//
-/*!
- * Tally the particle/process combinations that occur at each step.
- */
-__global__ void count_particle_process_kernel(
-    CoreParamsDeviceRef const params,
-    CoreStateDeviceRef const states,
-    ParticleProcessLauncher<MemSpace::device>::ItemsRef counts)
+
+__global__ void process_diagnostic_kernel(CoreDeviceRef const data,
+                                          Span<size_type> const tallies)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < data.states.size()))
         return;
 
-    ParticleProcessLauncher<MemSpace::device> launch(params, states, counts);
+    detail::ParticleProcessLauncher launch{data, {tallies}};
     launch(tid);
 }
-
 //---------------------------------------------------------------------------//
-// KERNEL INTERFACES
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
- * Launch kernel to tally the particle/process combinations.
+ * Tally interactions on device.
  */
-void count_particle_process(
-    CoreParamsDeviceRef const& params,
-    CoreStateDeviceRef const& states,
-    ParticleProcessLauncher<MemSpace::device>::ItemsRef counts)
+void ParticleProcessDiagnostic::execute(CoreDeviceRef const& data) const
 {
-    CELER_LAUNCH_KERNEL(count_particle_process,
+    CELER_EXPECT(data);
+    auto& tallies = tallies_->device(data.states.stream_id);
+    CELER_LAUNCH_KERNEL(process_diagnostic,
                         celeritas::device().default_block_size(),
-                        states.size(),
-                        params,
-                        states,
-                        counts);
+                        data.states.size(),
+                        data,
+                        tallies[AllItems<size_type, MemSpace::device>{}]);
 }
+
 //---------------------------------------------------------------------------//
-}  // namespace demo_loop
+}  // namespace celeritas
@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/ParticleProcessDiagnostic.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "corecel/sys/MpiCommunicator.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "detail/TallyStorage.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+class PhysicsParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the particle/process combinations that underwent discrete interactions.
+ *
+ * This runs at the end of the step, before the physics state of tracks that
+ * interacted is cleared by secondary initialization. Tallies are accumulated
+ * per OpenMP thread on host and atomically on device.
+ */
+class ParticleProcessDiagnostic final : public ExplicitActionInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticle = std::shared_ptr<ParticleParams const>;
+    using SPConstPhysics = std::shared_ptr<PhysicsParams const>;
+    using MapStringCount = std::unordered_map<std::string, size_type>;
+    //!@}
+
+  public:
+    // Construct with shared problem data
+    ParticleProcessDiagnostic(ActionId id,
+                              SPConstParticle particle,
+                              SPConstPhysics physics,
+                              size_type num_streams);
+
+    // Tally interactions with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Tally interactions with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the action
+    std::string label() const final { return "process-diagnostic"; }
+
+    //! Description of the action for user interaction
+    std::string description() const final
+    {
+        return "particle/process interaction diagnostic";
+    }
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    // Get the number of interactions for each process and particle type
+    MapStringCount particle_processes(MpiCommunicator const& comm = {}) const;
+
+  private:
+    ActionId id_;
+    SPConstParticle particle_;
+    SPConstPhysics physics_;
+    std::unique_ptr<detail::TallyStorage<size_type>> tallies_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -41,6 +41,7 @@ enum class HasDetectors
  */
 StepCollector::StepCollector(VecInterface callbacks,
                              SPConstGeo geo,
+                             size_type num_streams,
                              ActionRegistry* action_registry)
     : storage_(std::make_shared<detail::StepStorage>())
 {
@@ -50,6 +51,7 @@ StepCollector::StepCollector(VecInterface callbacks,
             return static_cast<bool>(i);
         }));
     CELER_EXPECT(geo);
+    CELER_EXPECT(num_streams > 0);
     CELER_EXPECT(action_registry);
 
     // Loop over callbacks to take union of step selections
@@ -129,6 +131,10 @@ StepCollector::StepCollector(VecInterface callbacks,
             = CollectionMirror<StepParamsData>(std::move(host_data));
     }
 
+    // Reserve a slot for each stream's states (allocated on first use)
+    storage_->states.host.resize(num_streams);
+    storage_->states.device.resize(num_streams);
+
     if (selection.points[StepPoint::pre] || !detector_map.empty())
     {
         // Some pre-step data is being gathered
@@ -35,6 +35,11 @@ struct StepStorage;
  * interfacing with the GPU track states at the beginning and/or end of every
  * step.
  *
+ * Each stream (i.e., each \c Stepper with a distinct \c StreamId) gathers
+ * into its own step state, so multiple threads can share a single collector
+ * without synchronization. Callbacks are executed by the thread that owns the
+ * stream and must be safe to call concurrently with different states.
+ *
  * \todo The step collector serves two purposes: supporting "sensitive
  * detectors" (mapping volume IDs to detector IDs and ignoring unmapped
  * volumes) and supporting unfiltered output for "MC truth" . Right now only
@@ -54,6 +59,7 @@ class StepCollector
     // Construct with options and register pre/post-step actions
     StepCollector(VecInterface callbacks,
                   SPConstGeo geo,
+                  size_type num_streams,
                   ActionRegistry* action_registry);
 
     // Default destructor and move
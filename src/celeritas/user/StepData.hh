@@ -76,6 +76,7 @@ struct StepSelection
     bool step_length{false};
     bool particle{false};
     bool energy_deposition{false};
+    bool weight{false};
 
     //! Create StepSelection with all options set to true
     static constexpr StepSelection all()
@@ -88,6 +89,7 @@ struct StepSelection
             true,
             true,
             true,
+            true,
             true};
     }
 
@@ -96,7 +98,7 @@ struct StepSelection
     {
         return points[StepPoint::pre] || points[StepPoint::post] || event_id
                || parent_id || track_step_count || action_id || step_length
-               || particle || energy_deposition;
+               || particle || energy_deposition || weight;
     }
 
     //! Combine the selection with another
@@ -114,6 +116,7 @@ struct StepSelection
         this->step_length |= other.step_length;
         this->particle |= other.particle;
         this->energy_deposition |= other.energy_deposition;
+        this->weight |= other.weight;
         return *this;
     }
 };
@@ -247,11 +250,15 @@ struct StepStateData
     StateItems<ActionId> action_id;
     StateItems<size_type> track_step_count;
     StateItems<real_type> step_length;
+    StateItems<real_type> weight;
 
     // Physics
     StateItems<ParticleId> particle;
     StateItems<Energy> energy_deposition;
 
+    //! Index of the core states these steps were gathered from
+    StreamId stream_id;
+
     //// METHODS ////
 
     //! True if constructed and correctly sized
@@ -264,8 +271,8 @@ struct StepStateData
         return !track_id.empty() && right_sized(detector)
                && right_sized(event_id) && right_sized(parent_id)
                && right_sized(track_step_count) && right_sized(action_id)
-               && right_sized(step_length) && right_sized(particle)
-               && right_sized(energy_deposition);
+               && right_sized(step_length) && right_sized(weight)
+               && right_sized(particle) && right_sized(energy_deposition);
     }
 
     //! State size
@@ -289,8 +296,10 @@ struct StepStateData
         track_step_count = other.track_step_count;
         action_id = other.action_id;
         step_length = other.step_length;
+        weight = other.weight;
         particle = other.particle;
         energy_deposition = other.energy_deposition;
+        stream_id = other.stream_id;
         return *this;
     }
 };
@@ -332,11 +341,15 @@ inline void resize(StepPointStateData<Ownership::value, M>* state,
 template<MemSpace M>
 inline void resize(StepStateData<Ownership::value, M>* state,
                    HostCRef<StepParamsData> const& params,
+                   StreamId stream_id,
                    size_type size)
 {
     CELER_EXPECT(state->size() == 0);
+    CELER_EXPECT(stream_id);
     CELER_EXPECT(size > 0);
 
+    state->stream_id = stream_id;
+
     for (auto sp : range(StepPoint::size_))
     {
         resize(&state->points[sp], params.selection.points[sp], size);
@@ -362,6 +375,7 @@ inline void resize(StepStateData<Ownership::value, M>* state,
     SD_RESIZE_IF_SELECTED(track_step_count);
     SD_RESIZE_IF_SELECTED(step_length);
     SD_RESIZE_IF_SELECTED(action_id);
+    SD_RESIZE_IF_SELECTED(weight);
     SD_RESIZE_IF_SELECTED(particle);
     SD_RESIZE_IF_SELECTED(energy_deposition);
 }
@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/StepDiagnostic.cc
+//---------------------------------------------------------------------------//
+#include "StepDiagnostic.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "detail/StepDiagnosticLauncher.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with particle data and upper bound on tallied steps.
+ *
+ * Tracks with more than \c max_steps steps are tallied in an overflow bin.
+ */
+StepDiagnostic::StepDiagnostic(ActionId id,
+                               SPConstParticle particle,
+                               size_type max_steps,
+                               size_type num_streams)
+    : id_(id), particle_(std::move(particle)), num_bins_(max_steps + 2)
+{
+    CELER_EXPECT(id_);
+    CELER_EXPECT(particle_);
+    CELER_EXPECT(max_steps > 0);
+    CELER_EXPECT(num_streams > 0);
+
+    tallies_ = std::make_unique<detail::TallyStorage<size_type>>(
+        num_bins_ * particle_->size(), num_streams);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally killed tracks with host data.
+ */
+void StepDiagnostic::execute(CoreHostRef const& core) const
+{
+    auto make_launcher = [&core, this](Span<size_type> tallies) {
+        return detail::StepDiagnosticLauncher{core, num_bins_, {tallies}};
+    };
+    detail::launch_tally(
+        core, tallies_.get(), make_launcher, "step-diagnostic");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the distribution of steps per track for each particle type.
+ *
+ * For i in [0, \c max_steps + 1], steps[particle][i] is the number of tracks
+ * of the given particle type that took i steps. The final bin stores the
+ * number of tracks that took more than \c max_steps steps. Particles without
+ * any killed tracks are omitted. If a communicator is given, the tallies are
+ * summed over all processes.
+ */
+auto StepDiagnostic::steps(MpiCommunicator const& comm) const
+    -> MapStringVecCount
+{
+    VecCount counts = tallies_->totals(comm);
+
+    MapStringVecCount result;
+    for (auto particle_id : range(ParticleId{particle_->size()}))
+    {
+        auto start = counts.begin() + particle_id.get() * num_bins_;
+        auto stop = start + num_bins_;
+        if (std::any_of(start, stop, [](size_type x) { return x > 0; }))
+        {
+            result[particle_->id_to_label(particle_id)] = {start, stop};
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void StepDiagnostic::execute(CoreDeviceRef const&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
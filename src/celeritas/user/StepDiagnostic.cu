@@ -0,0 +1,57 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/StepDiagnostic.cu
+//---------------------------------------------------------------------------//
+#include "StepDiagnostic.hh"
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+
+#include "detail/StepDiagnosticLauncher.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+
+__global__ void step_diagnostic_kernel(CoreDeviceRef const data,
+                                       size_type const num_bins,
+                                       Span<size_type> const tallies)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.states.size()))
+        return;
+
+    detail::StepDiagnosticLauncher launch{data, num_bins, {tallies}};
+    launch(tid);
+}
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally killed tracks on device.
+ */
+void StepDiagnostic::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    auto& tallies = tallies_->device(data.states.stream_id);
+    CELER_LAUNCH_KERNEL(step_diagnostic,
+                        celeritas::device().default_block_size(),
+                        data.states.size(),
+                        data,
+                        num_bins_,
+                        tallies[AllItems<size_type, MemSpace::device>{}]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
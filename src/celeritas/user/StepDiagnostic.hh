@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/StepDiagnostic.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "corecel/sys/MpiCommunicator.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "detail/TallyStorage.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the distribution of the number of steps per track.
+ *
+ * Each track is counted when it is killed, binned by its particle type and
+ * number of steps. This runs at the end of the step, after the interactions
+ * have been applied but before secondaries are initialized into the track
+ * slots. On host, each OpenMP thread accumulates into its own tallies, and on
+ * device the tallies are updated atomically; all tallies are summed when the
+ * result is requested.
+ */
+class StepDiagnostic final : public ExplicitActionInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticle = std::shared_ptr<ParticleParams const>;
+    using VecCount = std::vector<size_type>;
+    using MapStringVecCount = std::unordered_map<std::string, VecCount>;
+    //!@}
+
+  public:
+    // Construct with particle data and upper bound on tallied steps
+    StepDiagnostic(ActionId id,
+                   SPConstParticle particle,
+                   size_type max_steps,
+                   size_type num_streams);
+
+    // Tally tracks with host data
+    void execute(CoreHostRef const&) const final;
+
+    // Tally tracks with device data
+    void execute(CoreDeviceRef const&) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the action
+    std::string label() const final { return "step-diagnostic"; }
+
+    //! Description of the action for user interaction
+    std::string description() const final
+    {
+        return "steps per track diagnostic";
+    }
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    // Get the distribution of steps per track for each particle type
+    MapStringVecCount steps(MpiCommunicator const& comm = {}) const;
+
+  private:
+    ActionId id_;
+    SPConstParticle particle_;
+    size_type num_bins_;
+    std::unique_ptr<detail::TallyStorage<size_type>> tallies_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -28,6 +28,10 @@ namespace celeritas
  * for a thread with no energy deposition will be cleared even if it is in a
  * sensitive detector. Otherwise entries with zero energy deposition will
  * remain.
+ *
+ * When multiple streams share a \c StepCollector, \c execute is called
+ * concurrently from each stream's thread. The \c StepStateData::stream_id
+ * value can be used to index thread-local data without locking.
  */
 class StepInterface
 {
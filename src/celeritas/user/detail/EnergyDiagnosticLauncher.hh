@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/EnergyDiagnosticLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/grid/NonuniformGrid.hh"
+
+#include "../EnergyDiagnosticData.hh"
+#include "TallyAccumulator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Bin weighted energy deposition by the track's position along an axis.
+ */
+struct EnergyDiagnosticLauncher
+{
+    //!@{
+    //! \name Type aliases
+    using CoreRefNative = CoreRef<MemSpace::native>;
+    using ParamsRefNative = NativeCRef<EnergyDiagnosticParamsData>;
+    //!@}
+
+    //// DATA ////
+
+    CoreRefNative const& core_data;
+    ParamsRefNative const& diag_params;
+    TallyAccumulator<real_type> tally;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(ThreadId thread) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Bin the energy deposited by an active or dying track.
+ *
+ * The track is moved back to the middle of the step to avoid grid edges that
+ * coincide with geometry boundaries. This heuristic is not exact for curved
+ * (magnetic field or multiple scattering) steps.
+ */
+CELER_FUNCTION void EnergyDiagnosticLauncher::operator()(ThreadId thread) const
+{
+    CELER_ASSERT(thread < this->core_data.states.size());
+
+    const celeritas::CoreTrackView track(
+        this->core_data.params, this->core_data.states, thread);
+    auto const sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+    {
+        return;
+    }
+
+    real_type edep = track.make_physics_step_view().energy_deposition().value();
+    if (edep == 0)
+    {
+        // No energy was deposited (e.g. geometry-limited photon step)
+        return;
+    }
+
+    auto const geo = track.make_geo_view();
+    int const ax = static_cast<int>(this->diag_params.axis);
+    real_type pos = geo.pos()[ax]
+                    - real_type(0.5) * sim.step_limit().step * geo.dir()[ax];
+
+    NonuniformGrid<real_type> const grid(this->diag_params.bounds);
+    if (pos > grid.front() && pos < grid.back())
+    {
+        this->tally(grid.find(pos), sim.weight() * edep);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/ParticleProcessLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/PhysicsTrackView.hh"
+
+#include "TallyAccumulator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the particle/model combination for tracks with a discrete interaction.
+ *
+ * Tallies are indexed as \c model_id * num_particles + particle_id .
+ */
+struct ParticleProcessLauncher
+{
+    //!@{
+    //! \name Type aliases
+    using CoreRefNative = CoreRef<MemSpace::native>;
+    //!@}
+
+    //// DATA ////
+
+    CoreRefNative const& core_data;
+    TallyAccumulator<size_type> tally;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(ThreadId thread) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the model that limited the step, if any.
+ *
+ * The physics view is constructed without a material since killed tracks may
+ * have left the world.
+ */
+CELER_FUNCTION void ParticleProcessLauncher::operator()(ThreadId thread) const
+{
+    CELER_ASSERT(thread < this->core_data.states.size());
+
+    const celeritas::CoreTrackView track(
+        this->core_data.params, this->core_data.states, thread);
+    auto const sim = track.make_sim_view();
+    if (sim.status() == TrackStatus::inactive)
+    {
+        return;
+    }
+
+    ParticleId particle = track.make_particle_view().particle_id();
+    PhysicsTrackView const physics(this->core_data.params.physics,
+                                   this->core_data.states.physics,
+                                   particle,
+                                   MaterialId{},
+                                   thread);
+    if (ModelId model = physics.action_to_model(sim.step_limit().action))
+    {
+        this->tally(model.get() * physics.num_particles() + particle.get(), 1);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
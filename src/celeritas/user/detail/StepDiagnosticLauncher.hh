@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/StepDiagnosticLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "TallyAccumulator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the number of steps taken by each killed track.
+ *
+ * Tallies are indexed as \c particle_id * num_bins + num_steps, where the
+ * final bin for each particle counts tracks that exceeded the maximum.
+ */
+struct StepDiagnosticLauncher
+{
+    //!@{
+    //! \name Type aliases
+    using CoreRefNative = CoreRef<MemSpace::native>;
+    //!@}
+
+    //// DATA ////
+
+    CoreRefNative const& core_data;
+    size_type num_bins;
+    TallyAccumulator<size_type> tally;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(ThreadId thread) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the number of steps if the track was killed this step.
+ */
+CELER_FUNCTION void StepDiagnosticLauncher::operator()(ThreadId thread) const
+{
+    CELER_ASSERT(thread < this->core_data.states.size());
+
+    const celeritas::CoreTrackView track(
+        this->core_data.params, this->core_data.states, thread);
+    auto const sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::killed)
+    {
+        return;
+    }
+
+    ParticleId particle = track.make_particle_view().particle_id();
+    CELER_ASSERT(particle);
+    size_type num_steps = celeritas::min(sim.num_steps(), num_bins - 1);
+    this->tally(particle.get() * num_bins + num_steps, 1);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -7,13 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "StepGatherAction.hh"
 
-#include <mutex>
+#include <string>
 #include <utility>
 
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/user/StepData.hh"
 
@@ -65,24 +66,27 @@ void StepGatherAction<P>::execute(CoreHostRef const& core) const
 {
     CELER_EXPECT(core);
 
-    // Lock mutex to prevent multiple CPU threads from
-    // creating/accessing/processing state data simultaneously
-    std::lock_guard<std::mutex> scoped_lock{storage_->mumu};
-
     auto const& step_state = this->get_state(core);
     CELER_ASSERT(step_state.size() == core.states.size());
 
     MultiExceptionHandler capture_exception;
     StepGatherLauncher<P> launch{core, storage_->params.host_ref(), step_state};
-#pragma omp parallel for
-    for (size_type i = 0; i < core.states.size(); ++i)
+    std::string const label = this->label();
+#pragma omp parallel
     {
-        CELER_TRY_HANDLE(launch(ThreadId{i}), capture_exception);
+        ScopedTrace trace("omp", label.c_str());
+#pragma omp for
+        for (size_type i = 0; i < core.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE(launch(ThreadId{i}), capture_exception);
+        }
     }
     log_and_rethrow(std::move(capture_exception));
 
     if (P == StepPoint::post)
     {
+        ScopedTrace trace("step_interface", "step-callbacks");
+        trace.arg("num_callbacks", callbacks_.size());
         for (auto const& sp_callback : callbacks_)
         {
             sp_callback->execute(step_state);
@@ -99,16 +103,14 @@ void StepGatherAction<P>::execute(CoreDeviceRef const& core) const
 {
     CELER_EXPECT(core);
 
-    // Lock mutex to prevent multiple CPU threads from
-    // creating/accessing/processing state data simultaneously
-    std::lock_guard<std::mutex> scoped_lock{storage_->mumu};
-
 #if CELER_USE_DEVICE
     auto& step_state = this->get_state(core);
     step_gather_device<P>(core, storage_->params.device_ref(), step_state);
 
     if (P == StepPoint::post)
     {
+        ScopedTrace trace("step_interface", "step-callbacks");
+        trace.arg("num_callbacks", callbacks_.size());
         for (auto const& sp_callback : callbacks_)
         {
             sp_callback->execute(step_state);
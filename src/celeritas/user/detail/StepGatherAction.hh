@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "corecel/Assert.hh"
@@ -30,11 +31,11 @@ namespace detail
 /*!
  * Gather track step properties at a point during the step.
  *
- * This implementation class is constructed by the StepCollector.
- *
- * TODO: this class is only thread safe by locking it across multiple threads.
- * We'll need thread-independent states *or* a stream ID in the core state
- * corresponding to one element in an array of state data.
+ * This implementation class is constructed by the StepCollector. Step data
+ * is gathered into a separate state for each stream (indexed by the stream ID
+ * of the core state), so concurrent execution from multiple CPU threads
+ * requires no locking as long as each thread uses a distinct stream. The
+ * callbacks may likewise be called concurrently with different states.
  */
 template<StepPoint P>
 class StepGatherAction final : public ExplicitActionInterface
@@ -97,20 +98,29 @@ class StepGatherAction final : public ExplicitActionInterface
 // PRIVATE HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
 /*!
- * Get a reference to the step state data, allocating if needed.
+ * Get a reference to the step state data for a stream, allocating if needed.
  */
 template<StepPoint P>
 template<MemSpace M>
 StepStateData<Ownership::reference, M> const&
 StepGatherAction<P>::get_state(CoreRef<M> const& core) const
 {
-    auto& state_store = storage_->get_state(StepStorage::MemSpaceTag<M>{});
+    auto& all_states = storage_->get_states(StepStorage::MemSpaceTag<M>{});
+    StreamId stream_id = core.states.stream_id;
+    CELER_VALIDATE(stream_id < all_states.size(),
+                   << "stream ID " << stream_id.unchecked_get()
+                   << " exceeds the number of streams (" << all_states.size()
+                   << ") in the step collector");
+
+    auto& state_store = all_states[stream_id.get()];
     if (CELER_UNLIKELY(!state_store))
     {
         // State storage hasn't been allocated yet: allocate based on current
         // state
-        state_store = CollectionStateStore<StepStateData, M>{
-            storage_->params.host_ref(), core.states.size()};
+        HostCRef<StepParamsData> const& params = storage_->params.host_ref();
+        StepStateData<Ownership::value, M> states;
+        resize(&states, params, stream_id, core.states.size());
+        state_store = CollectionStateStore<StepStateData, M>{std::move(states)};
     }
     CELER_ENSURE(state_store);
     return state_store.ref();
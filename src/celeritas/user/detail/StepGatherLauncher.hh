@@ -135,6 +135,7 @@ CELER_FUNCTION void StepGatherLauncher<P>::operator()(ThreadId thread) const
             auto const& limit = sim.step_limit();
             SGL_SET_IF_SELECTED(action_id, limit.action);
             SGL_SET_IF_SELECTED(step_length, limit.step);
+            SGL_SET_IF_SELECTED(weight, sim.weight());
         }
     }
 
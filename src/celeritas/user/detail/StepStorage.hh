@@ -7,8 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include <mutex>
 #include <type_traits>
+#include <vector>
 
 #include "corecel/data/CollectionMirror.hh"
 #include "corecel/data/CollectionStateStore.hh"
@@ -22,6 +22,10 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Step storage shared across multiple actions.
+ *
+ * The state vectors are sized to the number of streams at construction, and
+ * each element is only ever accessed by the stream that owns it. This lets
+ * multiple CPU threads gather steps simultaneously without locking.
  */
 struct StepStorage
 {
@@ -30,21 +34,20 @@ struct StepStorage
     template<MemSpace M>
     using StepStateCollection = CollectionStateStore<StepStateData, M>;
     template<MemSpace M>
+    using VecStepState = std::vector<StepStateCollection<M>>;
+    template<MemSpace M>
     using MemSpaceTag = std::integral_constant<MemSpace, M>;
 
     //// DATA ////
 
-    // Mutex to prevent multiple CPU threads from writing simultaneously
-    mutable std::mutex mumu;
-
     // Parameter data
     CollectionMirror<StepParamsData> params;
 
-    // State data
+    // State data for each stream
     struct
     {
-        StepStateCollection<MemSpace::host> host;
-        StepStateCollection<MemSpace::device> device;
+        VecStepState<MemSpace::host> host;
+        VecStepState<MemSpace::device> device;
     } states;
 
     //// METHODS ////
@@ -52,13 +55,12 @@ struct StepStorage
     //!@{
     //! Tag-based dispatch for accessing states
     // TODO: replace with `if constexpr` for C++17
-    StepStateCollection<MemSpace::host>& get_state(MemSpaceTag<MemSpace::host>)
+    VecStepState<MemSpace::host>& get_states(MemSpaceTag<MemSpace::host>)
     {
         return states.host;
     }
 
-    StepStateCollection<MemSpace::device>&
-    get_state(MemSpaceTag<MemSpace::device>)
+    VecStepState<MemSpace::device>& get_states(MemSpaceTag<MemSpace::device>)
     {
         return states.device;
     }
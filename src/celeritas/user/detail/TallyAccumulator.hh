@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/TallyAccumulator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Atomics.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add a value to a bin of a diagnostic tally.
+ *
+ * On device the tallies are shared by all threads and are incremented
+ * atomically. On host each CPU thread has its own tallies (see \c
+ * TallyStorage), so a plain addition suffices.
+ */
+template<class T>
+struct TallyAccumulator
+{
+    //// DATA ////
+
+    Span<T> tallies;
+
+    //// METHODS ////
+
+    //! Add a value to the given bin
+    CELER_FUNCTION void operator()(size_type bin, T value) const
+    {
+        CELER_EXPECT(bin < tallies.size());
+#if CELER_DEVICE_COMPILE
+        atomic_add(&tallies[bin], value);
+#else
+        tallies[bin] += value;
+#endif
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
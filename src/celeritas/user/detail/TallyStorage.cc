@@ -0,0 +1,148 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/TallyStorage.cc
+//---------------------------------------------------------------------------//
+#include "TallyStorage.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with number of bins and streams.
+ */
+template<class T>
+TallyStorage<T>::TallyStorage(size_type num_bins, size_type num_streams)
+    : num_bins_(num_bins), host_(num_streams), device_(num_streams)
+{
+    CELER_EXPECT(num_bins_ > 0);
+    CELER_EXPECT(num_streams > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get per-thread host tallies for a stream, allocating if needed.
+ *
+ * The number of thread-local tallies grows if the OpenMP thread count
+ * increases between steps.
+ */
+template<class T>
+auto TallyStorage<T>::host(StreamId stream) -> std::vector<VecT>&
+{
+    CELER_VALIDATE(stream < host_.size(),
+                   << "stream ID " << stream.unchecked_get()
+                   << " exceeds the number of streams (" << host_.size()
+                   << ") in the diagnostic");
+
+    size_type num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    auto& tallies = host_[stream.get()];
+    if (tallies.size() < num_threads)
+    {
+        tallies.resize(num_threads, VecT(num_bins_, T{0}));
+    }
+    return tallies;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get device tallies for a stream, allocating if needed.
+ */
+template<class T>
+auto TallyStorage<T>::device(StreamId stream) -> DeviceItems&
+{
+    CELER_VALIDATE(stream < device_.size(),
+                   << "stream ID " << stream.unchecked_get()
+                   << " exceeds the number of streams (" << device_.size()
+                   << ") in the diagnostic");
+
+    auto& tallies = device_[stream.get()];
+    if (CELER_UNLIKELY(tallies.empty()))
+    {
+        Collection<T, Ownership::value, MemSpace::host> zeros;
+        make_builder(&zeros).resize(num_bins_);
+        tallies = zeros;
+    }
+    return tallies;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum tallies over all streams and threads, then over processes.
+ *
+ * This must be called after all streams have finished transporting, and on
+ * all processes in the communicator.
+ */
+template<class T>
+auto TallyStorage<T>::totals(MpiCommunicator const& comm) const -> VecT
+{
+    VecT result(num_bins_, T{0});
+    auto accumulate = [&result](VecT const& tallies) {
+        CELER_ASSERT(tallies.size() == result.size());
+        for (auto i : range(result.size()))
+        {
+            result[i] += tallies[i];
+        }
+    };
+
+    for (auto const& stream_tallies : host_)
+    {
+        for (auto const& tallies : stream_tallies)
+        {
+            accumulate(tallies);
+        }
+    }
+
+    VecT temp(num_bins_);
+    for (auto const& tallies : device_)
+    {
+        if (!tallies.empty())
+        {
+            copy_to_host(tallies, make_span(temp));
+            accumulate(temp);
+        }
+    }
+
+    allreduce(comm, Operation::sum, make_span(result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the index of the calling OpenMP thread.
+ */
+size_type tally_thread_id()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template class TallyStorage<size_type>;
+template class TallyStorage<real_type>;
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/TallyStorage.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/TraceRecorder.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/KernelContextException.hh"
+
+namespace celeritas
+{
+class MpiCommunicator;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Binned tallies accumulated separately for each stream and CPU thread.
+ *
+ * On host, each stream has one tally vector per OpenMP thread so that tracks
+ * can be binned in parallel without atomics or locking. On device, each
+ * stream has a single collection that is incremented atomically. The
+ * per-stream storage is allocated on first use, so multiple CPU threads can
+ * tally concurrently as long as each uses a distinct stream. All tallies are
+ * summed by \c totals at the end of the run.
+ */
+template<class T>
+class TallyStorage
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecT = std::vector<T>;
+    using DeviceItems = Collection<T, Ownership::value, MemSpace::device>;
+    //!@}
+
+  public:
+    // Construct with number of bins and streams
+    TallyStorage(size_type num_bins, size_type num_streams);
+
+    //! Number of bins in each tally
+    size_type num_bins() const { return num_bins_; }
+
+    // Get per-thread host tallies for a stream, allocating if needed
+    std::vector<VecT>& host(StreamId stream);
+
+    // Get device tallies for a stream, allocating if needed
+    DeviceItems& device(StreamId stream);
+
+    // Sum tallies over all streams and threads, then over processes
+    VecT totals(MpiCommunicator const& comm) const;
+
+  private:
+    size_type num_bins_;
+    std::vector<std::vector<VecT>> host_;
+    std::vector<DeviceItems> device_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Get the index of the calling OpenMP thread
+size_type tally_thread_id();
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bin all tracks on host using thread-local tallies.
+ *
+ * The \c make_launcher function is called once per OpenMP thread with a span
+ * of that thread's tallies, and it must return a function-like object that
+ * takes a thread ID.
+ */
+template<class T, class F>
+void launch_tally(CoreHostRef const& core,
+                  TallyStorage<T>* storage,
+                  F const& make_launcher,
+                  char const* label)
+{
+    CELER_EXPECT(core);
+    CELER_EXPECT(storage);
+
+    auto& tallies = storage->host(core.states.stream_id);
+    MultiExceptionHandler capture_exception;
+#ifdef _OPENMP
+#    pragma omp parallel
+#endif
+    {
+        ScopedTrace trace("omp", label);
+        size_type tid = tally_thread_id();
+        CELER_ASSERT(tid < tallies.size());
+        auto launch = make_launcher(make_span(tallies[tid]));
+#ifdef _OPENMP
+#    pragma omp for
+#endif
+        for (size_type i = 0; i < core.states.size(); ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                launch(ThreadId{i}),
+                capture_exception,
+                KernelContextException(core, ThreadId{i}, label));
+        }
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
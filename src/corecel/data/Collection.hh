@@ -219,6 +219,9 @@ class Collection
     template<Ownership W2, MemSpace M2>
     explicit inline Collection(Collection<T, W2, M2, I>& other);
 
+    // Construct a reference to externally owned data
+    explicit inline CELER_FUNCTION Collection(SpanT data);
+
     //!@{
     //! Default assignment
     Collection& operator=(Collection const& other) = default;
@@ -344,6 +347,22 @@ Collection<T, W, M, I>::operator=(Collection<T, W2, M2, I>& other)
 }
 //!@}
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a reference to externally owned data.
+ *
+ * This is only allowed for reference types, and the referenced data must be
+ * in the collection's memory space. It's useful for data that is not managed
+ * by a value collection, such as memory shared between processes.
+ */
+template<class T, Ownership W, MemSpace M, class I>
+CELER_FUNCTION Collection<T, W, M, I>::Collection(SpanT data)
+{
+    static_assert(W != Ownership::value,
+                  "only reference collections can be constructed from spans");
+    storage_.data = data;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access a single element.
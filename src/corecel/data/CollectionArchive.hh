@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/CollectionArchive.hh
+//! \brief Write and read host collections to binary archives
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/io/BinaryArchive.hh"
+
+#include "Collection.hh"
+#include "CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write all elements of a host collection to an archive.
+ */
+template<class T, class I>
+void archive(BinaryOutArchive& ar,
+             Collection<T, Ownership::value, MemSpace::host, I> const& c)
+{
+    ar(c[AllItems<T, MemSpace::host>{}]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the contents of a host collection with data from an archive.
+ */
+template<class T, class I>
+void unarchive(BinaryInArchive& ar,
+               Collection<T, Ownership::value, MemSpace::host, I>* c)
+{
+    CELER_EXPECT(c);
+    Span<T const> values = ar.read_span<T>();
+    *c = {};
+    make_builder(c).insert_back(values.begin(), values.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reference collection data directly from an archive without copying.
+ *
+ * The archive's underlying memory (e.g. a memory-mapped file or shared memory
+ * segment) must outlive the collection.
+ */
+template<class T, class I>
+void unarchive(BinaryInArchive& ar,
+               Collection<T, Ownership::const_reference, MemSpace::host, I>* c)
+{
+    CELER_EXPECT(c);
+    using CollectionT
+        = Collection<T, Ownership::const_reference, MemSpace::host, I>;
+    *c = CollectionT{ar.read_span<T>()};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,130 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/HostAllocator.cc
+//---------------------------------------------------------------------------//
+#include "HostAllocator.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <sys/mman.h>
+
+#include "corecel/Assert.hh"
+#include "corecel/sys/Environment.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Small page size for first-touch initialization
+constexpr std::size_t page_size = 4096;
+
+//---------------------------------------------------------------------------//
+bool getenv_flag(char const* key)
+{
+    std::string const& value = celeritas::getenv(key);
+    return !value.empty() && value != "0";
+}
+
+//---------------------------------------------------------------------------//
+HostAllocatorOptions& global_options()
+{
+    static HostAllocatorOptions opts = [] {
+        HostAllocatorOptions result;
+        result.huge_pages = getenv_flag("CELER_HOST_HUGE_PAGES");
+        result.first_touch = getenv_flag("CELER_HOST_FIRST_TOUCH");
+        return result;
+    }();
+    return opts;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get host allocation options.
+ */
+HostAllocatorOptions const& host_allocator_options()
+{
+    return global_options();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Change host allocation options.
+ *
+ * This only affects future allocations.
+ */
+void host_allocator_options(HostAllocatorOptions const& opts)
+{
+    CELER_EXPECT(opts.large_size > 0);
+    global_options() = opts;
+}
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate aligned host memory.
+ */
+void* allocate_host(std::size_t bytes, std::size_t align)
+{
+    HostAllocatorOptions const& opts = global_options();
+    bool const is_large = bytes >= opts.large_size;
+    if (is_large && opts.huge_pages)
+    {
+        align = std::max(align, opts.large_size);
+    }
+
+    // Size must be a nonzero multiple of the alignment
+    std::size_t num_blocks = (bytes + align - 1) / align;
+    std::size_t alloc_bytes = std::max(num_blocks, std::size_t{1}) * align;
+    void* result = std::aligned_alloc(align, alloc_bytes);
+    if (!result)
+    {
+        throw std::bad_alloc();
+    }
+
+    if (is_large && opts.huge_pages)
+    {
+#ifdef MADV_HUGEPAGE
+        // Advisory only: ignore failure if THP is disabled
+        (void)::madvise(result, alloc_bytes, MADV_HUGEPAGE);
+#endif
+    }
+    if (is_large && opts.first_touch)
+    {
+        // Fault in pages using the same static thread partitioning as the
+        // host kernels
+        auto* data = static_cast<char*>(result);
+        auto const num_pages
+            = static_cast<std::ptrdiff_t>((bytes + page_size - 1) / page_size);
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < num_pages; ++i)
+        {
+            std::size_t offset = i * page_size;
+            std::memset(data + offset, 0, std::min(page_size, bytes - offset));
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free aligned host memory.
+ */
+void deallocate_host(void* p) noexcept
+{
+    std::free(p);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/HostAllocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Runtime options for allocating host collection memory.
+ *
+ * All host allocations are aligned to at least \c alignment bytes for
+ * vectorized access. Large allocations (at least \c large_size bytes) can
+ * additionally:
+ * - \c huge_pages : be aligned to and advise the kernel to back them with
+ *   transparent huge pages, reducing TLB misses for multi-gigabyte states;
+ * - \c first_touch : be zeroed in parallel with an OpenMP static schedule
+ *   when allocated, so that on NUMA systems each page resides near the
+ *   thread that will process the corresponding track slots.
+ *
+ * The defaults are loaded from the environment variables \c
+ * CELER_HOST_HUGE_PAGES and \c CELER_HOST_FIRST_TOUCH (nonempty and not "0"
+ * to enable).
+ */
+struct HostAllocatorOptions
+{
+    static constexpr std::size_t alignment = 64;
+
+    std::size_t large_size{std::size_t(1) << 21};  //!< 2 MiB
+    bool huge_pages{false};
+    bool first_touch{false};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocator for host collection data.
+ *
+ * This is stateless: the allocation behavior is set globally by \c
+ * HostAllocatorOptions .
+ */
+template<class T>
+class HostAllocator
+{
+  public:
+    using value_type = T;
+
+    HostAllocator() = default;
+    template<class U>
+    HostAllocator(HostAllocator<U> const&) noexcept
+    {
+    }
+
+    // Allocate uninitialized memory for n elements
+    inline T* allocate(std::size_t n);
+
+    // Free memory
+    inline void deallocate(T* p, std::size_t n) noexcept;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Get host allocation options (loaded from the environment on first use)
+HostAllocatorOptions const& host_allocator_options();
+
+// Change host allocation options (not thread-safe: call during setup)
+void host_allocator_options(HostAllocatorOptions const& opts);
+
+namespace detail
+{
+// Allocate aligned host memory
+void* allocate_host(std::size_t bytes, std::size_t align);
+
+// Free aligned host memory
+void deallocate_host(void* p) noexcept;
+}  // namespace detail
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate uninitialized memory for n elements.
+ */
+template<class T>
+T* HostAllocator<T>::allocate(std::size_t n)
+{
+    constexpr std::size_t align = alignof(T) > HostAllocatorOptions::alignment
+                                      ? alignof(T)
+                                      : HostAllocatorOptions::alignment;
+    return static_cast<T*>(detail::allocate_host(n * sizeof(T), align));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free memory.
+ */
+template<class T>
+void HostAllocator<T>::deallocate(T* p, std::size_t) noexcept
+{
+    detail::deallocate_host(p);
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! All host allocators are interchangeable
+template<class T, class U>
+constexpr bool operator==(HostAllocator<T> const&, HostAllocator<U> const&)
+{
+    return true;
+}
+
+template<class T, class U>
+constexpr bool operator!=(HostAllocator<T> const&, HostAllocator<U> const&)
+{
+    return false;
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
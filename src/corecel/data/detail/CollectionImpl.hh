@@ -15,6 +15,7 @@
 
 #include "../Copier.hh"
 #include "../DeviceVector.hh"
+#include "../HostAllocator.hh"
 #include "DisabledStorage.hh"
 
 namespace celeritas
@@ -78,7 +79,7 @@ struct CollectionStorage<T, Ownership::value, MemSpace::host>
 {
     static_assert(!std::is_same<T, bool>::value,
                   "bool is not compatible between vector and anything else");
-    using type = std::vector<T>;
+    using type = std::vector<T, HostAllocator<T>>;
     type data;
 };
 
@@ -168,8 +169,8 @@ struct CollectionAssigner<Ownership::value, MemSpace::host>
     CollectionStorage<T, Ownership::value, MemSpace::host>
     operator()(CollectionStorage<T, W2, MemSpace::device> const& source)
     {
-        CollectionStorage<T, Ownership::value, MemSpace::host> result{
-            std::vector<T>(source.data.size())};
+        using StorageT = CollectionStorage<T, Ownership::value, MemSpace::host>;
+        StorageT result{typename StorageT::type(source.data.size())};
         Copier<T, MemSpace::device> copy{
             {source.data.data(), source.data.size()}};
         copy(MemSpace::host, {result.data.data(), result.data.size()});
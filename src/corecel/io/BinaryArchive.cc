@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryArchive.cc
+//---------------------------------------------------------------------------//
+#include "BinaryArchive.hh"
+
+#include <ostream>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// BINARY OUT ARCHIVE
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a stream opened in binary mode.
+ */
+BinaryOutArchive::BinaryOutArchive(std::ostream* os) : os_(os)
+{
+    CELER_EXPECT(os_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a string.
+ */
+void BinaryOutArchive::operator()(std::string const& value)
+{
+    (*this)(static_cast<std::size_t>(value.size()));
+    this->write(value.data(), value.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write raw bytes.
+ */
+void BinaryOutArchive::write(void const* data, std::size_t size)
+{
+    os_->write(static_cast<char const*>(data),
+               static_cast<std::streamsize>(size));
+    CELER_VALIDATE(*os_, << "failed to write " << size << " bytes at offset "
+                         << offset_ << " of binary archive");
+    offset_ += size;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write zeros up to the next alignment boundary.
+ */
+void BinaryOutArchive::pad()
+{
+    static char const zeros[alignment] = {};
+    std::size_t remainder = offset_ % alignment;
+    if (remainder != 0)
+    {
+        this->write(zeros, alignment - remainder);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// BINARY IN ARCHIVE
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the full archive data.
+ */
+BinaryInArchive::BinaryInArchive(Span<char const> data) : data_(data) {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a string.
+ */
+void BinaryInArchive::operator()(std::string* value)
+{
+    CELER_EXPECT(value);
+    std::size_t size{};
+    (*this)(&size);
+    char const* data = this->read(size);
+    value->assign(data, size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move to an absolute offset from the start of the archive.
+ *
+ * The offset should be one previously returned by \c
+ * BinaryOutArchive::offset so that array padding is consistent.
+ */
+void BinaryInArchive::seek(std::size_t offset)
+{
+    CELER_VALIDATE(offset <= data_.size(),
+                   << "binary archive is truncated: cannot seek to offset "
+                   << offset << " of " << data_.size());
+    offset_ = offset;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a pointer to the next block of bytes and advance.
+ */
+char const* BinaryInArchive::read(std::size_t size)
+{
+    CELER_VALIDATE(size <= this->remaining(),
+                   << "binary archive is truncated: failed to read " << size
+                   << " bytes at offset " << offset_ << " of "
+                   << data_.size());
+    char const* result = data_.data() + offset_;
+    offset_ += size;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Skip to the next alignment boundary.
+ */
+void BinaryInArchive::skip_padding()
+{
+    std::size_t remainder = offset_ % BinaryOutArchive::alignment;
+    if (remainder != 0)
+    {
+        this->read(BinaryOutArchive::alignment - remainder);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,177 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryArchive.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write trivially copyable data to a native-endian binary stream.
+ *
+ * Arrays are preceded by their size and padded so that their data starts on
+ * an \c alignment boundary relative to the start of the archive. Since memory
+ * maps are page-aligned, this lets \c BinaryInArchive return views directly
+ * into a mapped file without copying.
+ *
+ * The format is only meant to be read back by the same build of the code on
+ * the same architecture: it is suitable for caches but not for archival.
+ */
+class BinaryOutArchive
+{
+  public:
+    //! Alignment of array data in bytes
+    static constexpr std::size_t alignment = 64;
+
+  public:
+    // Construct with a stream opened in binary mode
+    explicit BinaryOutArchive(std::ostream* os);
+
+    // Write a single value
+    template<class T>
+    inline void operator()(T const& value);
+
+    // Write an array of values
+    template<class T>
+    inline void operator()(Span<T const> values);
+
+    // Write a string
+    void operator()(std::string const& value);
+
+    //! Number of bytes written so far
+    std::size_t offset() const { return offset_; }
+
+  private:
+    std::ostream* os_;
+    std::size_t offset_{0};
+
+    void write(void const* data, std::size_t size);
+    void pad();
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read data written by a \c BinaryOutArchive from a block of memory.
+ *
+ * The data should be at least as aligned as the most strictly aligned array
+ * element type: memory-mapped files and heap allocations both satisfy this.
+ *
+ * Reading past the end of the data (e.g. from a truncated or corrupt file)
+ * raises a \c RuntimeError so that callers can discard invalid data.
+ */
+class BinaryInArchive
+{
+  public:
+    // Construct with the full archive data
+    explicit BinaryInArchive(Span<char const> data);
+
+    // Read a single value
+    template<class T>
+    inline void operator()(T* value);
+
+    // Read a string
+    void operator()(std::string* value);
+
+    // Get a view into the archive for an array of values
+    template<class T>
+    inline Span<T const> read_span();
+
+    // Move to an absolute offset from the start of the archive
+    void seek(std::size_t offset);
+
+    //! Number of bytes read so far
+    std::size_t offset() const { return offset_; }
+
+    //! Number of bytes not yet read
+    std::size_t remaining() const { return data_.size() - offset_; }
+
+  private:
+    Span<char const> data_;
+    std::size_t offset_{0};
+
+    char const* read(std::size_t size);
+    void skip_padding();
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Write a single value.
+ */
+template<class T>
+void BinaryOutArchive::operator()(T const& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "archived values must be trivially copyable");
+    this->write(&value, sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write an array of values.
+ */
+template<class T>
+void BinaryOutArchive::operator()(Span<T const> values)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "archived values must be trivially copyable");
+    static_assert(alignof(T) <= alignment, "unsupported alignment");
+    (*this)(static_cast<std::size_t>(values.size()));
+    this->pad();
+    this->write(values.data(), values.size() * sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a single value.
+ */
+template<class T>
+void BinaryInArchive::operator()(T* value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "archived values must be trivially copyable");
+    CELER_EXPECT(value);
+    std::memcpy(value, this->read(sizeof(T)), sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a view into the archive for an array of values.
+ *
+ * The result references the underlying archive data, which must outlive it.
+ */
+template<class T>
+Span<T const> BinaryInArchive::read_span()
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "archived values must be trivially copyable");
+    std::size_t count{};
+    (*this)(&count);
+    this->skip_padding();
+    CELER_VALIDATE(count <= this->remaining() / sizeof(T),
+                   << "binary archive is truncated: failed to read " << count
+                   << " array elements at offset " << offset_);
+    char const* data = this->read(count * sizeof(T));
+    CELER_VALIDATE(reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0,
+                   << "misaligned array at offset " << (data - data_.data())
+                   << " of binary archive");
+    return {reinterpret_cast<T const*>(data), count};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
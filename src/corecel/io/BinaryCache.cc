@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryCache.cc
+//---------------------------------------------------------------------------//
+#include "BinaryCache.hh"
+
+#include <cstdio>
+#include <utility>
+#include <unistd.h>
+
+#include "celeritas_version.h"
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+
+#include "Logger.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Cache file identifier
+constexpr std::uint64_t cache_magic = 0x4548434143524c43ull;  // "CLRCACHE"
+//! Increment when the header or archive layout changes
+constexpr std::uint32_t cache_format_version = 1;
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+// BINARY CACHE WRITER
+//---------------------------------------------------------------------------//
+/*!
+ * Open a temporary file and write the header.
+ */
+BinaryCacheWriter::BinaryCacheWriter(std::string filename, key_type key)
+    : filename_(std::move(filename))
+    , temp_filename_(filename_ + ".tmp" + std::to_string(::getpid()))
+    , os_(temp_filename_, std::ios::out | std::ios::binary)
+    , ar_(&os_)
+{
+    CELER_VALIDATE(os_,
+                   << "failed to open cache file '" << temp_filename_
+                   << "' for writing");
+    ar_(cache_magic);
+    ar_(cache_format_version);
+    ar_(static_cast<std::uint32_t>(sizeof(real_type)));
+    ar_(std::string(celeritas_version));
+    ar_(key);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove the temporary file if not finalized.
+ */
+BinaryCacheWriter::~BinaryCacheWriter()
+{
+    if (os_.is_open())
+    {
+        os_.close();
+        std::remove(temp_filename_.c_str());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close and move the cache into place.
+ */
+void BinaryCacheWriter::finalize()
+{
+    CELER_EXPECT(os_.is_open());
+    os_.close();
+    CELER_VALIDATE(os_, << "failed to write cache file '" << temp_filename_
+                       << "'");
+    int result = std::rename(temp_filename_.c_str(), filename_.c_str());
+    CELER_VALIDATE(result == 0,
+                   << "failed to move cache file '" << temp_filename_
+                   << "' to '" << filename_ << "'");
+    CELER_LOG(debug) << "Wrote " << ar_.offset() << " bytes to cache file '"
+                     << filename_ << "'";
+}
+
+//---------------------------------------------------------------------------//
+// BINARY CACHE READER
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file and check its header.
+ */
+BinaryCacheReader::BinaryCacheReader(std::string const& filename,
+                                     key_type key)
+    : file_(filename)
+{
+    if (!file_)
+    {
+        CELER_LOG(debug) << "Cache file '" << filename << "' does not exist";
+        return;
+    }
+
+    auto ar = std::make_unique<BinaryInArchive>(file_.data());
+    std::uint64_t magic{};
+    std::uint32_t version{};
+    std::uint32_t real_size{};
+    std::string code_version;
+    key_type file_key{};
+    if (ar->remaining() < sizeof(magic) + 2 * sizeof(version))
+    {
+        CELER_LOG(warning) << "Ignoring invalid cache file '" << filename
+                           << "'";
+        return;
+    }
+    (*ar)(&magic);
+    (*ar)(&version);
+    (*ar)(&real_size);
+    if (magic != cache_magic || version != cache_format_version
+        || real_size != sizeof(real_type))
+    {
+        CELER_LOG(warning) << "Ignoring incompatible cache file '" << filename
+                           << "'";
+        return;
+    }
+    try
+    {
+        (*ar)(&code_version);
+        (*ar)(&file_key);
+    }
+    catch (RuntimeError const& e)
+    {
+        CELER_LOG(warning) << "Ignoring corrupt cache file '" << filename
+                           << "': " << e.what();
+        return;
+    }
+    if (code_version != celeritas_version || file_key != key)
+    {
+        CELER_LOG(info) << "Cache file '" << filename
+                        << "' is stale: rebuilding";
+        return;
+    }
+    ar_ = std::move(ar);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
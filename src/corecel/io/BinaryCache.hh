@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "corecel/sys/MappedFile.hh"
+
+#include "BinaryArchive.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write a versioned binary cache file.
+ *
+ * The file begins with a header containing a magic string, the cache format
+ * version, the size of floating point values, and a user-provided key that
+ * should be a hash of all the inputs used to construct the cached data. The
+ * data is written to a temporary file that atomically replaces the target
+ * on \c finalize so that concurrent readers (e.g. other MPI ranks or jobs
+ * sharing a file system) never see a partially written cache.
+ *
+ * \code
+    BinaryCacheWriter write_cache(filename, key);
+    archive(write_cache.archive(), host_data.reals);
+    write_cache.finalize();
+   \endcode
+ */
+class BinaryCacheWriter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using key_type = std::uint64_t;
+    //!@}
+
+  public:
+    // Open a temporary file and write the header
+    BinaryCacheWriter(std::string filename, key_type key);
+
+    // Remove the temporary file if not finalized
+    ~BinaryCacheWriter();
+
+    //! Access the archive for writing data
+    BinaryOutArchive& archive() { return ar_; }
+
+    // Close and move the cache into place
+    void finalize();
+
+  private:
+    std::string filename_;
+    std::string temp_filename_;
+    std::ofstream os_;
+    BinaryOutArchive ar_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a versioned binary cache file through a read-only memory map.
+ *
+ * The reader evaluates to false if the file is missing or if its header is
+ * corrupt or does not match the current format, floating point precision, or
+ * key: in these cases the cached data should be rebuilt. Since the cache
+ * contents can still be invalid (e.g. truncated by a full disk), callers
+ * should catch \c RuntimeError while reading and rebuild on failure.
+ */
+class BinaryCacheReader
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using key_type = std::uint64_t;
+    //!@}
+
+  public:
+    // Map the file and check its header
+    BinaryCacheReader(std::string const& filename, key_type key);
+
+    //! Whether the cache exists and is compatible
+    explicit operator bool() const { return static_cast<bool>(ar_); }
+
+    // Access the archive for reading data
+    inline BinaryInArchive& archive();
+
+  private:
+    MappedFile file_;
+    std::unique_ptr<BinaryInArchive> ar_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Access the archive for reading data.
+ */
+BinaryInArchive& BinaryCacheReader::archive()
+{
+    CELER_EXPECT(*this);
+    return *ar_;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MappedFile.cc
+//---------------------------------------------------------------------------//
+#include "MappedFile.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Map the given file.
+ *
+ * A missing or empty file leaves the mapping empty; a file that exists but
+ * cannot be mapped is an error.
+ */
+MappedFile::MappedFile(std::string const& filename)
+{
+    CELER_EXPECT(!filename.empty());
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        CELER_VALIDATE(errno == ENOENT,
+                       << "failed to open '" << filename
+                       << "': " << std::strerror(errno));
+        return;
+    }
+
+    struct stat info;
+    int result = ::fstat(fd, &info);
+    if (result == 0 && info.st_size > 0)
+    {
+        void* ptr = ::mmap(nullptr,
+                           static_cast<std::size_t>(info.st_size),
+                           PROT_READ,
+                           MAP_SHARED,
+                           fd,
+                           0);
+        if (ptr == MAP_FAILED)
+        {
+            result = -1;
+        }
+        else
+        {
+            data_ = {static_cast<char const*>(ptr),
+                     static_cast<std::size_t>(info.st_size)};
+        }
+    }
+    // The mapping remains valid after the descriptor is closed
+    int errsv = errno;
+    ::close(fd);
+    CELER_VALIDATE(result == 0,
+                   << "failed to map '" << filename
+                   << "': " << std::strerror(errsv));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap on destruction.
+ */
+MappedFile::~MappedFile()
+{
+    if (!data_.empty())
+    {
+        ::munmap(const_cast<char*>(data_.data()), data_.size());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of another mapping.
+ */
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, {}))
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Swap mappings with another instance.
+ */
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    std::swap(data_, other.data_);
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
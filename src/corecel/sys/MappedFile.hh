@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MappedFile.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Map a file into memory as read-only data.
+ *
+ * The file contents are paged in lazily by the operating system and are
+ * shared between all processes on a node that map the same file. An empty
+ * or nonexistent file results in an empty (false) mapping rather than an
+ * error so that callers can use this to probe for optional cached data.
+ *
+ * \code
+    MappedFile cached("physics.celercache");
+    if (cached)
+    {
+        Span<char const> data = cached.data();
+    }
+   \endcode
+ */
+class MappedFile
+{
+  public:
+    // Map the given file
+    explicit MappedFile(std::string const& filename);
+
+    // Unmap on destruction
+    ~MappedFile();
+
+    //!@{
+    //! Prevent copying but allow moving
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile(MappedFile&&) noexcept;
+    MappedFile& operator=(MappedFile&&) noexcept;
+    //!@}
+
+    //! Whether a file is mapped
+    explicit operator bool() const { return !data_.empty(); }
+
+    //! Access the mapped bytes
+    Span<char const> data() const { return data_; }
+
+  private:
+    Span<char const> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,183 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MpiSharedBuffer.cc
+//---------------------------------------------------------------------------//
+#include "MpiSharedBuffer.hh"
+
+#include <cstring>
+#include <utility>
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+#include "corecel/Assert.hh"
+
+#include "MpiCommunicator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Node communicator and shared memory window
+struct MpiSharedBuffer::Impl
+{
+#if CELERITAS_USE_MPI
+    MPI_Comm node_comm = MPI_COMM_NULL;
+    MPI_Win win = MPI_WIN_NULL;
+    int keyval = MPI_KEYVAL_INVALID;
+
+    // Free the window and communicator
+    void free_mpi()
+    {
+        if (win != MPI_WIN_NULL)
+        {
+            MPI_Win_free(&win);
+        }
+        if (node_comm != MPI_COMM_NULL)
+        {
+            MPI_Comm_free(&node_comm);
+        }
+    }
+#endif
+};
+
+#if CELERITAS_USE_MPI
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Free the MPI resources of a buffer when MPI_COMM_SELF is freed.
+ *
+ * MPI_Finalize deletes the attributes of MPI_COMM_SELF before anything
+ * else, so this releases the window while MPI is still usable if the buffer
+ * outlives MPI.
+ */
+int delete_shared_buffer(MPI_Comm, int, void* attr, void*)
+{
+    static_cast<MpiSharedBuffer::Impl*>(attr)->free_mpi();
+    return MPI_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether MPI has been finalized
+bool is_mpi_finalized()
+{
+    int result{0};
+    MPI_Finalized(&result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create on one rank per node and share with the others.
+ */
+MpiSharedBuffer::MpiSharedBuffer(MpiCommunicator const& comm,
+                                 CreateFunc create)
+{
+    CELER_EXPECT(create);
+
+    if (!comm)
+    {
+        local_ = create();
+        data_ = {local_.data(), local_.size()};
+        return;
+    }
+
+#if CELERITAS_USE_MPI
+    impl_.reset(new Impl);
+
+    // Release the window at MPI_Finalize if this buffer is still alive
+    CELER_MPI_CALL(MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                                          delete_shared_buffer,
+                                          &impl_->keyval,
+                                          nullptr));
+    CELER_MPI_CALL(
+        MPI_Comm_set_attr(MPI_COMM_SELF, impl_->keyval, impl_.get()));
+
+    // Group processes that can share memory
+    CELER_MPI_CALL(MPI_Comm_split_type(comm.mpi_comm(),
+                                       MPI_COMM_TYPE_SHARED,
+                                       comm.rank(),
+                                       MPI_INFO_NULL,
+                                       &impl_->node_comm));
+    int node_rank{};
+    CELER_MPI_CALL(MPI_Comm_rank(impl_->node_comm, &node_rank));
+    CELER_MPI_CALL(MPI_Comm_size(impl_->node_comm, &num_sharing_));
+
+    // Create the data on the node root and broadcast its size
+    if (node_rank == 0)
+    {
+        local_ = create();
+    }
+    unsigned long long size = local_.size();
+    CELER_MPI_CALL(
+        MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, 0, impl_->node_comm));
+
+    // Allocate the window on the root, and map it on all ranks
+    char* ptr{nullptr};
+    CELER_MPI_CALL(MPI_Win_allocate_shared(
+        static_cast<MPI_Aint>(node_rank == 0 ? size : 0),
+        1,
+        MPI_INFO_NULL,
+        impl_->node_comm,
+        &ptr,
+        &impl_->win));
+    if (node_rank == 0)
+    {
+        std::memcpy(ptr, local_.data(), size);
+        local_ = {};
+    }
+    else
+    {
+        MPI_Aint root_size{};
+        int disp_unit{};
+        CELER_MPI_CALL(MPI_Win_shared_query(
+            impl_->win, 0, &root_size, &disp_unit, &ptr));
+        CELER_ASSERT(static_cast<unsigned long long>(root_size) == size);
+    }
+
+    // Wait for the root to finish writing
+    CELER_MPI_CALL(MPI_Barrier(impl_->node_comm));
+    data_ = {ptr, static_cast<std::size_t>(size)};
+#else
+    CELER_NOT_CONFIGURED("MPI");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free the shared memory window.
+ */
+MpiSharedBuffer::~MpiSharedBuffer() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free the window and communicator.
+ *
+ * This is collective over the node communicator, so all sharing processes
+ * must destroy the buffer. If MPI has already been finalized, the window was
+ * freed during finalization.
+ */
+void MpiSharedBuffer::ImplDeleter::operator()(Impl* impl) const
+{
+#if CELERITAS_USE_MPI
+    if (impl->keyval != MPI_KEYVAL_INVALID && !is_mpi_finalized())
+    {
+        // Deleting the attribute frees the window and communicator
+        MPI_Comm_delete_attr(MPI_COMM_SELF, impl->keyval);
+        MPI_Comm_free_keyval(&impl->keyval);
+    }
+#endif
+    delete impl;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MpiSharedBuffer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+class MpiCommunicator;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read-only data shared between all MPI processes on a node.
+ *
+ * The communicator is split into groups of processes that can share memory
+ * (MPI-3 \c MPI_COMM_TYPE_SHARED ). The lowest rank in each group calls the
+ * given function to create the data, which is copied into a shared memory
+ * window; the other ranks on the node map the same window without calling the
+ * function.
+ *
+ * With a null communicator (or if MPI is disabled) the function is called
+ * and its result is stored privately.
+ *
+ * The shared window is freed when the buffer is destroyed or when MPI is
+ * finalized, whichever comes first, so the buffer may safely outlive \c
+ * ScopedMpiInit (but its data may not be accessed after finalization).
+ *
+ * \code
+    MpiSharedBuffer shared(comm, [&] { return serialize(host_data); });
+    BinaryInArchive ar(shared.data());
+   \endcode
+ */
+class MpiSharedBuffer
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using CreateFunc = std::function<std::string()>;
+    //!@}
+
+  public:
+    // Create on one rank per node and share with the others
+    MpiSharedBuffer(MpiCommunicator const& comm, CreateFunc create);
+
+    // Free the shared memory window
+    ~MpiSharedBuffer();
+
+    //!@{
+    //! Prevent copying and moving
+    MpiSharedBuffer(MpiSharedBuffer const&) = delete;
+    MpiSharedBuffer& operator=(MpiSharedBuffer const&) = delete;
+    //!@}
+
+    //! Access the shared data
+    Span<char const> data() const { return data_; }
+
+    //! Number of processes sharing the data
+    int num_sharing() const { return num_sharing_; }
+
+    // Node communicator and shared memory window
+    struct Impl;
+
+  private:
+    struct ImplDeleter
+    {
+        void operator()(Impl*) const;
+    };
+
+    std::unique_ptr<Impl, ImplDeleter> impl_;
+    std::string local_;
+    Span<char const> data_;
+    int num_sharing_{1};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,263 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCounters.cc
+//---------------------------------------------------------------------------//
+#include "PerfCounters.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+
+#include "Environment.hh"
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+struct EventType
+{
+    char const* name;
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+#ifdef __linux__
+//---------------------------------------------------------------------------//
+//! Supported event names and their perf_event_open codes
+EventType const event_types[] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+    {"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+    {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"page-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open a counter for the calling thread.
+ *
+ * The first counter in a group is the leader, which starts disabled and
+ * controls the others.
+ */
+int open_counter(EventType const& event, int group_fd)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = (group_fd < 0 ? 1 : 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                       | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(::syscall(SYS_perf_event_open,
+                                      &attr,
+                                      /* pid = */ 0,
+                                      /* cpu = */ -1,
+                                      group_fd,
+                                      /* flags = */ 0ul));
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get counter names from the CELER_PERF_COUNTERS environment variable.
+ *
+ * The variable is a comma-separated list of event names, e.g.
+ * \c cycles,instructions,cache-misses . An empty result disables counting.
+ */
+auto PerfCounters::names_from_environment() -> VecString
+{
+    VecString result;
+    std::istringstream is(celeritas::getenv("CELER_PERF_COUNTERS"));
+    std::string name;
+    while (std::getline(is, name, ','))
+    {
+        if (!name.empty())
+        {
+            result.push_back(std::move(name));
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with event names.
+ *
+ * Unknown event names are an error. Counting is disabled later if any
+ * thread's counter group fails to open.
+ */
+PerfCounters::PerfCounters(VecString names) : names_(std::move(names))
+{
+    CELER_EXPECT(!names_.empty());
+#ifdef __linux__
+    for (auto const& name : names_)
+    {
+        CELER_VALIDATE(std::any_of(std::begin(event_types),
+                                   std::end(event_types),
+                                   [&name](EventType const& e) {
+                                       return name == e.name;
+                                   }),
+                       << "unknown performance counter '" << name << "'");
+    }
+    enabled_ = true;
+#else
+    CELER_LOG(warning) << "Performance counters are only available on Linux";
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close counters.
+ */
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (auto const& fds : groups_)
+    {
+        for (int fd : fds)
+        {
+            ::close(fd);
+        }
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open a counter group for the calling thread.
+ *
+ * If the counters can't be opened, a warning is printed and counting is
+ * disabled for all threads.
+ */
+void PerfCounters::add_thread()
+{
+#ifdef __linux__
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    if (!enabled_)
+    {
+        return;
+    }
+
+    std::vector<int> fds;
+    for (auto const& name : names_)
+    {
+        auto event = std::find_if(
+            std::begin(event_types),
+            std::end(event_types),
+            [&name](EventType const& e) { return name == e.name; });
+        CELER_ASSERT(event != std::end(event_types));
+
+        int fd = open_counter(*event, fds.empty() ? -1 : fds.front());
+        if (fd < 0)
+        {
+            int err = errno;
+            CELER_LOG(warning)
+                << "Disabling performance counters: failed to open '"
+                << name << "': " << std::strerror(err)
+                << (err == EACCES || err == EPERM
+                        ? " (check /proc/sys/kernel/perf_event_paranoid)"
+                        : "");
+            for (int other : fds)
+            {
+                ::close(other);
+            }
+            enabled_ = false;
+            return;
+        }
+        fds.push_back(fd);
+    }
+    groups_.push_back(std::move(fds));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset and start counting on all threads.
+ */
+void PerfCounters::start()
+{
+#ifdef __linux__
+    if (!enabled_)
+    {
+        return;
+    }
+    for (auto const& fds : groups_)
+    {
+        ::ioctl(fds.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop counting and add the total over all threads.
+ *
+ * If the kernel had to multiplex the counters, the values are scaled by the
+ * fraction of time the group was active.
+ */
+void PerfCounters::stop(VecCount* accum)
+{
+    CELER_EXPECT(accum && accum->size() == names_.size());
+#ifdef __linux__
+    if (!enabled_)
+    {
+        return;
+    }
+    for (auto const& fds : groups_)
+    {
+        ::ioctl(fds.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    // Group format: number of events, enabled/running time, values
+    std::vector<std::uint64_t> buffer(3 + names_.size());
+    for (auto const& fds : groups_)
+    {
+        auto nbytes = ::read(
+            fds.front(), buffer.data(), buffer.size() * sizeof(std::uint64_t));
+        if (nbytes != static_cast<decltype(nbytes)>(buffer.size()
+                                                    * sizeof(std::uint64_t))
+            || buffer[2] == 0)
+        {
+            // Group didn't run (e.g. the thread exited)
+            continue;
+        }
+        double scale = static_cast<double>(buffer[1]) / buffer[2];
+        for (auto i : range(names_.size()))
+        {
+            (*accum)[i] += static_cast<unsigned long long>(
+                static_cast<double>(buffer[3 + i]) * scale);
+        }
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
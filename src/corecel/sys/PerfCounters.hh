@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCounters.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read hardware performance counters for a set of threads.
+ *
+ * This uses the Linux \c perf_event_open interface to count user-space events
+ * such as cycles, instructions, cache misses, and branch mispredictions.
+ * Each thread that should be measured must call \c add_thread to open a
+ * counter group for itself; afterward, any thread can start and stop the
+ * counters and read the sum over all registered threads.
+ *
+ * Supported event names are:
+ * - \c cycles
+ * - \c instructions
+ * - \c cache-references
+ * - \c cache-misses
+ * - \c branches
+ * - \c branch-misses
+ * - \c page-faults
+ *
+ * If the kernel disallows access (see \c /proc/sys/kernel/perf_event_paranoid
+ * ), the hardware has no performance monitoring unit, or the platform isn't
+ * Linux, a warning is printed and the counters are disabled. Counts are
+ * scaled if the kernel multiplexes the counter group.
+ *
+ * \code
+   PerfCounters counters({"cycles", "instructions"});
+   counters.add_thread();
+   PerfCounters::VecCount accum(counters.names().size());
+   counters.start();
+   do_work();
+   counters.stop(&accum);
+   \endcode
+ */
+class PerfCounters
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecString = std::vector<std::string>;
+    using VecCount = std::vector<unsigned long long>;
+    //!@}
+
+  public:
+    // Get counter names from the CELER_PERF_COUNTERS environment variable
+    static VecString names_from_environment();
+
+    // Construct with event names
+    explicit PerfCounters(VecString names);
+
+    // Close counters
+    ~PerfCounters();
+
+    //!@{
+    //! Prevent copying and moving
+    PerfCounters(PerfCounters const&) = delete;
+    PerfCounters& operator=(PerfCounters const&) = delete;
+    //!@}
+
+    //! Whether counters are available
+    explicit operator bool() const { return enabled_; }
+
+    //! Names of the events being counted
+    VecString const& names() const { return names_; }
+
+    //! Number of threads being counted
+    size_type num_threads() const { return groups_.size(); }
+
+    // Open a counter group for the calling thread
+    void add_thread();
+
+    // Reset and start counting on all threads
+    void start();
+
+    // Stop counting and add the total over all threads
+    void stop(VecCount* accum);
+
+  private:
+    VecString names_;
+    bool enabled_{false};
+    std::mutex mutex_;
+    std::vector<std::vector<int>> groups_;  //!< File descriptors per thread
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,291 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/TraceRecorder.cc
+//---------------------------------------------------------------------------//
+#include "TraceRecorder.hh"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+#include "corecel/Assert.hh"
+
+#include "Environment.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Unique identifier for each recorder instance
+std::atomic<std::uint64_t> next_serial{1};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a JSON string, escaping special characters.
+ */
+void write_json_string(std::ostream& os, char const* str)
+{
+    os << '"';
+    for (char const* c = str; *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"':
+            case '\\':
+                os << '\\' << *c;
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            default:
+                os << *c;
+        }
+    }
+    os << '"';
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a time in nanoseconds as fractional microseconds.
+ */
+void write_us(std::ostream& os, std::int64_t ns)
+{
+    char fill = os.fill('0');
+    os << ns / 1000 << '.' << std::setw(3) << ns % 1000;
+    os.fill(fill);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Events recorded by a single thread.
+ */
+struct TraceRecorder::ThreadEvents
+{
+    size_type tid;
+    std::vector<TraceEvent> events;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct disabled.
+ */
+TraceRecorder::TraceRecorder()
+    : serial_(next_serial.fetch_add(1)), epoch_(Clock::now())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write to the output file if one was set.
+ *
+ * Since this may be called during static destruction, errors are reported
+ * to \c std::cerr rather than to the logger.
+ */
+TraceRecorder::~TraceRecorder()
+{
+    if (filename_.empty())
+    {
+        return;
+    }
+    try
+    {
+        std::ofstream outf(filename_);
+        CELER_VALIDATE(outf,
+                       << "failed to open trace file '" << filename_ << "'");
+        this->write(outf);
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << "celeritas: failed to write trace: " << e.what()
+                  << std::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start recording events, optionally writing them to a file at exit.
+ */
+void TraceRecorder::start(std::string filename)
+{
+    if (!filename.empty())
+    {
+        std::lock_guard<std::mutex> scoped_lock(mutex_);
+        filename_ = std::move(filename);
+    }
+    enabled_.store(true);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop recording events.
+ *
+ * Events already recorded are kept.
+ */
+void TraceRecorder::stop()
+{
+    enabled_.store(false);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add an event from the current thread.
+ */
+void TraceRecorder::record(TraceEvent&& event)
+{
+    CELER_EXPECT(event.category);
+    CELER_EXPECT(event.num_args <= TraceEvent::max_args);
+    this->thread_events().events.push_back(std::move(event));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time since construction [ns].
+ */
+std::int64_t TraceRecorder::now() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now()
+                                                                - epoch_)
+        .count();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total number of recorded events.
+ */
+size_type TraceRecorder::size() const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    size_type result = 0;
+    for (auto const& thread : threads_)
+    {
+        result += thread->events.size();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove all recorded events.
+ */
+void TraceRecorder::clear()
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    for (auto& thread : threads_)
+    {
+        thread->events.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write Chrome trace-event JSON.
+ *
+ * Each event is a "complete" event with the start time and duration in
+ * microseconds. Threads are numbered in the order of their first event.
+ */
+void TraceRecorder::write(std::ostream& os) const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+
+    char const* sep = "\n";
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (auto const& thread : threads_)
+    {
+        os << sep << R"({"name":"thread_name","ph":"M","pid":0,"tid":)"
+           << thread->tid << R"(,"args":{"name":"thread )" << thread->tid
+           << "\"}}";
+        sep = ",\n";
+
+        for (TraceEvent const& event : thread->events)
+        {
+            os << sep << "{\"name\":";
+            write_json_string(os, event.name.c_str());
+            os << ",\"cat\":";
+            write_json_string(os, event.category);
+            os << R"(,"ph":"X","pid":0,"tid":)" << thread->tid << ",\"ts\":";
+            write_us(os, event.begin);
+            os << ",\"dur\":";
+            write_us(os, event.duration);
+            if (event.num_args > 0)
+            {
+                os << ",\"args\":{";
+                for (size_type i = 0; i < event.num_args; ++i)
+                {
+                    if (i > 0)
+                    {
+                        os << ',';
+                    }
+                    write_json_string(os, event.args[i].first);
+                    os << ':' << event.args[i].second;
+                }
+                os << '}';
+            }
+            os << '}';
+        }
+    }
+    os << "\n]}\n";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the events buffer for the current thread, creating it if needed.
+ *
+ * Each thread caches its buffer for every recorder it has used, keyed on the
+ * recorder's unique serial number so that a new recorder at the address of a
+ * destroyed one isn't confused with it.
+ */
+auto TraceRecorder::thread_events() -> ThreadEvents&
+{
+    struct Cache
+    {
+        std::uint64_t serial{0};
+        ThreadEvents* events{nullptr};
+    };
+    static thread_local std::vector<Cache> caches;
+
+    for (Cache const& cache : caches)
+    {
+        if (cache.serial == serial_)
+        {
+            return *cache.events;
+        }
+    }
+
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    threads_.push_back(std::make_unique<ThreadEvents>());
+    threads_.back()->tid = threads_.size() - 1;
+    caches.push_back({serial_, threads_.back().get()});
+    return *threads_.back();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Global trace recorder.
+ *
+ * The recorder is started if the \c CELER_TRACE_FILE environment variable is
+ * set, and the trace is written to that file at exit.
+ */
+TraceRecorder& trace_recorder()
+{
+    static TraceRecorder* const tr = [] {
+        static TraceRecorder result;
+        std::string const& filename = celeritas::getenv("CELER_TRACE_FILE");
+        if (!filename.empty())
+        {
+            result.start(filename);
+        }
+        return &result;
+    }();
+    return *tr;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
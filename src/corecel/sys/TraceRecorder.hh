@@ -0,0 +1,222 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/TraceRecorder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * A timed region of code on a single thread.
+ *
+ * The category must be a string literal; the name is copied.
+ */
+struct TraceEvent
+{
+    //! Maximum number of integer arguments
+    static constexpr size_type max_args = 4;
+
+    using Arg = std::pair<char const*, long long>;
+
+    char const* category{nullptr};
+    std::string name;
+    std::int64_t begin{0};  //!< Start [ns since recorder construction]
+    std::int64_t duration{0};  //!< [ns]
+    size_type num_args{0};
+    std::array<Arg, max_args> args;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record a timeline of events and write them in Chrome trace-event format.
+ *
+ * The resulting JSON file can be loaded by \c chrome://tracing or
+ * https://ui.perfetto.dev to show the begin/end of each action, track
+ * initialization phase, and step on each thread.
+ *
+ * Host kernel launches additionally record an \c "omp" event on every thread
+ * of the OpenMP team, so that load imbalance within an action is visible.
+ *
+ * Events are recorded into a separate buffer for each thread, so recording is
+ * lock-free after a thread's first event. The recorder must not be written or
+ * cleared while other threads are recording.
+ *
+ * The global recorder is enabled by setting the \c CELER_TRACE_FILE
+ * environment variable to an output filename; the trace is written to that
+ * file when the program exits. When disabled, the cost of a \c ScopedTrace
+ * is a single relaxed atomic load.
+ */
+class TraceRecorder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Clock = std::chrono::steady_clock;
+    //!@}
+
+  public:
+    // Construct disabled
+    TraceRecorder();
+
+    // Write to the output file if one was set
+    ~TraceRecorder();
+
+    //! Whether events are being recorded
+    explicit operator bool() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // Start recording events, optionally writing them to a file at exit
+    void start(std::string filename = {});
+
+    // Stop recording events
+    void stop();
+
+    // Add an event from the current thread
+    void record(TraceEvent&& event);
+
+    // Time since construction [ns]
+    std::int64_t now() const;
+
+    // Total number of recorded events
+    size_type size() const;
+
+    // Remove all recorded events
+    void clear();
+
+    // Write Chrome trace-event JSON
+    void write(std::ostream& os) const;
+
+  private:
+    struct ThreadEvents;
+
+    std::atomic<bool> enabled_{false};
+    std::uint64_t serial_;
+    Clock::time_point epoch_;
+    std::string filename_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadEvents>> threads_;
+
+    ThreadEvents& thread_events();
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the duration of the current scope to the global trace.
+ *
+ * Integer arguments such as the number of active tracks can be added before
+ * the end of the scope.
+ *
+ * \code
+   {
+       ScopedTrace trace("track_init", "initialize_tracks");
+       trace.arg("num_tracks", num_tracks);
+       ...
+   }
+   \endcode
+ */
+class ScopedTrace
+{
+  public:
+    // Start timing if the global trace is enabled
+    inline ScopedTrace(char const* category, char const* name);
+
+    // Record the event
+    inline ~ScopedTrace();
+
+    //!@{
+    //! Prevent copying and moving
+    ScopedTrace(ScopedTrace const&) = delete;
+    ScopedTrace& operator=(ScopedTrace const&) = delete;
+    //!@}
+
+    // Add an integer argument to the event
+    inline void arg(char const* key, long long value);
+
+  private:
+    TraceRecorder* recorder_{nullptr};
+    char const* category_;
+    char const* name_;
+    std::int64_t begin_{0};
+    size_type num_args_{0};
+    std::array<TraceEvent::Arg, TraceEvent::max_args> args_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Global trace recorder
+TraceRecorder& trace_recorder();
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing if the global trace is enabled.
+ */
+ScopedTrace::ScopedTrace(char const* category, char const* name)
+    : category_(category), name_(name)
+{
+    TraceRecorder& recorder = trace_recorder();
+    if (recorder)
+    {
+        recorder_ = &recorder;
+        begin_ = recorder.now();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the event.
+ */
+ScopedTrace::~ScopedTrace()
+{
+    if (recorder_)
+    {
+        TraceEvent event;
+        event.category = category_;
+        event.name = name_;
+        event.begin = begin_;
+        event.duration = recorder_->now() - begin_;
+        event.num_args = num_args_;
+        event.args = args_;
+        recorder_->record(std::move(event));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add an integer argument to the event.
+ *
+ * Arguments beyond the maximum are ignored.
+ */
+void ScopedTrace::arg(char const* key, long long value)
+{
+    if (recorder_ && num_args_ < TraceEvent::max_args)
+    {
+        args_[num_args_++] = {key, value};
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -12,9 +12,18 @@
 #include <string>
 #include <vector>
 #include <CLHEP/Units/SystemOfUnits.h>
+#include <G4Box.hh>
 #include <G4LogicalVolume.hh>
 #include <G4LogicalVolumeStore.hh>
+#include <G4Material.hh>
+#include <G4NistManager.hh>
+#include <G4Navigator.hh>
+#include <G4PVParameterised.hh>
+#include <G4PVPlacement.hh>
 #include <G4SDManager.hh>
+#include <G4SmartVoxelHeader.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPVParameterisation.hh>
 #include <G4VSensitiveDetector.hh>
 
 #include "celeritas/SimpleCmsTestBase.hh"
@@ -368,6 +377,99 @@ TEST_F(HitProcessorTest, touchable_midvol)
     }
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(HitProcessorTest, touchable_batched)
+{
+    selection_.points[StepPoint::pre].dir = true;
+    HitProcessor process_hits{detector_volumes(), selection_, true};
+
+    // Interleave a second hit in each detector at a different point
+    auto dso_hits = this->make_dso();
+    dso_hits.detector = {
+        DetectorId{2},
+        DetectorId{0},
+        DetectorId{1},
+        DetectorId{1},
+        DetectorId{2},
+        DetectorId{0},
+    };
+    dso_hits.track_id = {
+        TrackId{0},
+        TrackId{2},
+        TrackId{4},
+        TrackId{5},
+        TrackId{1},
+        TrackId{3},
+    };
+    dso_hits.energy_deposition = {
+        MevEnergy{0.1},
+        MevEnergy{0.2},
+        MevEnergy{0.3},
+        MevEnergy{0.4},
+        MevEnergy{0.5},
+        MevEnergy{0.6},
+    };
+    dso_hits.points[StepPoint::post].time = {
+        1e-9 * second,
+        2e-10 * second,
+        3e-8 * second,
+        4e-8 * second,
+        5e-9 * second,
+        6e-10 * second,
+    };
+    dso_hits.points[StepPoint::pre].pos = {
+        {100, 0, 0},
+        {0, 150, 10},
+        {0, 200, -20},
+        {0, -250, 30},
+        {0, -50, 5},
+        {-160, 0, 0},
+    };
+    dso_hits.points[StepPoint::pre].dir = {
+        {1, 0, 0},
+        {0, 1, 0},
+        {0, 0, -1},
+        {0, -1, 0},
+        {0, 0, 1},
+        {-1, 0, 0},
+    };
+    process_hits(dso_hits);
+
+    {
+        auto& result = this->get_hits("si_tracker");
+        static double const expected_energy_deposition[] = {0.1, 0.5};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+        static double const expected_pre_pos[] = {100, 0, 0, 0, -50, 5};
+        EXPECT_VEC_SOFT_EQ(expected_pre_pos, result.pre_pos);
+        static char const* const expected_pre_physvol[]
+            = {"si_tracker_pv", "si_tracker_pv"};
+        EXPECT_VEC_EQ(expected_pre_physvol, result.pre_physvol);
+    }
+    {
+        auto& result = this->get_hits("em_calorimeter");
+        static double const expected_energy_deposition[] = {0.2, 0.6};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+        static double const expected_post_time[] = {0.2, 0.6};
+        EXPECT_VEC_SOFT_EQ(expected_post_time, result.post_time);
+        static char const* const expected_pre_physvol[]
+            = {"em_calorimeter_pv", "em_calorimeter_pv"};
+        EXPECT_VEC_EQ(expected_pre_physvol, result.pre_physvol);
+    }
+    {
+        auto& result = this->get_hits("had_calorimeter");
+        static double const expected_energy_deposition[] = {0.3, 0.4};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+        static double const expected_pre_pos[] = {0, 200, -20, 0, -250, 30};
+        EXPECT_VEC_SOFT_EQ(expected_pre_pos, result.pre_pos);
+        static char const* const expected_pre_physvol[]
+            = {"had_calorimeter_pv", "had_calorimeter_pv"};
+        EXPECT_VEC_EQ(expected_pre_physvol, result.pre_physvol);
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(HitProcessorTest, touchable_edgecase)
 {
@@ -417,6 +519,202 @@ TEST_F(HitProcessorTest, touchable_edgecase)
     }
 }
 
+//---------------------------------------------------------------------------//
+// PARAMETERISED DETECTOR
+//---------------------------------------------------------------------------//
+/*!
+ * Two boxes along x with different widths sharing one solid.
+ *
+ * Copy 0 spans [-25, -15] cm and copy 1 spans [-13, 23] cm.
+ */
+class TwoBoxParameterisation final : public G4VPVParameterisation
+{
+  public:
+    void ComputeTransformation(G4int const copy,
+                               G4VPhysicalVolume* pv) const final
+    {
+        pv->SetTranslation(
+            G4ThreeVector((copy == 0 ? -20 : 5) * CLHEP::cm, 0, 0));
+    }
+
+    void ComputeDimensions(G4Box& box,
+                           G4int const copy,
+                           G4VPhysicalVolume const*) const final
+    {
+        box.SetXHalfLength((copy == 0 ? 5 : 18) * CLHEP::cm);
+        box.SetYHalfLength(5 * CLHEP::cm);
+        box.SetZHalfLength(5 * CLHEP::cm);
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Record the copy number of every hit
+class CopyNumberDetector final : public G4VSensitiveDetector
+{
+  public:
+    explicit CopyNumberDetector(std::string const& name)
+        : G4VSensitiveDetector(name)
+    {
+    }
+
+    //! Pre-step copy number of each hit
+    std::vector<int> const& copy_number() const { return copy_number_; }
+
+    //! Reset hits between tests
+    void clear() { copy_number_.clear(); }
+
+  protected:
+    bool ProcessHits(G4Step* step, G4TouchableHistory*) final
+    {
+        CELER_EXPECT(step);
+        auto* touchable = step->GetPreStepPoint()->GetTouchable();
+        copy_number_.push_back(touchable ? touchable->GetCopyNumber() : -1);
+        return true;
+    }
+
+  private:
+    std::vector<int> copy_number_;
+};
+
+//---------------------------------------------------------------------------//
+class ParameterisedHitProcessorTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecLV = std::vector<G4LogicalVolume*>;
+
+    void SetUp() override
+    {
+        // Navigate in the parameterised geometry
+        G4Navigator* navi = G4TransportationManager::GetTransportationManager()
+                                ->GetNavigatorForTracking();
+        orig_world_ = navi->GetWorldVolume();
+        navi->SetWorldVolume(world());
+        detector()->clear();
+
+        selection_.energy_deposition = true;
+        selection_.points[StepPoint::pre].pos = true;
+        selection_.points[StepPoint::pre].dir = true;
+    }
+
+    void TearDown() override
+    {
+        G4TransportationManager::GetTransportationManager()
+            ->GetNavigatorForTracking()
+            ->SetWorldVolume(orig_world_);
+    }
+
+    //! Single hit along +x at the given x [cm]
+    static DetectorStepOutput make_dso(real_type x)
+    {
+        DetectorStepOutput dso;
+        dso.detector = {DetectorId{0}};
+        dso.track_id = {TrackId{0}};
+        dso.energy_deposition = {MevEnergy{0.1}};
+        dso.points[StepPoint::pre].pos = {{x, 0, 0}};
+        dso.points[StepPoint::pre].dir = {{1, 0, 0}};
+        return dso;
+    }
+
+    static G4VPhysicalVolume* world();
+    static G4LogicalVolume*& detector_volume();
+    static CopyNumberDetector*& detector();
+
+    StepSelection selection_;
+    G4VPhysicalVolume* orig_world_{nullptr};
+};
+
+//---------------------------------------------------------------------------//
+auto ParameterisedHitProcessorTest::detector_volume() -> G4LogicalVolume*&
+{
+    // Owned by the logical volume store
+    static G4LogicalVolume* lv{nullptr};
+    return lv;
+}
+
+//---------------------------------------------------------------------------//
+auto ParameterisedHitProcessorTest::detector() -> CopyNumberDetector*&
+{
+    // Owned by the SD manager
+    static CopyNumberDetector* sd{nullptr};
+    return sd;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build a world with a parameterised sensitive detector on first use.
+ *
+ * Volumes and solids are owned by the Geant4 stores.
+ */
+G4VPhysicalVolume* ParameterisedHitProcessorTest::world()
+{
+    static G4VPhysicalVolume* world_pv{nullptr};
+    if (world_pv)
+    {
+        return world_pv;
+    }
+
+    using CLHEP::cm;
+    G4Material* vacuum
+        = G4NistManager::Instance()->FindOrBuildMaterial("G4_Galactic");
+    CELER_ASSERT(vacuum);
+
+    auto* world_lv = new G4LogicalVolume(
+        new G4Box("param_world", 100 * cm, 100 * cm, 100 * cm),
+        vacuum,
+        "param_world");
+    world_pv = new G4PVPlacement(
+        nullptr, {}, world_lv, "param_world_pv", nullptr, false, 0);
+
+    auto* mother_lv = new G4LogicalVolume(
+        new G4Box("param_mother", 40 * cm, 10 * cm, 10 * cm),
+        vacuum,
+        "param_mother");
+    new G4PVPlacement(
+        nullptr, {}, mother_lv, "param_mother_pv", world_lv, false, 0);
+
+    static TwoBoxParameterisation param;
+    auto*& det_lv = detector_volume();
+    det_lv = new G4LogicalVolume(
+        new G4Box("param_det", 5 * cm, 5 * cm, 5 * cm), vacuum, "param_det");
+    new G4PVParameterised(
+        "param_det_pv", det_lv, mother_lv, kXAxis, 2, &param);
+
+    // Parameterised daughters are navigated with voxels
+    mother_lv->SetVoxelHeader(new G4SmartVoxelHeader(mother_lv));
+
+    auto sd = std::make_unique<CopyNumberDetector>("param_det");
+    det_lv->SetSensitiveDetector(sd.get());
+    detector() = sd.get();
+    G4SDManager::GetSDMpointer()->AddNewDetector(sd.release());
+
+    return world_pv;
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(ParameterisedHitProcessorTest, shared_solid)
+{
+    // Each processor has its own navigator, but they share the
+    // parameterised solid
+    VecLV dv{detector_volume()};
+    HitProcessor process_a{dv, selection_, true};
+    HitProcessor process_b{dv, selection_, true};
+
+    auto dso_hits = this->make_dso(-20);
+    process_a(dso_hits);
+
+    // Locating copy 1 widens the shared box
+    dso_hits = this->make_dso(5);
+    process_b(dso_hits);
+
+    // This point is in copy 1 but would be inside copy 0 if the widened box
+    // were used with copy 0's transform
+    dso_hits = this->make_dso(-10);
+    process_a(dso_hits);
+
+    static int const expected_copy_number[] = {0, 1, 1};
+    EXPECT_VEC_EQ(expected_copy_number, detector()->copy_number());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail
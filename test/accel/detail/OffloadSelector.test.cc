@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadSelector.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/OffloadSelector.hh"
+
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <G4DynamicParticle.hh>
+#include <G4Electron.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4Region.hh>
+#include <G4RegionStore.hh>
+#include <G4ThreeVector.hh>
+#include <G4Track.hh>
+
+#include "celeritas/io/ImportData.hh"
+#include "accel/SetupOptions.hh"
+
+#include "celeritas/SimpleCmsTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class OffloadSelectorTest : public ::celeritas::test::SimpleCmsTestBase
+{
+  protected:
+    void SetUp() override
+    {
+        // Make sure the Geant4 geometry and particles are loaded
+        ASSERT_FALSE(this->imported_data().particles.empty());
+    }
+
+    //! Whether an unlocated electron along +x is selected
+    bool select(OffloadSelector const& selector, double radius, double energy)
+    {
+        // The track takes ownership of the dynamic particle
+        G4Track track(new G4DynamicParticle(G4Electron::Definition(),
+                                            G4ThreeVector(1, 0, 0),
+                                            energy * CLHEP::MeV),
+                      0.0,
+                      G4ThreeVector(radius * CLHEP::cm, 0, 0));
+        EXPECT_EQ(nullptr, track.GetVolume());
+        return selector(track);
+    }
+
+    // Get a region whose only root volume is the EM calorimeter
+    static char const* calorimeter_region();
+};
+
+//---------------------------------------------------------------------------//
+char const* OffloadSelectorTest::calorimeter_region()
+{
+    static char const name[] = "calorimeter";
+    if (!G4RegionStore::GetInstance()->GetRegion(name, false))
+    {
+        G4LogicalVolume* calo = nullptr;
+        for (G4LogicalVolume* lv : *G4LogicalVolumeStore::GetInstance())
+        {
+            if (lv->GetName() == "em_calorimeter")
+            {
+                calo = lv;
+            }
+        }
+        CELER_VALIDATE(calo, << "failed to find calorimeter volume");
+
+        // Region is owned by the region store
+        auto* region = new G4Region(name);
+        region->AddRootLogicalVolume(calo);
+    }
+    return name;
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(OffloadSelectorTest, all)
+{
+    OffloadSelector select_all{SetupOptions{}};
+    EXPECT_TRUE(this->select(select_all, 0, 1e-3));
+    EXPECT_TRUE(this->select(select_all, 150, 10));
+    EXPECT_TRUE(this->select(OffloadSelector{}, 1e5, 10));
+}
+
+TEST_F(OffloadSelectorTest, energy)
+{
+    SetupOptions options;
+    options.min_offload_energy = 1;
+    OffloadSelector select{options};
+    EXPECT_FALSE(this->select(select, 0, 0.5));
+    EXPECT_TRUE(this->select(select, 0, 1.0));
+    EXPECT_TRUE(this->select(select, 0, 2.0));
+
+    options.min_offload_energy = -1;
+    EXPECT_THROW(OffloadSelector{options}, RuntimeError);
+}
+
+TEST_F(OffloadSelectorTest, volume)
+{
+    SetupOptions options;
+    options.offload_volumes = {"si_tracker", "had_calorimeter"};
+    OffloadSelector select{options};
+
+    // Unlocated primaries are found with the navigator
+    EXPECT_FALSE(this->select(select, 10, 1));  // vacuum_tube
+    EXPECT_TRUE(this->select(select, 50, 1));  // si_tracker
+    EXPECT_FALSE(this->select(select, 150, 1));  // em_calorimeter
+    EXPECT_TRUE(this->select(select, 200, 1));  // had_calorimeter
+    EXPECT_FALSE(this->select(select, 1e5, 1));  // outside world
+}
+
+TEST_F(OffloadSelectorTest, region)
+{
+    SetupOptions options;
+    options.offload_regions = {calorimeter_region()};
+    options.min_offload_energy = 1;
+    OffloadSelector select{options};
+
+    EXPECT_FALSE(this->select(select, 50, 10));
+    EXPECT_TRUE(this->select(select, 150, 10));
+    EXPECT_FALSE(this->select(select, 150, 0.1));
+    EXPECT_FALSE(this->select(select, 200, 10));
+}
+
+TEST_F(OffloadSelectorTest, unknown_names)
+{
+    SetupOptions options;
+    options.offload_volumes = {"si_tracker", "flux_capacitor"};
+    EXPECT_THROW(OffloadSelector{options}, RuntimeError);
+
+    options.offload_volumes.clear();
+    options.offload_regions = {"bermuda_triangle"};
+    EXPECT_THROW(OffloadSelector{options}, RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
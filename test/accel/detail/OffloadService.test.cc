@@ -0,0 +1,321 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadService.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/OffloadService.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4SDManager.hh>
+#include <G4Step.hh>
+#include <G4VSensitiveDetector.hh>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/StepCollector.hh"
+#include "accel/SetupOptions.hh"
+#include "accel/detail/HitManager.hh"
+
+#include "celeritas/SimpleCmsTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+//! Record the pre-step energy of every hit
+class EnergySensitiveDetector final : public G4VSensitiveDetector
+{
+  public:
+    explicit EnergySensitiveDetector(std::string const& name)
+        : G4VSensitiveDetector(name)
+    {
+    }
+
+    //! Pre-step kinetic energy of each hit [MeV]
+    std::vector<double> const& pre_energy() const { return pre_energy_; }
+
+    //! Reset hits between tests
+    void clear() { pre_energy_.clear(); }
+
+  protected:
+    bool ProcessHits(G4Step* step, G4TouchableHistory*) final
+    {
+        CELER_EXPECT(step);
+        pre_energy_.push_back(step->GetPreStepPoint()->GetKineticEnergy()
+                              / CLHEP::MeV);
+        return true;
+    }
+
+  private:
+    std::vector<double> pre_energy_;
+};
+
+//---------------------------------------------------------------------------//
+class OffloadServiceTest : public ::celeritas::test::SimpleCmsTestBase
+{
+  protected:
+    using VecPrimary = std::vector<Primary>;
+    using SPHitManager = std::shared_ptr<HitManager>;
+    using UPService = std::unique_ptr<OffloadService>;
+
+    void SetUp() override
+    {
+        options_.max_num_tracks = 64;
+        options_.initializer_capacity = 4096;
+        options_.num_service_threads = 2;
+    }
+
+    //! Electrons from the origin that stop in the silicon tracker
+    VecPrimary
+    make_primaries(EventId event, size_type count, double energy = 1.0)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::electron());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{energy};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+        p.event_id = event;
+
+        VecPrimary result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].track_id = TrackId{i};
+        }
+        return result;
+    }
+
+    UPService make_service(size_type num_workers, SPHitManager hits = {})
+    {
+        return std::make_unique<OffloadService>(
+            options_, this->core(), std::move(hits), num_workers);
+    }
+
+    // Attach a sensitive detector to the silicon tracker
+    SPHitManager make_hit_manager(size_type num_workers);
+
+    static EnergySensitiveDetector*& detector();
+
+    SetupOptions options_;
+    std::shared_ptr<StepCollector> collector_;
+};
+
+//---------------------------------------------------------------------------//
+auto OffloadServiceTest::detector() -> EnergySensitiveDetector*&
+{
+    // Non-owning pointer
+    static EnergySensitiveDetector* sd{nullptr};
+    return sd;
+}
+
+//---------------------------------------------------------------------------//
+auto OffloadServiceTest::make_hit_manager(size_type num_workers)
+    -> SPHitManager
+{
+    EnergySensitiveDetector*& sd = detector();
+    if (!sd)
+    {
+        G4LogicalVolumeStore* lv_store = G4LogicalVolumeStore::GetInstance();
+        CELER_ASSERT(lv_store);
+        for (G4LogicalVolume* lv : *lv_store)
+        {
+            CELER_ASSERT(lv);
+            if (lv->GetName() != "si_tracker")
+                continue;
+
+            auto temp = std::make_unique<EnergySensitiveDetector>("si");
+            lv->SetSensitiveDetector(temp.get());
+            sd = temp.get();
+            G4SDManager::GetSDMpointer()->AddNewDetector(temp.release());
+        }
+        CELER_VALIDATE(sd, << "failed to find tracker volume");
+    }
+    sd->clear();
+
+    SDSetupOptions sd_options;
+    sd_options.enabled = true;
+    sd_options.pre.kinetic_energy = true;
+    auto result = std::make_shared<HitManager>(*this->geometry(),
+                                               sd_options,
+                                               options_.num_service_threads,
+                                               num_workers);
+    collector_ = std::make_shared<StepCollector>(
+        StepCollector::VecInterface{result},
+        this->geometry(),
+        options_.num_service_threads,
+        this->action_reg().get());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(OffloadServiceTest, multiple_producers)
+{
+    size_type const num_workers = 4;
+    size_type const num_events = 3;
+    auto service = this->make_service(num_workers);
+
+    // Each worker pushes several batches per event and flushes its event
+    std::atomic<size_type> num_flushed{0};
+    std::vector<std::string> errors(num_workers);
+    std::vector<std::thread> workers;
+    for (auto w : range(num_workers))
+    {
+        workers.emplace_back([&, w] {
+            try
+            {
+                for (auto e : range(num_events))
+                {
+                    EventId event{w * num_events + e};
+                    for (size_type batch = 0; batch < 3; ++batch)
+                    {
+                        service->push(w, this->make_primaries(event, 4));
+                    }
+                    service->flush(w, event);
+                    ++num_flushed;
+                }
+            }
+            catch (std::exception const& err)
+            {
+                errors[w] = err.what();
+            }
+        });
+    }
+    for (std::thread& t : workers)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(std::vector<std::string>(num_workers), errors);
+    EXPECT_EQ(num_workers * num_events, num_flushed.load());
+    service->stop();
+    EXPECT_THROW(service->push(0, this->make_primaries(EventId{100}, 1)),
+                 RuntimeError);
+}
+
+TEST_F(OffloadServiceTest, hit_routing)
+{
+    auto hits = this->make_hit_manager(2);
+    auto service = this->make_service(2, hits);
+    auto const& pre_energy = detector()->pre_energy();
+
+    // Workers have distinguishable primary energies
+    service->push(0, this->make_primaries(EventId{0}, 4, 1.0));
+    service->push(1, this->make_primaries(EventId{1}, 4, 2.0));
+
+    // Only hits from the first worker's event are processed
+    service->flush(0, EventId{0});
+    EXPECT_FALSE(hits->has_deferred(EventId{0}));
+    ASSERT_FALSE(pre_energy.empty());
+    size_type num_first = pre_energy.size();
+    for (double e : pre_energy)
+    {
+        EXPECT_LE(e, 1.0);
+    }
+
+    // The second worker's hits are processed by its own flush
+    service->flush(1, EventId{1});
+    EXPECT_FALSE(hits->has_deferred(EventId{1}));
+    ASSERT_LT(num_first, pre_energy.size());
+    double max_energy = 0;
+    for (auto i : range(num_first, pre_energy.size()))
+    {
+        max_energy = std::max(max_energy, pre_energy[i]);
+    }
+    EXPECT_LT(1.0, max_energy);
+    EXPECT_LE(max_energy, 2.0);
+}
+
+TEST_F(OffloadServiceTest, flush_per_event)
+{
+    auto hits = this->make_hit_manager(1);
+    auto service = this->make_service(1, hits);
+    auto const& pre_energy = detector()->pre_energy();
+
+    // A worker has batches from two events in flight
+    service->push(0, this->make_primaries(EventId{0}, 8, 1.0));
+    service->push(0, this->make_primaries(EventId{1}, 8, 2.0));
+
+    // Flushing an event with no batches doesn't process other events' hits
+    service->flush(0, EventId{2});
+    EXPECT_TRUE(pre_energy.empty());
+
+    // Flushing the second event processes only its hits
+    service->flush(0, EventId{1});
+    EXPECT_FALSE(hits->has_deferred(EventId{1}));
+    size_type num_second = pre_energy.size();
+    ASSERT_LT(0, num_second);
+    EXPECT_LT(1.0, *std::max_element(pre_energy.begin(), pre_energy.end()));
+
+    service->flush(0, EventId{0});
+    EXPECT_FALSE(hits->has_deferred(EventId{0}));
+    EXPECT_LT(num_second, pre_energy.size());
+    for (auto i : range(num_second, pre_energy.size()))
+    {
+        EXPECT_LE(pre_energy[i], 1.0);
+    }
+}
+
+TEST_F(OffloadServiceTest, stop_with_queued)
+{
+    // Transport one small batch at a time
+    options_.num_service_threads = 1;
+    options_.max_num_tracks = 4;
+    auto service = this->make_service(2);
+
+    // Queue more batches than can be transported before stopping
+    for (size_type batch = 0; batch < 200; ++batch)
+    {
+        service->push(0, this->make_primaries(EventId{0}, 4, 10.0));
+    }
+
+    // A worker waiting on the queued event is woken with an error
+    std::string error;
+    std::thread waiting([&] {
+        try
+        {
+            service->flush(0, EventId{0});
+        }
+        catch (RuntimeError const& e)
+        {
+            error = e.what();
+        }
+    });
+    service->stop();
+    waiting.join();
+    EXPECT_NE(std::string::npos, error.find("was stopped before")) << error;
+
+    // Other workers' events are unaffected, and new batches are rejected
+    EXPECT_NO_THROW(service->flush(1, EventId{1}));
+    EXPECT_THROW(service->push(0, this->make_primaries(EventId{2}, 1)),
+                 RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
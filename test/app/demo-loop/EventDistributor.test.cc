@@ -0,0 +1,199 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file app/demo-loop/EventDistributor.test.cc
+//---------------------------------------------------------------------------//
+#include "demo-loop/EventDistributor.hh"
+
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "demo-loop/Transporter.hh"
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+using demo_loop::EventDistribution;
+using demo_loop::EventDistributor;
+using demo_loop::Transporter;
+using demo_loop::TransporterInput;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EventDistributorTest : public Test
+{
+  protected:
+    using VecPrimary = std::vector<Primary>;
+    using VecInt = std::vector<int>;
+
+    void SetUp() override
+    {
+        if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized)
+        {
+            comm_ = MpiCommunicator::comm_world();
+        }
+    }
+
+    //! Source of single-primary events with consecutive IDs
+    EventDistributor::EventSource make_source(size_type num_events)
+    {
+        return [num_events, count = size_type{0}]() mutable -> VecPrimary {
+            if (count == num_events)
+            {
+                return {};
+            }
+            Primary p;
+            p.event_id = EventId{count++};
+            p.track_id = TrackId{0};
+            return {p};
+        };
+    }
+
+    //! Number of processes that returned each event
+    VecInt count_owners(VecInt const& local_events, size_type num_events)
+    {
+        VecInt result(num_events, 0);
+        for (int e : local_events)
+        {
+            result[e] += 1;
+        }
+        if (comm_)
+        {
+            allreduce(comm_, Operation::sum, make_span(result));
+        }
+        return result;
+    }
+
+    //! Read all events owned by this process
+    VecInt read_all(EventDistributor& distribute)
+    {
+        VecInt result;
+        for (auto event = distribute(); !event.empty(); event = distribute())
+        {
+            EXPECT_EQ(1, event.size());
+            result.push_back(event.front().event_id.unchecked_get());
+        }
+        // The input stays exhausted
+        EXPECT_TRUE(distribute().empty());
+        return result;
+    }
+
+    MpiCommunicator comm_;
+};
+
+class EventDistributorTransportTest : public SimpleTestBase
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventDistributorTest, round_robin)
+{
+    size_type const num_events = 10;
+    EventDistributor distribute(
+        comm_, this->make_source(num_events), EventDistribution::round_robin);
+    auto events = this->read_all(distribute);
+    EXPECT_EQ(events.size(), distribute.num_events());
+
+    // Events are assigned statically in order
+    int const size = comm_ ? comm_.size() : 1;
+    int const rank = comm_ ? comm_.rank() : 0;
+    for (auto i : range(events.size()))
+    {
+        EXPECT_EQ(static_cast<int>(i) * size + rank, events[i]);
+    }
+    EXPECT_VEC_EQ(VecInt(num_events, 1),
+                  this->count_owners(events, num_events));
+}
+
+TEST_F(EventDistributorTest, dynamic)
+{
+    size_type const num_events = 25;
+    EventDistributor distribute(
+        comm_, this->make_source(num_events), EventDistribution::dynamic);
+    auto events = this->read_all(distribute);
+    EXPECT_EQ(events.size(), distribute.num_events());
+
+    // Claimed events are increasing and every event is claimed exactly once
+    for (auto i : range(size_type(1), events.size()))
+    {
+        EXPECT_LT(events[i - 1], events[i]);
+    }
+    EXPECT_VEC_EQ(VecInt(num_events, 1),
+                  this->count_owners(events, num_events));
+}
+
+TEST_F(EventDistributorTransportTest, dynamic)
+{
+    MpiCommunicator comm;
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized)
+    {
+        comm = MpiCommunicator::comm_world();
+    }
+
+    // Events of four photons each
+    size_type const num_events = 12;
+    auto read_event = [this, num_events, count = size_type{0}]() mutable {
+        std::vector<Primary> result;
+        if (count == num_events)
+        {
+            return result;
+        }
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.energy = units::MevEnergy{10.0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+        p.event_id = EventId{count++};
+        for (auto i : range(size_type{4}))
+        {
+            p.track_id = TrackId{i};
+            result.push_back(p);
+        }
+        return result;
+    };
+    EventDistributor distribute(
+        comm, std::move(read_event), EventDistribution::dynamic);
+
+    TransporterInput inp;
+    inp.params = this->core();
+    inp.num_track_slots = 8;
+    inp.max_steps = 10000;
+    inp.enable_diagnostics = false;
+    Transporter<MemSpace::host> transport(std::move(inp));
+
+    // Events are claimed as track slots free up
+    auto result = transport([&distribute] { return distribute(); });
+    ASSERT_FALSE(result.alive.empty());
+    EXPECT_EQ(0, result.alive.back());
+    EXPECT_EQ(0, result.initializers.back());
+
+    // Every event was transported by exactly one process
+    size_type total = distribute.num_events();
+    if (comm)
+    {
+        total = allreduce(comm, Operation::sum, total);
+    }
+    EXPECT_EQ(num_events, total);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,199 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file app/demo-loop/EventPipeline.test.cc
+//---------------------------------------------------------------------------//
+#include "demo-loop/EventPipeline.hh"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Assert.hh"
+
+#include "celeritas_test.hh"
+
+using demo_loop::EventPipeline;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+/*!
+ * Generate a fixed number of events with one primary per event ID.
+ *
+ * The number of calls is tracked so that the test can wait for the reader
+ * thread.
+ */
+class CountingSource
+{
+  public:
+    using VecPrimary = EventPipeline::VecPrimary;
+
+    CountingSource(size_type num_events, size_type throw_at)
+        : num_events_(num_events), throw_at_(throw_at)
+    {
+    }
+
+    // Read the next event on the background thread
+    VecPrimary operator()()
+    {
+        size_type event;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            event = num_calls_++;
+        }
+        called_.notify_all();
+
+        CELER_VALIDATE(event != throw_at_, << "failed to read event " << event);
+        if (event >= num_events_)
+        {
+            return {};
+        }
+        Primary p;
+        p.event_id = EventId{event};
+        p.track_id = TrackId{0};
+        return {p};
+    }
+
+    // Wait until the source has been called the given number of times
+    bool wait_for_calls(size_type count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return called_.wait_for(lock, std::chrono::seconds(10), [&] {
+            return num_calls_ >= count;
+        });
+    }
+
+    // Number of times the source has been called
+    size_type num_calls()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_calls_;
+    }
+
+  private:
+    size_type num_events_;
+    size_type throw_at_;
+    std::mutex mutex_;
+    std::condition_variable called_;
+    size_type num_calls_{0};
+};
+
+class EventPipelineTest : public Test
+{
+  protected:
+    //! Wrap a source that outlives the pipeline
+    static EventPipeline::EventSource wrap(CountingSource* source)
+    {
+        return [source] { return (*source)(); };
+    }
+
+    static constexpr size_type no_throw()
+    {
+        return static_cast<size_type>(-1);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventPipelineTest, ordering)
+{
+    CountingSource source(20, no_throw());
+    EventPipeline next_event(wrap(&source), 3);
+    EXPECT_EQ(3, next_event.max_queued());
+
+    std::vector<size_type> event_ids;
+    for (auto event = next_event(); !event.empty(); event = next_event())
+    {
+        ASSERT_EQ(1, event.size());
+        event_ids.push_back(event.front().event_id.unchecked_get());
+    }
+
+    std::vector<size_type> expected(20);
+    for (size_type i = 0; i < expected.size(); ++i)
+    {
+        expected[i] = i;
+    }
+    EXPECT_VEC_EQ(expected, event_ids);
+}
+
+TEST_F(EventPipelineTest, end_of_input)
+{
+    CountingSource source(2, no_throw());
+    EventPipeline next_event(wrap(&source), 4);
+
+    EXPECT_EQ(1, next_event().size());
+    EXPECT_EQ(1, next_event().size());
+
+    // Every call after the input is exhausted returns the sentinel
+    EXPECT_TRUE(next_event().empty());
+    EXPECT_TRUE(next_event().empty());
+
+    // The source isn't read again after returning an empty event
+    EXPECT_EQ(3, source.num_calls());
+}
+
+TEST_F(EventPipelineTest, reader_exception)
+{
+    CountingSource source(10, 2);
+    EventPipeline next_event(wrap(&source), 4);
+
+    // Events read before the failure are still delivered
+    EXPECT_EQ(1, next_event().size());
+    EXPECT_EQ(1, next_event().size());
+
+    // The error is rethrown once in the consumer, then the input ends
+    EXPECT_THROW(next_event(), RuntimeError);
+    EXPECT_TRUE(next_event().empty());
+    EXPECT_EQ(3, source.num_calls());
+}
+
+TEST_F(EventPipelineTest, queue_bound)
+{
+    size_type const max_queued = 2;
+    CountingSource source(10, no_throw());
+    EventPipeline next_event(wrap(&source), max_queued);
+
+    // The reader fills the queue and then blocks
+    ASSERT_TRUE(source.wait_for_calls(max_queued));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(max_queued, source.num_calls());
+
+    // Popping an event lets exactly one more be read
+    EXPECT_EQ(0, next_event().front().event_id.unchecked_get());
+    ASSERT_TRUE(source.wait_for_calls(max_queued + 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(max_queued + 1, source.num_calls());
+}
+
+TEST_F(EventPipelineTest, early_stop)
+{
+    CountingSource source(100, no_throw());
+    {
+        EventPipeline next_event(wrap(&source), 2);
+        EXPECT_EQ(1, next_event().size());
+        // Destroying the pipeline with a full queue doesn't block
+    }
+    EXPECT_LT(source.num_calls(), 100);
+}
+
+TEST_F(EventPipelineTest, invalid_size)
+{
+    CountingSource source(1, no_throw());
+    EXPECT_THROW(EventPipeline(wrap(&source), 0), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
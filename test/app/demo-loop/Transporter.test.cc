@@ -0,0 +1,158 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file app/demo-loop/Transporter.test.cc
+//---------------------------------------------------------------------------//
+#include "demo-loop/Transporter.hh"
+
+#include <utility>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "demo-loop/EventPipeline.hh"
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+using demo_loop::EventPipeline;
+using demo_loop::Transporter;
+using demo_loop::TransporterInput;
+using demo_loop::TransporterResult;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TransporterTest : public SimpleTestBase
+{
+  protected:
+    using VecPrimary = std::vector<Primary>;
+    using VecVecPrimary = std::vector<VecPrimary>;
+
+    static constexpr size_type num_track_slots() { return 8; }
+
+    VecVecPrimary make_events(size_type num_events, size_type num_primaries)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10.0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        VecVecPrimary result(num_events, VecPrimary(num_primaries, p));
+        for (auto i : range(num_events))
+        {
+            for (auto j : range(num_primaries))
+            {
+                result[i][j].event_id = EventId{i};
+                result[i][j].track_id = TrackId{j};
+            }
+        }
+        return result;
+    }
+
+    Transporter<MemSpace::host> make_transporter()
+    {
+        TransporterInput inp;
+        inp.params = this->core();
+        inp.num_track_slots = num_track_slots();
+        inp.max_steps = 10000;
+        inp.enable_diagnostics = false;
+        return Transporter<MemSpace::host>(std::move(inp));
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TransporterTest, streaming)
+{
+    auto events = this->make_events(6, 4);
+
+    // Transport all primaries at once
+    TransporterResult bulk;
+    {
+        VecPrimary primaries;
+        for (auto const& e : events)
+        {
+            primaries.insert(primaries.end(), e.begin(), e.end());
+        }
+        bulk = this->make_transporter()(make_span(primaries));
+    }
+
+    // Transport events as track slots free up
+    size_type num_reads{0};
+    auto read_event = [&]() -> VecPrimary {
+        if (num_reads == events.size())
+        {
+            return {};
+        }
+        return events[num_reads++];
+    };
+    TransporterResult streamed;
+    {
+        EventPipeline next_event(read_event, 2);
+        streamed = this->make_transporter()(
+            [&next_event] { return next_event(); });
+    }
+
+    // All events were read and every track finished
+    EXPECT_EQ(events.size(), num_reads);
+    ASSERT_FALSE(streamed.alive.empty());
+    EXPECT_EQ(0, streamed.alive.back());
+    EXPECT_EQ(0, streamed.initializers.back());
+
+    // Only enough events to fill the track slots are initially injected
+    EXPECT_EQ(num_track_slots(), streamed.active.front());
+    EXPECT_EQ(num_track_slots(), bulk.active.front());
+    EXPECT_LE(16, bulk.initializers.front());
+    EXPECT_LT(streamed.initializers.front(), bulk.initializers.front());
+}
+
+TEST_F(TransporterTest, reader_exception)
+{
+    auto events = this->make_events(2, 4);
+    size_type num_reads{0};
+    auto read_event = [&]() -> VecPrimary {
+        CELER_VALIDATE(num_reads < events.size(), << "corrupt event");
+        return events[num_reads++];
+    };
+
+    EventPipeline next_event(read_event, 1);
+    auto transport = this->make_transporter();
+    EXPECT_THROW(transport([&next_event] { return next_event(); }),
+                 RuntimeError);
+}
+
+TEST_F(TransporterTest, invalid_events)
+{
+    auto transport = this->make_transporter();
+
+    // No events in the input
+    auto result = transport([] { return VecPrimary{}; });
+    EXPECT_TRUE(result.active.empty());
+
+    // An event larger than the initializer capacity
+    auto events = this->make_events(1, 4097);
+    bool read{false};
+    auto read_event = [&]() -> VecPrimary {
+        return std::exchange(read, true) ? VecPrimary{} : events.front();
+    };
+    EXPECT_THROW(transport(read_event), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
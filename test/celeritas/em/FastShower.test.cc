@@ -0,0 +1,406 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/FastShower.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/em/FastShower.hh"
+
+#include <cmath>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/em/detail/FastShowerLauncher.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/track/TrackInitUtils.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class FastShowerTest : public SimpleTestBase
+{
+  protected:
+    using MevEnergy = units::MevEnergy;
+    using HostStateStore = CollectionStateStore<CoreStateData, MemSpace::host>;
+
+    struct Spot
+    {
+        real_type edep{};
+        real_type weight{};
+        Real3 pos{};
+        std::string volume;
+    };
+
+    SPConstMaterial build_material() override
+    {
+        // Replace the aluminum box with lead for compact showers
+        MaterialParams::Input inp;
+        inp.elements = {{AtomicNumber{82}, units::AmuMass{207.2}, "Pb"}};
+        inp.materials = {{11.35 * constants::na_avogadro / 207.2,
+                          293.0,
+                          MatterState::solid,
+                          {{ElementId{0}, 1.0}},
+                          "Pb"},
+                         {0, 0, MatterState::unspecified, {}, "hard vacuum"}};
+        return std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        // Fill the world with lead as well so the shower is contained
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat = {MaterialId{0}, MaterialId{0}, MaterialId{}};
+        input.volume_labels
+            = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    SPConstParticle build_particle() override
+    {
+        using namespace ::celeritas::units;
+        ParticleParams::Input defs;
+        defs.push_back({"gamma",
+                        pdg::gamma(),
+                        zero_quantity(),
+                        zero_quantity(),
+                        ParticleRecord::stable_decay_constant()});
+        defs.push_back({"electron",
+                        pdg::electron(),
+                        MevMass{0.5},
+                        ElementaryCharge{-1},
+                        ParticleRecord::stable_decay_constant()});
+        defs.push_back({"positron",
+                        pdg::positron(),
+                        MevMass{0.5},
+                        ElementaryCharge{1},
+                        ParticleRecord::stable_decay_constant()});
+        return std::make_shared<ParticleParams>(std::move(defs));
+    }
+
+    void SetUp() override
+    {
+        FastShower::Input inp;
+        inp.volumes = {this->geometry()->find_volume("inner")};
+        inp.min_energy = MevEnergy{100};
+        shower_ = std::make_unique<FastShower>(
+            *this->particle(), inp, 1, this->action_reg().get());
+    }
+
+    // Start tracks with a weight of two at the given point
+    void init_tracks(char const* particle,
+                     Real3 const& pos,
+                     MevEnergy energy,
+                     size_type num_tracks)
+    {
+        states_ = std::make_unique<HostStateStore>(this->core()->host_ref(),
+                                                   num_tracks);
+        core_ref_.params = this->core()->host_ref();
+        core_ref_.states = states_->ref();
+
+        Primary p;
+        p.particle_id = this->particle()->find(particle);
+        p.energy = energy;
+        p.position = pos;
+        p.direction = {1, 0, 0};
+        p.event_id = EventId{0};
+        p.weight = 2;
+        std::vector<Primary> primaries(num_tracks, p);
+        for (auto i : range(num_tracks))
+        {
+            primaries[i].track_id = TrackId{i};
+        }
+        extend_from_primaries(core_ref_, make_span(primaries));
+        initialize_tracks(core_ref_);
+    }
+
+    // Execute the actions of a single step for all tracks
+    void step()
+    {
+        auto const& reg = *this->action_reg();
+        for (char const* label : {"pre-step",
+                                  "fast-shower-select",
+                                  "along-step-neutral",
+                                  "fast-shower",
+                                  "geo-boundary"})
+        {
+            ActionId id = reg.find_action(label);
+            CELER_ASSERT(id);
+            dynamic_cast<ExplicitActionInterface const&>(*reg.action(id))
+                .execute(core_ref_);
+        }
+    }
+
+    // Step until all tracks are killed, recording the spots of each track
+    std::vector<std::vector<Spot>> run_showers()
+    {
+        auto const& geo = *this->geometry();
+        std::vector<std::vector<Spot>> result(states_->size());
+        for (size_type num_steps = 0; num_steps < 1000; ++num_steps)
+        {
+            this->step();
+            bool any_alive = false;
+            for (auto tid : range(ThreadId{states_->size()}))
+            {
+                CoreTrackView track{core_ref_.params, core_ref_.states, tid};
+                auto sim = track.make_sim_view();
+                if (sim.status() == TrackStatus::inactive)
+                {
+                    continue;
+                }
+                EXPECT_EQ(shower_->action_id(), sim.along_step_action());
+
+                auto geo_view = track.make_geo_view();
+                Spot spot;
+                spot.edep = value_as<MevEnergy>(
+                    track.make_physics_step_view().energy_deposition());
+                spot.weight = sim.weight();
+                spot.pos = geo_view.pos();
+                spot.volume = geo_view.is_outside()
+                                  ? "[EXTERIOR]"
+                                  : geo.id_to_label(geo_view.volume_id()).name;
+                result[tid.get()].push_back(spot);
+
+                if (sim.status() == TrackStatus::killed)
+                {
+                    EXPECT_TRUE(track.make_particle_view().is_stopped());
+                    // Mark the slot as empty as the end-of-step would
+                    sim.status(TrackStatus::inactive);
+                }
+                else
+                {
+                    any_alive = true;
+                }
+            }
+            if (!any_alive)
+            {
+                break;
+            }
+        }
+        return result;
+    }
+
+    CoreTrackView track(ThreadId tid) const
+    {
+        return {core_ref_.params, core_ref_.states, tid};
+    }
+
+    std::unique_ptr<FastShower> shower_;
+    std::unique_ptr<HostStateStore> states_;
+    CoreRef<MemSpace::host> core_ref_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FastShowerTest, data)
+{
+    auto const& data = shower_->host_ref();
+    auto const& reg = *this->action_reg();
+    EXPECT_EQ(reg.find_action("fast-shower"), shower_->action_id());
+    EXPECT_EQ(reg.find_action("fast-shower-select"), data.select_action);
+    EXPECT_SOFT_EQ(100, data.min_energy.value());
+    ASSERT_EQ(3, data.particles.size());
+    EXPECT_EQ(ShowerParticle::photon, data.particles[ParticleId{0}]);
+    EXPECT_EQ(ShowerParticle::electron, data.particles[ParticleId{1}]);
+    EXPECT_EQ(ShowerParticle::positron, data.particles[ParticleId{2}]);
+    VolumeId inner = this->geometry()->find_volume("inner");
+    ASSERT_EQ(inner.get() + 1, data.volumes.size());
+    EXPECT_TRUE(data.volumes[inner]);
+}
+
+TEST_F(FastShowerTest, containment)
+{
+    using detail::calc_shower_containment;
+    EXPECT_SOFT_EQ(0, calc_shower_containment(2, 0));
+    // Exponential distribution
+    EXPECT_SOFT_EQ(1 - std::exp(-0.5), calc_shower_containment(1, 0.5));
+    EXPECT_SOFT_EQ(1 - std::exp(-4.0), calc_shower_containment(1, 4));
+    // Erlang distribution with shape 3
+    for (real_type x : {0.5, 2.0, 3.5, 10.0})
+    {
+        EXPECT_SOFT_EQ(1 - std::exp(-x) * (1 + x + x * x / 2),
+                       calc_shower_containment(3, x));
+    }
+}
+
+TEST_F(FastShowerTest, photon_profile)
+{
+    size_type const num_tracks = 8;
+    this->init_tracks("gamma", {-4, 0, 0}, MevEnergy{1000}, num_tracks);
+    auto showers = this->run_showers();
+
+    for (auto const& spots : showers)
+    {
+        ASSERT_FALSE(spots.empty());
+        real_type total_edep = 0;
+        real_type weighted_edep = 0;
+        std::set<std::string> volumes;
+        size_type num_displaced = 0;
+        for (Spot const& s : spots)
+        {
+            total_edep += s.edep;
+            weighted_edep += s.weight * s.edep;
+            volumes.insert(s.volume);
+            if (std::hypot(s.pos[1], s.pos[2]) > 0)
+            {
+                ++num_displaced;
+            }
+        }
+        // All the energy is deposited, and spots carry the weight
+        EXPECT_SOFT_EQ(1000, total_edep);
+        EXPECT_SOFT_EQ(2 * 1000, weighted_edep);
+        // The shower spreads past the inner box into the world
+        EXPECT_EQ((std::set<std::string>{"inner", "world"}), volumes);
+        // Spots are spread radially about the axis
+        EXPECT_LT(spots.size() / 2, num_displaced);
+    }
+
+    // The longitudinal profile is the same for every track
+    std::vector<real_type> edep;
+    std::vector<real_type> depth;
+    for (Spot const& s : showers.front())
+    {
+        edep.push_back(s.edep);
+        depth.push_back(s.pos[0] + 4);
+    }
+    for (auto const& spots : showers)
+    {
+        ASSERT_EQ(edep.size(), spots.size());
+        for (auto i : range(spots.size()))
+        {
+            EXPECT_SOFT_EQ(edep[i], spots[i].edep);
+            EXPECT_SOFT_EQ(depth[i], spots[i].pos[0] + 4);
+        }
+    }
+
+    // Shower maximum is about 3.4 cm (6 X0) deep; the spot at 9 cm is
+    // truncated by the boundary of the inner box
+    static real_type const expected_edep[] = {3.3187848115484,
+                                              26.28012037986,
+                                              62.032492840667,
+                                              93.368719530204,
+                                              111.94922230807,
+                                              117.08148975122,
+                                              111.78748407004,
+                                              100.01272384256,
+                                              85.221356773574,
+                                              69.917635654098,
+                                              55.650385685285,
+                                              43.210578041649,
+                                              32.866198737701,
+                                              24.565639243038,
+                                              18.088851427088,
+                                              13.148191061164,
+                                              0.40715884248477,
+                                              9.3330657160408,
+                                              6.6383945972783,
+                                              4.6801369009666,
+                                              3.2735218796315,
+                                              2.273405674426,
+                                              1.5686943669307,
+                                              1.0761033178102,
+                                              0.73425206964084,
+                                              0.49854646654479,
+                                              1.0168460104821};
+    static real_type const expected_depth[] = {0.56120732550701,
+                                               1.122414651014,
+                                               1.683621976521,
+                                               2.244829302028,
+                                               2.8060366275351,
+                                               3.3672439530421,
+                                               3.9284512785491,
+                                               4.4896586040561,
+                                               5.0508659295631,
+                                               5.6120732550701,
+                                               6.1732805805771,
+                                               6.7344879060841,
+                                               7.2956952315911,
+                                               7.8569025570982,
+                                               8.4181098826052,
+                                               8.9793172081122,
+                                               9,
+                                               9.561207325507,
+                                               10.122414651014,
+                                               10.683621976521,
+                                               11.244829302028,
+                                               11.806036627535,
+                                               12.367243953042,
+                                               12.928451278549,
+                                               13.489658604056,
+                                               14.050865929563,
+                                               14.61207325507};
+    EXPECT_VEC_SOFT_EQ(expected_edep, edep);
+    EXPECT_VEC_SOFT_EQ(expected_depth, depth);
+}
+
+TEST_F(FastShowerTest, positron)
+{
+    this->init_tracks("positron", {0, 0, 0}, MevEnergy{500}, 4);
+    auto showers = this->run_showers();
+    for (auto const& spots : showers)
+    {
+        real_type total_edep = 0;
+        for (Spot const& s : spots)
+        {
+            total_edep += s.edep;
+        }
+        // Annihilation energy is included
+        EXPECT_SOFT_EQ(500 + 2 * 0.5, total_edep);
+    }
+}
+
+TEST_F(FastShowerTest, below_threshold)
+{
+    this->init_tracks("gamma", {0, 0, 0}, MevEnergy{10}, 4);
+    this->step();
+    for (auto tid : range(ThreadId{4}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        EXPECT_FALSE(sim.along_step_action());
+        EXPECT_NE(shower_->action_id(), sim.step_limit().action);
+    }
+}
+
+TEST_F(FastShowerTest, outside)
+{
+    this->init_tracks("gamma", {-20, 0, 0}, MevEnergy{1000}, 4);
+    this->step();
+    for (auto tid : range(ThreadId{4}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        EXPECT_FALSE(sim.along_step_action());
+        EXPECT_SOFT_EQ(0,
+                       value_as<MevEnergy>(this->track(tid)
+                                               .make_physics_step_view()
+                                               .energy_deposition()));
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
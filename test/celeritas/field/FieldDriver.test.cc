@@ -127,8 +127,9 @@ TEST_F(FieldDriverTest, types)
         (std::is_same<
             FieldDriver<DormandPrinceStepper<MagFieldEquation<UniformField>>>,
             decltype(driver)>::value));
-    // Size: field vector, q / c, reference to options
-    EXPECT_EQ(sizeof(Real3) + sizeof(real_type) + sizeof(FieldDriverOptions*),
+    // Size: field vector, q / c, reference to options, substep memory
+    EXPECT_EQ(sizeof(Real3) + sizeof(real_type) + sizeof(FieldDriverOptions*)
+                  + sizeof(real_type*),
               sizeof(driver));
 }
 
@@ -186,6 +187,84 @@ TEST_F(FieldDriverTest, step_counts)
     EXPECT_VEC_SOFT_EQ(expected_lengths, lengths);
 }
 
+TEST_F(FieldDriverTest, substep_memory)
+{
+    FieldDriverOptions driver_options;
+
+    real_type field_strength = 1.0 * units::tesla;
+    auto stepper = make_mag_field_stepper<DiagnosticDPStepper>(
+        UniformField({0, 0, field_strength}), units::ElementaryCharge{-1});
+
+    // Travel a total curved length of 1 m in steps of 10 cm (as if limited
+    // by physics) and count the number of field evaluations
+    auto count_evaluations = [&](real_type* substep) {
+        FieldDriver<decltype(stepper)&> driver{
+            driver_options, stepper, substep};
+
+        MevEnergy e{10};
+        OdeState state;
+        state.pos = {this->calc_curvature(e, field_strength), 0, 0};
+        state.mom = this->calc_momentum(e, {0, sqrt_two / 2, sqrt_two / 2});
+
+        stepper.reset_count();
+        real_type total = 0;
+        for ([[maybe_unused]] int i : range(10))
+        {
+            real_type remaining = 10 * units::centimeter;
+            while (remaining > driver_options.minimum_step)
+            {
+                auto end = driver.advance(remaining, state);
+                state = end.state;
+                remaining -= end.step;
+                total += end.step;
+            }
+        }
+        EXPECT_SOFT_EQ(100 * units::centimeter, total);
+        return stepper.count();
+    };
+
+    unsigned int without_memory = count_evaluations(nullptr);
+    real_type substep = 0;
+    unsigned int with_memory = count_evaluations(&substep);
+
+    EXPECT_EQ(480u, without_memory);
+    EXPECT_EQ(115u, with_memory);
+    EXPECT_SOFT_EQ(0.995836068644, substep);
+}
+
+TEST_F(FieldDriverTest, substep_memory_rejected)
+{
+    // Require a tighter error than the chord can provide
+    FieldDriverOptions driver_options;
+    driver_options.epsilon_step = 1e-12;
+
+    real_type field_strength = 1.0 * units::tesla;
+    auto stepper = make_mag_field_stepper<DiagnosticDPStepper>(
+        UniformField({0, 0, field_strength}), units::ElementaryCharge{-1});
+
+    MevEnergy e{1};
+    OdeState state;
+    state.pos = {this->calc_curvature(e, field_strength), 0, 0};
+    state.mom = this->calc_momentum(e, {0, sqrt_two / 2, sqrt_two / 2});
+
+    // A stale memory must not survive a rejected chord
+    real_type substep = 1 * units::centimeter;
+    FieldDriver<decltype(stepper)&> driver{driver_options, stepper, &substep};
+    auto end = driver.advance(1 * units::centimeter, state);
+    EXPECT_GT(end.step, 0);
+    EXPECT_EQ(0, substep);
+
+    // An accepted chord with the default tolerance saves a new length
+    e = MevEnergy{10};
+    state.pos = {this->calc_curvature(e, field_strength), 0, 0};
+    state.mom = this->calc_momentum(e, {0, sqrt_two / 2, sqrt_two / 2});
+    FieldDriver<decltype(stepper)&> default_driver{
+        FieldDriverOptions{}, stepper, &substep};
+    end = default_driver.advance(10 * units::centimeter, state);
+    EXPECT_GT(end.step, 0);
+    EXPECT_GT(substep, 0);
+}
+
 //---------------------------------------------------------------------------//
 
 TEST_F(RevolutionFieldDriverTest, advance)
@@ -5,8 +5,10 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/geo/GeoMaterial.test.cc
 //---------------------------------------------------------------------------//
+#include "celeritas_config.h"
 #include "corecel/data/CollectionStateStore.hh"
 #include "celeritas/RootTestBase.hh"
+#include "celeritas/SimpleTestBase.hh"
 #include "celeritas/geo/GeoData.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoMaterialView.hh"
@@ -20,6 +22,12 @@ namespace celeritas
 {
 namespace test
 {
+#if CELERITAS_USE_ROOT
+#    define TEST_IF_CELERITAS_ROOT(name) name
+#else
+#    define TEST_IF_CELERITAS_ROOT(name) DISABLED_##name
+#endif
+
 //---------------------------------------------------------------------------//
 // TEST HARNESS
 //---------------------------------------------------------------------------//
@@ -33,11 +41,30 @@ class GeoMaterialTest : public RootTestBase
     SPConstAction build_along_step() final { CELER_ASSERT_UNREACHABLE(); }
 };
 
+//---------------------------------------------------------------------------//
+
+class GeoMaterialRegionTest : public SimpleTestBase
+{
+  protected:
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        // Volume labels are given in a different order from the geometry
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat = {MaterialId{}, MaterialId{1}, MaterialId{0}};
+        input.volume_labels
+            = {Label{"[EXTERIOR]"}, Label{"world"}, Label{"inner"}};
+        input.volume_to_region = {RegionId{}, RegionId{}, RegionId{2}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+};
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(GeoMaterialTest, host)
+TEST_F(GeoMaterialTest, TEST_IF_CELERITAS_ROOT(host))
 {
     // Geometry track view and mat view
     auto const& geo_params = *this->geometry();
@@ -70,6 +97,55 @@ TEST_F(GeoMaterialTest, host)
     EXPECT_VEC_EQ(expected_materials, materials);
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(GeoMaterialRegionTest, host)
+{
+    auto const& geo_params = *this->geometry();
+    auto const& geo_mat = *this->geomaterial();
+    EXPECT_EQ(3, geo_mat.num_regions());
+
+    GeoMaterialView geo_mat_view(geo_mat.host_ref());
+    EXPECT_TRUE(geo_mat_view.has_regions());
+
+    std::vector<std::string> volumes;
+    std::vector<int> materials;
+    std::vector<int> regions;
+    for (auto vol_id : range(VolumeId{geo_params.num_volumes()}))
+    {
+        volumes.push_back(geo_params.id_to_label(vol_id).name);
+        auto mat_id = geo_mat_view.material_id(vol_id);
+        materials.push_back(mat_id ? static_cast<int>(mat_id.get()) : -1);
+        regions.push_back(geo_mat_view.region_id(vol_id).get());
+    }
+
+    // Unassigned volumes are in the default region
+    static char const* const expected_volumes[]
+        = {"[EXTERIOR]", "inner", "world"};
+    static int const expected_materials[] = {-1, 0, 1};
+    static int const expected_regions[] = {0, 2, 0};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+    EXPECT_VEC_EQ(expected_materials, materials);
+    EXPECT_VEC_EQ(expected_regions, regions);
+}
+
+TEST_F(GeoMaterialRegionTest, no_regions)
+{
+    // Without a region map, every volume is in the default region
+    GeoMaterialParams::Input input;
+    input.geometry = this->geometry();
+    input.materials = this->material();
+    input.volume_to_mat = {MaterialId{0}, MaterialId{1}, MaterialId{}};
+    input.volume_labels = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+    GeoMaterialParams geo_mat(std::move(input));
+    EXPECT_EQ(1, geo_mat.num_regions());
+
+    GeoMaterialView geo_mat_view(geo_mat.host_ref());
+    EXPECT_FALSE(geo_mat_view.has_regions());
+    EXPECT_EQ(RegionId{0}, geo_mat_view.region_id(VolumeId{0}));
+    EXPECT_EQ(RegionId{0}, geo_mat_view.region_id(VolumeId{1}));
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
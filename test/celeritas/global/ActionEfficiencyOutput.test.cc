@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionEfficiencyOutput.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/ActionEfficiencyOutput.hh"
+
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "../SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ActionEfficiencyOutputTest : public SimpleTestBase
+{
+  protected:
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find("gamma");
+        p.energy = units::MevEnergy{10};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+        p.track_id = TrackId{0};
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ActionEfficiencyOutputTest, host)
+{
+    size_type const num_tracks = 32;
+    size_type const num_primaries = 8;
+
+    StepperInput input;
+    input.params = this->core();
+    input.num_track_slots = num_tracks;
+    input.count_tracks = true;
+    Stepper<MemSpace::host> step(std::move(input));
+
+    auto primaries = this->make_primaries(num_primaries);
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(num_primaries, counts.active);
+
+    auto result = step.action_efficiency();
+    std::vector<std::string> labels;
+    std::vector<ActionEfficiency::Count> useful;
+    for (auto const& eff : result)
+    {
+        labels.push_back(eff.label);
+        useful.push_back(eff.useful);
+        EXPECT_EQ(1, eff.num_launches);
+        EXPECT_EQ(num_tracks, eff.launched);
+        EXPECT_LE(eff.useful, eff.launched);
+        EXPECT_LE(0, eff.time);
+    }
+    static std::string const expected_labels[] = {"pre-step",
+                                                  "along-step-neutral",
+                                                  "physics-discrete-select",
+                                                  "scat-klein-nishina",
+                                                  "geo-boundary"};
+    EXPECT_VEC_EQ(expected_labels, labels);
+    // Every primary is pre-stepped and transported; each then either
+    // interacts or reaches the boundary
+    static ActionEfficiency::Count const expected_useful[]
+        = {8ull, 8ull, 3ull, 3ull, 5ull};
+    EXPECT_VEC_EQ(expected_useful, useful);
+    EXPECT_DOUBLE_EQ(0.25, result[0].efficiency());
+
+    ActionEfficiencyOutput out(std::move(result));
+    EXPECT_EQ("action_efficiency", out.label());
+    if (CELERITAS_USE_JSON)
+    {
+        auto str = to_string(out);
+        EXPECT_NE(std::string::npos, str.find("\"efficiency\":0.25")) << str;
+        EXPECT_NE(std::string::npos, str.find("\"time_per_useful\""))
+            << str;
+    }
+}
+
+TEST_F(ActionEfficiencyOutputTest, disabled)
+{
+    StepperInput input;
+    input.params = this->core();
+    input.num_track_slots = 4;
+    Stepper<MemSpace::host> step(std::move(input));
+    EXPECT_THROW(step.action_efficiency(), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
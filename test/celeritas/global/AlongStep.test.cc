@@ -13,6 +13,7 @@
 #include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/ParticleParams.hh"
 
 #include "../MockTestBase.hh"
@@ -36,6 +37,17 @@ class MockAlongStepTest : public MockTestBase, public AlongStepTestBase
 {
 };
 
+class MockRangeRejectionAlongStepTest : public MockAlongStepTest
+{
+  public:
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.range_rejection_regions = {RegionId{0}};
+        return opts;
+    }
+};
+
 #define Em3AlongStepTest TEST_IF_CELERITAS_GEANT(Em3AlongStepTest)
 class Em3AlongStepTest : public TestEm3Base, public AlongStepTestBase
 {
@@ -177,6 +189,25 @@ TEST_F(MockAlongStepTest, basic)
     }
 }
 
+TEST_F(MockRangeRejectionAlongStepTest, basic)
+{
+    size_type num_tracks = 10;
+    Input inp;
+    inp.particle_id = this->particle()->find("celeriton");
+    {
+        // Range is shorter than the distance to the boundary: the track is
+        // stopped in place and waits for its at-rest interaction
+        inp.energy = MevEnergy{1};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(1, result.eloss);
+        EXPECT_SOFT_EQ(0, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(0, result.time);
+        EXPECT_SOFT_EQ(0, result.step);
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+}
+
 TEST_F(Em3AlongStepTest, nofluct_nomsc)
 {
     msc_ = false;
@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/CoreMemoryOutput.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/CoreMemoryOutput.hh"
+
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "../SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class CoreMemoryOutputTest : public SimpleTestBase
+{
+  protected:
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find("gamma");
+        p.energy = units::MevEnergy{10};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+        p.track_id = TrackId{0};
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CoreMemoryOutputTest, host)
+{
+    // Fill all track slots: electrons in this problem cannot be transported
+    size_type const num_tracks = 32;
+
+    StepperInput input;
+    input.params = this->core();
+    input.num_track_slots = num_tracks;
+    Stepper<MemSpace::host> step(std::move(input));
+
+    auto primaries = this->make_primaries(num_tracks);
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(num_tracks, counts.active);
+    step();
+
+    auto usage = step.memory_usage();
+    ASSERT_TRUE(usage);
+    EXPECT_EQ(num_tracks, usage.num_track_slots);
+
+    // Per-collection state sizes
+    EXPECT_EQ(sizeof(ParticleTrackState) * num_tracks,
+              usage.states.at("particles").at("state"));
+    EXPECT_EQ(sizeof(SimTrackState) * num_tracks,
+              usage.states.at("sim").at("state"));
+    EXPECT_EQ(sizeof(TrackInitializer) * usage.initializer_capacity,
+              usage.states.at("init").at("initializers"));
+    EXPECT_EQ(num_tracks, usage.secondary_capacity);
+    EXPECT_EQ(sizeof(Secondary) * usage.secondary_capacity,
+              usage.states.at("physics").at("secondaries.storage"));
+    EXPECT_LT(0, usage.states.at("geometry").at("pos"));
+    EXPECT_LT(0, usage.states.at("rng").size());
+    // Action tallies are only allocated when counting tracks
+    EXPECT_EQ(0, usage.states.at("actions").at("action_tracks"));
+
+    // Per-collection params sizes
+    EXPECT_EQ(sizeof(ParticleRecord) * this->particle()->size(),
+              usage.params.at("particles").at("particles"));
+    EXPECT_LT(0, usage.params.at("physics").at("reals"));
+    EXPECT_LT(0, usage.params.at("geometry").at("volume_records"));
+    EXPECT_LT(0, usage.params.at("rng").at("params"));
+
+    // Peak dynamic use is bounded by the capacity
+    EXPECT_LE(num_tracks, usage.peak_initializers);
+    EXPECT_LE(usage.peak_initializers, usage.initializer_capacity);
+    ASSERT_TRUE(usage.peak_secondaries);
+    EXPECT_LT(0, *usage.peak_secondaries);
+    EXPECT_LE(*usage.peak_secondaries, usage.secondary_capacity);
+
+    CoreMemoryOutput out(std::move(usage));
+    EXPECT_EQ("memory", out.label());
+    if (CELERITAS_USE_JSON)
+    {
+        auto str = to_string(out);
+        EXPECT_NE(std::string::npos, str.find("\"bytes_per_track_slot\""))
+            << str;
+        EXPECT_NE(std::string::npos, str.find("\"peak\"")) << str;
+        EXPECT_NE(std::string::npos, str.find("\"excludes\"")) << str;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -7,11 +7,18 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/global/Stepper.hh"
 
+#include <map>
 #include <random>
+#include <set>
+#include <sstream>
+#include <string>
 
+#include "celeritas_config.h"
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/TraceRecorder.hh"
 #include "celeritas/em/UrbanMscParams.hh"
 #include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/field/UniformFieldData.hh"
@@ -30,6 +37,10 @@
 #include "StepperTestBase.hh"
 #include "celeritas_test.hh"
 
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
 using celeritas::units::MevEnergy;
 
 namespace celeritas
@@ -64,6 +75,31 @@ class TestEm3StepperTestBase : public TestEm3Base, public StepperTestBase
     }
 };
 
+//---------------------------------------------------------------------------//
+class SimpleStepperTest : public SimpleTestBase
+{
+  public:
+    //! Make 10MeV photons along +x
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = MevEnergy{10};
+        p.track_id = TrackId{0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+};
+
 //---------------------------------------------------------------------------//
 #define TestEm3NoMsc TEST_IF_CELERITAS_GEANT(TestEm3NoMsc)
 class TestEm3NoMsc : public TestEm3StepperTestBase
@@ -173,6 +209,67 @@ class TestEm15Field : public TestEm15Base, public StepperTestBase
     size_type max_average_steps() const override { return 500; }
 };
 
+//---------------------------------------------------------------------------//
+// SIMPLE
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleStepperTest, TEST_IF_CELERITAS_JSON(trace_threads))
+{
+    auto& recorder = trace_recorder();
+    recorder.clear();
+    recorder.start();
+    {
+        StepperInput input;
+        input.params = this->core();
+        input.num_track_slots = 32;
+        Stepper<MemSpace::host> step(std::move(input));
+
+        auto primaries = this->make_primaries(8);
+        step(make_span(primaries));
+    }
+    recorder.stop();
+    std::ostringstream os;
+    recorder.write(os);
+    recorder.clear();
+
+#if CELERITAS_USE_JSON
+    // Find the threads that recorded each event
+    std::map<std::string, std::set<int>> action_threads;
+    std::map<std::string, std::set<int>> omp_threads;
+    std::set<int> all_omp_threads;
+    auto j = nlohmann::json::parse(os.str());
+    for (auto const& event : j.at("traceEvents"))
+    {
+        auto cat = event.value("cat", std::string{});
+        int tid = event.at("tid").get<int>();
+        if (cat == "action")
+        {
+            action_threads[event.at("name")].insert(tid);
+        }
+        else if (cat == "omp")
+        {
+            omp_threads[event.at("name")].insert(tid);
+            all_omp_threads.insert(tid);
+        }
+    }
+
+    // Actions are recorded on the calling thread, and each host launch is
+    // recorded on every thread of the OpenMP team
+    ASSERT_EQ(1, action_threads.count("pre-step"));
+    EXPECT_EQ(1, action_threads["pre-step"].size());
+    for (char const* name : {"pre-step", "geo-boundary", "init_tracks"})
+    {
+        ASSERT_EQ(1, omp_threads.count(name)) << name;
+        EXPECT_EQ(all_omp_threads, omp_threads[name]) << name;
+    }
+    EXPECT_EQ(1, all_omp_threads.count(*action_threads["pre-step"].begin()));
+    if (CELERITAS_USE_OPENMP && celeritas::getenv("OMP_NUM_THREADS") == "2")
+    {
+        EXPECT_EQ(2, all_omp_threads.size());
+    }
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
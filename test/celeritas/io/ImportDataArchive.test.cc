@@ -0,0 +1,166 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportDataArchive.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/ImportDataArchive.hh"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class ImportDataArchiveTest : public Test
+{
+  protected:
+    static ImportData make_data()
+    {
+        ImportData data;
+        data.particles = {{"gamma", 22, 0, 0, 1, -1, true},
+                          {"e-", 11, 0.511, -1, 0.5, -1, true}};
+        data.elements = {{"H", 1, 1.008, 63.04, 6.4e-5}};
+
+        ImportMaterial mat;
+        mat.name = "hydrogen";
+        mat.state = ImportMaterialState::gas;
+        mat.temperature = 293;
+        mat.density = 8.4e-5;
+        mat.electron_density = 5e19;
+        mat.number_density = 5e19;
+        mat.radiation_length = 7.5e5;
+        mat.nuclear_int_length = 6e5;
+        mat.pdg_cutoffs = {{22, {1e-3, 0.1}}, {11, {2e-3, 0.1}}};
+        mat.elements = {{0, 1.0, 1.0}};
+        data.materials = {mat};
+
+        ImportProcess proc;
+        proc.particle_pdg = 22;
+        proc.secondary_pdg = 11;
+        proc.process_type = ImportProcessType::electromagnetic;
+        proc.process_class = ImportProcessClass::compton;
+        ImportModel model;
+        model.model_class = ImportModelClass::klein_nishina;
+        model.materials = {{{1e-3, 1e8}, {{1.0, 2.0}, {3.0}}}};
+        proc.models = {model};
+        proc.tables = {{ImportTableType::lambda,
+                        ImportUnits::mev,
+                        ImportUnits::cm_inv,
+                        {{ImportPhysicsVectorType::log,
+                          {1, 10},
+                          {0.5, 0.25}}}}};
+        data.processes = {proc};
+
+        data.volumes = {{0, "world", "world_box"}};
+        data.em_params.lpm = false;
+        data.em_params.linear_loss_limit = 0.02;
+        data.sb_data[1] = {{1, 2}, {0.5}, {3, 4}};
+        data.livermore_pe_data[1].thresh_lo = 0.1;
+        data.livermore_pe_data[1].shells = {{1.3e-5, {1, 2}, {3}, {}, {}}};
+        data.atomic_relaxation_data[6].shells = {{1, {{2, 0, 0.5, 1e-3}}, {}}};
+        return data;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ImportDataArchiveTest, round_trip)
+{
+    ImportData const orig = make_data();
+    std::ostringstream os;
+    {
+        BinaryOutArchive ar(&os);
+        archive(ar, orig);
+    }
+    std::string const buffer = os.str();
+
+    ImportData loaded;
+    {
+        BinaryInArchive ar({buffer.data(), buffer.size()});
+        unarchive(ar, &loaded);
+        EXPECT_EQ(0, ar.remaining());
+    }
+
+    ASSERT_EQ(2, loaded.particles.size());
+    EXPECT_EQ("e-", loaded.particles[1].name);
+    EXPECT_EQ(11, loaded.particles[1].pdg);
+    EXPECT_DOUBLE_EQ(0.511, loaded.particles[1].mass);
+    EXPECT_TRUE(loaded.particles[1].is_stable);
+
+    ASSERT_EQ(1, loaded.elements.size());
+    EXPECT_EQ("H", loaded.elements[0].name);
+    EXPECT_DOUBLE_EQ(63.04, loaded.elements[0].radiation_length_tsai);
+
+    ASSERT_EQ(1, loaded.materials.size());
+    auto const& mat = loaded.materials[0];
+    EXPECT_EQ("hydrogen", mat.name);
+    EXPECT_EQ(ImportMaterialState::gas, mat.state);
+    EXPECT_DOUBLE_EQ(7.5e5, mat.radiation_length);
+    ASSERT_EQ(2, mat.pdg_cutoffs.size());
+    EXPECT_DOUBLE_EQ(2e-3, mat.pdg_cutoffs.at(11).energy);
+    ASSERT_EQ(1, mat.elements.size());
+    EXPECT_DOUBLE_EQ(1.0, mat.elements[0].number_fraction);
+
+    ASSERT_EQ(1, loaded.processes.size());
+    auto const& proc = loaded.processes[0];
+    EXPECT_EQ(ImportProcessClass::compton, proc.process_class);
+    ASSERT_EQ(1, proc.models.size());
+    EXPECT_EQ(ImportModelClass::klein_nishina, proc.models[0].model_class);
+    ASSERT_EQ(1, proc.models[0].materials.size());
+    auto const& micro_xs = proc.models[0].materials[0].micro_xs;
+    ASSERT_EQ(2, micro_xs.size());
+    EXPECT_VEC_EQ((std::vector<double>{3.0}), micro_xs[1]);
+    ASSERT_EQ(1, proc.tables.size());
+    EXPECT_EQ(ImportUnits::cm_inv, proc.tables[0].y_units);
+    ASSERT_EQ(1, proc.tables[0].physics_vectors.size());
+    EXPECT_VEC_EQ((std::vector<double>{0.5, 0.25}),
+                  proc.tables[0].physics_vectors[0].y);
+
+    ASSERT_EQ(1, loaded.volumes.size());
+    EXPECT_EQ("world_box", loaded.volumes[0].solid_name);
+    EXPECT_FALSE(loaded.em_params.lpm);
+    EXPECT_DOUBLE_EQ(0.02, loaded.em_params.linear_loss_limit);
+
+    ASSERT_EQ(1, loaded.sb_data.size());
+    EXPECT_VEC_EQ((std::vector<double>{3, 4}), loaded.sb_data.at(1).value);
+    ASSERT_EQ(1, loaded.livermore_pe_data.size());
+    auto const& pe = loaded.livermore_pe_data.at(1);
+    EXPECT_DOUBLE_EQ(0.1, pe.thresh_lo);
+    ASSERT_EQ(1, pe.shells.size());
+    EXPECT_VEC_EQ((std::vector<double>{3}), pe.shells[0].param_hi);
+    ASSERT_EQ(1, loaded.atomic_relaxation_data.size());
+    auto const& shells = loaded.atomic_relaxation_data.at(6).shells;
+    ASSERT_EQ(1, shells.size());
+    ASSERT_EQ(1, shells[0].fluor.size());
+    EXPECT_DOUBLE_EQ(1e-3, shells[0].fluor[0].energy);
+}
+
+TEST_F(ImportDataArchiveTest, truncated)
+{
+    std::ostringstream os;
+    {
+        BinaryOutArchive ar(&os);
+        archive(ar, make_data());
+    }
+    std::string buffer = os.str();
+    buffer.resize(buffer.size() / 2);
+
+    ImportData loaded;
+    BinaryInArchive ar({buffer.data(), buffer.size()});
+    EXPECT_THROW(unarchive(ar, &loaded), RuntimeError);
+    EXPECT_TRUE(loaded.particles.empty());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,210 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/RootStepWriter.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/RootStepWriter.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "celeritas_config.h"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/ext/ScopedRootErrorHandler.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/io/RootFileManager.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/StepCollector.hh"
+
+#include "../SimpleTestBase.hh"
+#include "../user/ExampleMctruth.hh"
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_ROOT
+#    include <TFile.h>
+#    include <TTree.h>
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class RootStepWriterTest : public SimpleTestBase
+{
+  protected:
+    using VecPrimary = std::vector<Primary>;
+    using VecInterface = StepCollector::VecInterface;
+    using Step = ExampleMctruth::Step;
+    using VecStep = std::vector<Step>;
+
+    void SetUp() override
+    {
+#if CELERITAS_USE_ROOT
+        // Steps are written from a background thread
+        RootFileManager::enable_thread_safety();
+#endif
+        filename_ = this->make_unique_filename(".root");
+        std::remove(filename_.c_str());
+    }
+
+    void TearDown() override { std::remove(filename_.c_str()); }
+
+    VecPrimary make_primaries(size_type count)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10.0};
+        p.track_id = TrackId{0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        VecPrimary result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    void run(VecInterface callbacks, size_type num_tracks, size_type num_steps)
+    {
+        StepCollector collector{std::move(callbacks),
+                                this->geometry(),
+                                /* num_streams = */ 1,
+                                this->action_reg().get()};
+
+        StepperInput step_inp;
+        step_inp.params = this->core();
+        step_inp.num_track_slots = num_tracks;
+        Stepper<MemSpace::host> step(step_inp);
+
+        auto primaries = this->make_primaries(num_tracks);
+        auto counts = step(make_span(primaries));
+        for (size_type i = 1; i < num_steps && counts; ++i)
+        {
+            counts = step();
+        }
+    }
+
+    //! Read all steps from the file, sorted by event/track/step
+    VecStep read_steps()
+    {
+#if CELERITAS_USE_ROOT
+        std::unique_ptr<TFile> file(TFile::Open(filename_.c_str(), "read"));
+        CELER_ASSERT(file && file->IsOpen());
+        auto* tree = dynamic_cast<TTree*>(file->Get("steps"));
+        CELER_ASSERT(tree);
+
+        // Each entry is a single step
+        RootStepWriter::TStepData tstep;
+        auto& pre = tstep.points[StepPoint::pre];
+        tree->SetBranchAddress("event_id", &tstep.event_id);
+        tree->SetBranchAddress("track_id", &tstep.track_id);
+        tree->SetBranchAddress("track_step_count", &tstep.track_step_count);
+        tree->SetBranchAddress("pre_volume_id", &pre.volume_id);
+        tree->SetBranchAddress("pre_pos", &pre.pos);
+        tree->SetBranchAddress("particle", &tstep.particle);
+
+        VecStep result;
+        for (auto entry : range(tree->GetEntries()))
+        {
+            tree->GetEntry(entry);
+            EXPECT_EQ(pdg::gamma().get(), tstep.particle);
+            Step s;
+            s.event = tstep.event_id;
+            s.track = tstep.track_id;
+            s.step = tstep.track_step_count;
+            s.volume = pre.volume_id;
+            std::copy(pre.pos.begin(), pre.pos.end(), s.pos);
+            result.push_back(s);
+        }
+        std::sort(
+            result.begin(), result.end(), [](Step const& a, Step const& b) {
+                return std::make_tuple(a.event, a.track, a.step)
+                       < std::make_tuple(b.event, b.track, b.step);
+            });
+        return result;
+#else
+        CELER_NOT_CONFIGURED("ROOT");
+#endif
+    }
+
+    std::string filename_;
+    ScopedRootErrorHandler scoped_root_error_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RootStepWriterTest, TEST_IF_CELERITAS_USE_ROOT(round_trip))
+{
+    auto mctruth = std::make_shared<ExampleMctruth>();
+    {
+        auto root_manager
+            = std::make_shared<RootFileManager>(filename_.c_str());
+        auto writer = std::make_shared<RootStepWriter>(
+            root_manager, this->particle(), StepSelection::all());
+        writer->set_buffer_size(5);
+        this->run({mctruth, writer}, 8, 2);
+    }
+    mctruth->sort();
+
+    // Steps are written as separate entries regardless of the buffer size
+    auto actual = this->read_steps();
+    auto expected = mctruth->steps();
+    ASSERT_EQ(expected.size(), actual.size());
+    for (auto i : range(expected.size()))
+    {
+        EXPECT_EQ(expected[i].event, actual[i].event);
+        EXPECT_EQ(expected[i].track, actual[i].track);
+        EXPECT_EQ(expected[i].step, actual[i].step);
+        EXPECT_EQ(expected[i].volume, actual[i].volume);
+        EXPECT_EQ(expected[i].pos[0], actual[i].pos[0]);
+    }
+}
+
+TEST_F(RootStepWriterTest, TEST_IF_CELERITAS_USE_ROOT(filter))
+{
+    {
+        auto root_manager
+            = std::make_shared<RootFileManager>(filename_.c_str());
+        auto writer = std::make_shared<RootStepWriter>(
+            root_manager,
+            this->particle(),
+            StepSelection::all(),
+            [](RootStepWriter::TStepData const& step) {
+                return step.event_id == 3;
+            });
+        this->run({writer}, 8, 3);
+
+        // Remaining steps are written by flush
+        writer->flush();
+    }
+
+    auto actual = this->read_steps();
+    ASSERT_FALSE(actual.empty());
+    for (auto const& s : actual)
+    {
+        EXPECT_EQ(3, s.event);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
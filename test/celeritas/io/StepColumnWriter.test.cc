@@ -0,0 +1,207 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/StepColumnWriter.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/StepColumnWriter.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <tuple>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/io/StepColumnReader.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/StepCollector.hh"
+
+#include "../SimpleTestBase.hh"
+#include "../user/ExampleMctruth.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class StepColumnWriterTest : public SimpleTestBase
+{
+  protected:
+    using VecPrimary = std::vector<Primary>;
+    using VecInterface = StepCollector::VecInterface;
+
+    void SetUp() override
+    {
+        filename_ = this->make_unique_filename(".celersteps");
+        std::remove(filename_.c_str());
+    }
+
+    void TearDown() override { std::remove(filename_.c_str()); }
+
+    VecPrimary make_primaries(size_type count)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10.0};
+        p.track_id = TrackId{0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        VecPrimary result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    void run(VecInterface callbacks, size_type num_tracks, size_type num_steps)
+    {
+        StepCollector collector{std::move(callbacks),
+                                this->geometry(),
+                                /* num_streams = */ 1,
+                                this->action_reg().get()};
+
+        StepperInput step_inp;
+        step_inp.params = this->core();
+        step_inp.num_track_slots = num_tracks;
+        Stepper<MemSpace::host> step(step_inp);
+
+        auto primaries = this->make_primaries(num_tracks);
+        auto counts = step(make_span(primaries));
+        for (size_type i = 1; i < num_steps && counts; ++i)
+        {
+            counts = step();
+        }
+    }
+
+    std::string filename_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(StepColumnWriterTest, codec)
+{
+    // IDs with mostly-zero high bytes, followed by noisy bytes
+    std::vector<unsigned int> values(1000);
+    for (auto i : range(values.size()))
+    {
+        values[i] = (i < 900 ? i % 7 : i * 2654435761u);
+    }
+    Span<char const> src{reinterpret_cast<char const*>(values.data()),
+                         values.size() * sizeof(unsigned int)};
+
+    std::vector<char> encoded;
+    detail::encode_shuffle_rle(src, sizeof(unsigned int), &encoded);
+    EXPECT_LT(encoded.size(), src.size() / 2);
+
+    std::vector<unsigned int> decoded(values.size());
+    detail::decode_shuffle_rle(
+        make_span(encoded),
+        sizeof(unsigned int),
+        {reinterpret_cast<char*>(decoded.data()), src.size()});
+    EXPECT_EQ(values, decoded);
+
+    // Truncated data
+    encoded.pop_back();
+    EXPECT_THROW(detail::decode_shuffle_rle(
+                     make_span(encoded),
+                     sizeof(unsigned int),
+                     {reinterpret_cast<char*>(decoded.data()), src.size()}),
+                 RuntimeError);
+}
+
+TEST_F(StepColumnWriterTest, round_trip)
+{
+    auto mctruth = std::make_shared<ExampleMctruth>();
+    {
+        auto writer = std::make_shared<StepColumnWriter>(
+            filename_, this->particle(), StepSelection::all());
+        writer->set_chunk_size(5);
+        this->run({mctruth, writer}, 8, 2);
+        writer->finalize();
+    }
+    mctruth->sort();
+
+    StepColumnReader read_steps(filename_);
+    EXPECT_EQ(19, read_steps.columns().size());
+    EXPECT_EQ(0, read_steps.find("track_id"));
+    EXPECT_EQ(19, read_steps.find("nonexistent"));
+    EXPECT_EQ(2, read_steps.num_chunks());
+    ASSERT_EQ(mctruth->steps().size(), read_steps.num_rows());
+
+    auto event = read_steps.read_all<size_type>("event_id");
+    auto track = read_steps.read_all<size_type>("track_id");
+    auto step = read_steps.read_all<size_type>("track_step_count");
+    auto volume = read_steps.read_all<size_type>("pre_volume_id");
+    auto pos = read_steps.read_all<Real3>("pre_pos");
+    auto particle = read_steps.read_all<int>("particle");
+    EXPECT_THROW(read_steps.read_all<char>("event_id"), RuntimeError);
+    EXPECT_THROW(read_steps.read_all<double>("nonexistent"), RuntimeError);
+
+    std::vector<ExampleMctruth::Step> actual(read_steps.num_rows());
+    for (auto i : range(actual.size()))
+    {
+        EXPECT_EQ(pdg::gamma().get(), particle[i]);
+        actual[i].event = event[i];
+        actual[i].track = track[i];
+        actual[i].step = step[i];
+        actual[i].volume = volume[i];
+        std::copy(pos[i].begin(), pos[i].end(), actual[i].pos);
+    }
+    std::sort(actual.begin(),
+              actual.end(),
+              [](ExampleMctruth::Step const& lhs,
+                 ExampleMctruth::Step const& rhs) {
+                  return std::make_tuple(lhs.event, lhs.track, lhs.step)
+                         < std::make_tuple(rhs.event, rhs.track, rhs.step);
+              });
+
+    auto expected = mctruth->steps();
+    for (auto i : range(expected.size()))
+    {
+        EXPECT_EQ(expected[i].event, actual[i].event);
+        EXPECT_EQ(expected[i].track, actual[i].track);
+        EXPECT_EQ(expected[i].step, actual[i].step);
+        EXPECT_EQ(expected[i].volume, actual[i].volume);
+        EXPECT_EQ(expected[i].pos[0], actual[i].pos[0]);
+    }
+}
+
+TEST_F(StepColumnWriterTest, errors)
+{
+    {
+        std::ofstream os(filename_);
+        os << "not a step file";
+    }
+    EXPECT_THROW(StepColumnReader{filename_}, RuntimeError);
+
+    {
+        // Index is written by the destructor
+        StepColumnWriter writer(filename_, nullptr, StepSelection{});
+    }
+    StepColumnReader read_steps(filename_);
+    EXPECT_EQ(1, read_steps.columns().size());
+    EXPECT_EQ(0, read_steps.num_chunks());
+    EXPECT_EQ(0, read_steps.num_rows());
+    EXPECT_EQ(0, read_steps.read_all<size_type>("track_id").size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -7,12 +7,23 @@
 //---------------------------------------------------------------------------//
 #include "Physics.test.hh"
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <string>
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/io/BinaryArchive.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
 #include "celeritas/MockTestBase.hh"
 #include "celeritas/em/process/EPlusAnnihilationProcess.hh"
+#include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/grid/EnergyLossCalculator.hh"
 #include "celeritas/grid/RangeCalculator.hh"
 #include "celeritas/grid/XsCalculator.hh"
@@ -138,6 +149,182 @@ TEST_F(PhysicsParamsTest, output)
 
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (HOST)
+TEST_F(PhysicsParamsTest, cache)
+{
+    PhysicsParams const& orig = *this->physics();
+
+    std::string filename = this->make_unique_filename(".celercache");
+    std::remove(filename.c_str());
+
+    auto build_physics = [&](std::uint64_t key) {
+        ActionRegistry action_reg;
+        PhysicsParams::Input inp;
+        inp.particles = this->particles();
+        inp.materials = this->material();
+        inp.options = this->build_physics_options();
+        inp.action_registry = &action_reg;
+        for (auto process_id : range(ProcessId{orig.num_processes()}))
+        {
+            inp.processes.push_back(orig.process(process_id));
+        }
+        inp.cache_filename = filename;
+        inp.cache_key = key;
+        return PhysicsParams{std::move(inp)};
+    };
+
+    // Build and write the cache, then load from the cache
+    PhysicsParams built = build_physics(123);
+    PhysicsParams loaded = build_physics(123);
+
+    auto const& expected = built.host_ref();
+    auto const& actual = loaded.host_ref();
+    EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                  actual.reals[AllItems<real_type>{}]);
+    EXPECT_EQ(expected.value_grids.size(), actual.value_grids.size());
+    EXPECT_EQ(expected.value_tables.size(), actual.value_tables.size());
+    EXPECT_EQ(expected.model_xs.size(), actual.model_xs.size());
+    EXPECT_EQ(expected.process_groups.size(), actual.process_groups.size());
+    EXPECT_EQ(expected.scalars.model_to_action,
+              actual.scalars.model_to_action);
+    EXPECT_EQ(expected.scalars.max_particle_processes,
+              actual.scalars.max_particle_processes);
+
+    if (!celeritas::device())
+    {
+        // Tables are used directly from the mapped file, not copied
+        EXPECT_NE(expected.reals[AllItems<real_type>{}].data(),
+                  actual.reals[AllItems<real_type>{}].data());
+        EXPECT_EQ(0,
+                  reinterpret_cast<std::uintptr_t>(
+                      actual.reals[AllItems<real_type>{}].data())
+                      % BinaryOutArchive::alignment);
+    }
+
+    // A different key rebuilds and overwrites the stale cache
+    PhysicsParams rebuilt = build_physics(456);
+    EXPECT_EQ(expected.reals.size(), rebuilt.host_ref().reals.size());
+
+    {
+        // Truncate the cache file, keeping its header
+        std::ifstream infile(filename, std::ios::binary);
+        std::string contents{std::istreambuf_iterator<char>(infile),
+                             std::istreambuf_iterator<char>()};
+        infile.close();
+        std::ofstream outfile(filename, std::ios::binary);
+        outfile.write(contents.data(), contents.size() / 2);
+    }
+    // A corrupt cache is rebuilt rather than raising an error
+    PhysicsParams repaired = build_physics(456);
+    EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                  repaired.host_ref().reals[AllItems<real_type>{}]);
+    // ... and the rewritten cache is valid
+    PhysicsParams reloaded = build_physics(456);
+    EXPECT_EQ(expected.value_tables.size(),
+              reloaded.host_ref().value_tables.size());
+
+    std::remove(filename.c_str());
+}
+
+TEST_F(PhysicsParamsTest, shared_tables)
+{
+    PhysicsParams const& orig = *this->physics();
+
+    // A null communicator stores the "shared" tables locally
+    MpiCommunicator comm;
+    ActionRegistry action_reg;
+    PhysicsParams::Input inp;
+    inp.particles = this->particles();
+    inp.materials = this->material();
+    inp.options = this->build_physics_options();
+    inp.action_registry = &action_reg;
+    for (auto process_id : range(ProcessId{orig.num_processes()}))
+    {
+        inp.processes.push_back(orig.process(process_id));
+    }
+    inp.shared_comm = &comm;
+    PhysicsParams shared{std::move(inp)};
+
+    auto const& expected = orig.host_ref();
+    auto const& actual = shared.host_ref();
+    EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                  actual.reals[AllItems<real_type>{}]);
+    EXPECT_EQ(expected.value_grids.size(), actual.value_grids.size());
+    EXPECT_EQ(expected.value_grid_ids.size(), actual.value_grid_ids.size());
+    EXPECT_EQ(expected.value_tables.size(), actual.value_tables.size());
+    EXPECT_EQ(expected.value_table_ids.size(),
+              actual.value_table_ids.size());
+    EXPECT_NE(expected.reals[AllItems<real_type>{}].data(),
+              actual.reals[AllItems<real_type>{}].data());
+}
+
+TEST_F(PhysicsParamsTest, shared_tables_built_once)
+{
+    // Count the number of times the tables are built
+    class CountingProcess final : public Process
+    {
+      public:
+        CountingProcess(PhysicsParams::SPConstProcess process, int* num_builds)
+            : process_(std::move(process)), num_builds_(num_builds)
+        {
+        }
+        VecModel build_models(ActionIdIter start_id) const final
+        {
+            return process_->build_models(start_id);
+        }
+        StepLimitBuilders step_limits(Applicability range) const final
+        {
+            ++*num_builds_;
+            return process_->step_limits(range);
+        }
+        bool use_integral_xs() const final
+        {
+            return process_->use_integral_xs();
+        }
+        std::string label() const final { return process_->label(); }
+
+      private:
+        PhysicsParams::SPConstProcess process_;
+        int* num_builds_;
+    };
+
+    PhysicsParams const& orig = *this->physics();
+    MpiCommunicator comm;
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized)
+    {
+        comm = MpiCommunicator::comm_world();
+    }
+
+    int num_builds{0};
+    ActionRegistry action_reg;
+    PhysicsParams::Input inp;
+    inp.particles = this->particles();
+    inp.materials = this->material();
+    inp.options = this->build_physics_options();
+    inp.action_registry = &action_reg;
+    for (auto process_id : range(ProcessId{orig.num_processes()}))
+    {
+        inp.processes.push_back(std::make_shared<CountingProcess>(
+            orig.process(process_id), &num_builds));
+    }
+    inp.shared_comm = &comm;
+    PhysicsParams shared{std::move(inp)};
+
+    // Only one process builds the tables (assuming a single node)
+    int num_builders = (num_builds > 0 ? 1 : 0);
+    if (comm)
+    {
+        num_builders = allreduce(comm, Operation::sum, num_builders);
+    }
+    EXPECT_EQ(1, num_builders);
+
+    EXPECT_VEC_EQ(orig.host_ref().reals[AllItems<real_type>{}],
+                  shared.host_ref().reals[AllItems<real_type>{}]);
+    EXPECT_EQ(orig.host_ref().model_xs.size(),
+              shared.host_ref().model_xs.size());
+    EXPECT_EQ(orig.host_ref().process_groups.size(),
+              shared.host_ref().process_groups.size());
+}
+
 //---------------------------------------------------------------------------//
 
 class PhysicsTrackViewHostTest : public PhysicsParamsTest
@@ -394,6 +394,7 @@ class StepLimiterTest : public PhysicsStepUtilsTest
 
         opts.min_range = inf;  // Use analytic range instead of scaled
         opts.fixed_step_limiter = 1e-3;
+        opts.region_step_limiters = {0, 1e-2};
         return opts;
     }
 };
@@ -441,8 +442,81 @@ TEST_F(StepLimiterTest, calc_physics_step_limit)
         step = calc_physics_step_limit(material, particle, phys, pstep);
         EXPECT_EQ(fixed_step_action, step.action);
         EXPECT_SOFT_EQ(0.001, step.step);
+
+        // Default region uses the global limiter
+        step = calc_physics_step_limit(
+            material, particle, phys, pstep, RegionId{0});
+        EXPECT_EQ(fixed_step_action, step.action);
+        EXPECT_SOFT_EQ(0.001, step.step);
+
+        // Region-specific limiter overrides the global one
+        step = calc_physics_step_limit(
+            material, particle, phys, pstep, RegionId{1});
+        EXPECT_EQ(fixed_step_action, step.action);
+        EXPECT_SOFT_EQ(0.01, step.step);
     }
 }
+
+//---------------------------------------------------------------------------//
+
+class RegionStepLimiterTest : public PhysicsStepUtilsTest
+{
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+
+        opts.min_range = inf;  // Use analytic range instead of scaled
+        opts.region_step_limiters = {0, 0, 1e-2};
+        opts.region_tracking_cuts = {MevEnergy{0}, MevEnergy{0.1}};
+        return opts;
+    }
+};
+
+TEST_F(RegionStepLimiterTest, calc_physics_step_limit)
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), ThreadId{0});
+    PhysicsStepView pstep = this->step_view();
+
+    // Only regions with a limit are restricted
+    auto const& scalars = this->physics()->host_ref().scalars;
+    EXPECT_TRUE(scalars.fixed_step_action);
+    EXPECT_EQ(inf, scalars.fixed_step_limiter);
+
+    PhysicsTrackView phys = this->init_track(
+        &material, MaterialId{1}, &particle, "celeriton", MevEnergy{1e-1});
+    phys.interaction_mfp(1);
+    for (auto region : {RegionId{0}, RegionId{1}, RegionId{3}})
+    {
+        StepLimit step = calc_physics_step_limit(
+            material, particle, phys, pstep, region);
+        EXPECT_NE(scalars.fixed_step_action, step.action) << region.get();
+        EXPECT_GT(step.step, 0.01) << region.get();
+    }
+
+    StepLimit step
+        = calc_physics_step_limit(material, particle, phys, pstep, RegionId{2});
+    EXPECT_EQ(scalars.fixed_step_action, step.action);
+    EXPECT_SOFT_EQ(0.01, step.step);
+}
+
+TEST_F(RegionStepLimiterTest, tracking_cut)
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), ThreadId{0});
+    PhysicsTrackView phys = this->init_track(
+        &material, MaterialId{1}, &particle, "celeriton", MevEnergy{1});
+
+    // Regions without a larger cut use the global energy loss limit
+    EXPECT_SOFT_EQ(1e-3, phys.tracking_cut(RegionId{0}).value());
+    EXPECT_SOFT_EQ(0.1, phys.tracking_cut(RegionId{1}).value());
+    EXPECT_SOFT_EQ(1e-3, phys.tracking_cut(RegionId{2}).value());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
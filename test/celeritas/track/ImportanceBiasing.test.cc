@@ -0,0 +1,426 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/ImportanceBiasing.test.cc
+//---------------------------------------------------------------------------//
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/TrackInitUtils.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ImportanceBiasingTest : public SimpleTestBase
+{
+  protected:
+    using MevEnergy = units::MevEnergy;
+    using HostStateStore = CollectionStateStore<CoreStateData, MemSpace::host>;
+
+    static constexpr size_type num_tracks = 128;
+
+    real_type secondary_stack_factor() const final { return 4; }
+
+    virtual real_type inner_importance() const { return 4; }
+
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        // Put the inner box in its own region
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat = {MaterialId{0}, MaterialId{1}, MaterialId{}};
+        input.volume_labels
+            = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+        input.volume_to_region = {RegionId{1}, RegionId{0}, RegionId{}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 1;
+        input.region_importance = {1, this->inner_importance()};
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    void SetUp() override
+    {
+        states_ = std::make_unique<HostStateStore>(this->core()->host_ref(),
+                                                   num_tracks);
+        core_ref_.params = this->core()->host_ref();
+        core_ref_.states = states_->ref();
+    }
+
+    // Start photons with a weight of two at the given point
+    void init_tracks(Real3 const& pos)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find("gamma");
+        p.energy = MevEnergy{100};
+        p.position = pos;
+        p.direction = {1, 0, 0};
+        p.event_id = EventId{0};
+        p.weight = 2;
+        std::vector<Primary> primaries(num_tracks, p);
+        for (auto i : range(num_tracks))
+        {
+            primaries[i].track_id = TrackId{i};
+        }
+        extend_from_primaries(core_ref_, make_span(primaries));
+        initialize_tracks(core_ref_);
+        this->clear_secondaries();
+    }
+
+    // Reset the secondaries as the pre-step action would
+    void clear_secondaries()
+    {
+        for (auto tid : range(ThreadId{num_tracks}))
+        {
+            this->track(tid).make_physics_step_view().secondaries({});
+        }
+    }
+
+    // Move all tracks to a new point (as if they took a step)
+    void move_tracks(Real3 const& pos)
+    {
+        for (auto tid : range(ThreadId{num_tracks}))
+        {
+            CoreTrackView track{core_ref_.params, core_ref_.states, tid};
+            auto geo = track.make_geo_view();
+            geo = GeoTrackInitializer{pos, geo.dir()};
+        }
+        this->clear_secondaries();
+    }
+
+    CoreTrackView track(ThreadId tid) const
+    {
+        return {core_ref_.params, core_ref_.states, tid};
+    }
+
+    std::unique_ptr<HostStateStore> states_;
+    CoreRef<MemSpace::host> core_ref_;
+};
+
+//---------------------------------------------------------------------------//
+
+class FractionalImportanceTest : public ImportanceBiasingTest
+{
+    real_type inner_importance() const final { return 2.5; }
+};
+
+//---------------------------------------------------------------------------//
+
+class EnergyRouletteTest : public ImportanceBiasingTest
+{
+  protected:
+    SPConstTrackInit build_init() final
+    {
+        EnergyRoulette roulette;
+        roulette.energy = MevEnergy{1};
+        roulette.survival_probability = 0.25;
+
+        // Only secondaries produced in the inner box are rouletted
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 1;
+        input.region_roulette = {EnergyRoulette{}, roulette};
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    // Each track emits one low-energy and one high-energy electron
+    void emit_secondaries()
+    {
+        auto electron = this->particle()->find("electron");
+        for (auto tid : range(ThreadId{num_tracks}))
+        {
+            auto phys = this->track(tid).make_physics_step_view();
+            Secondary* sec = phys.make_secondary_allocator()(2);
+            ASSERT_TRUE(sec);
+            sec[0].particle_id = electron;
+            sec[0].energy = MevEnergy{0.1};
+            sec[0].direction = {0, 0, 1};
+            sec[1].particle_id = electron;
+            sec[1].energy = MevEnergy{10};
+            sec[1].direction = {0, 0, -1};
+            phys.secondaries({sec, 2});
+        }
+    }
+
+    // Tally the weights of the new track initializers
+    std::map<real_type, size_type> count_weights()
+    {
+        std::map<real_type, size_type> result;
+        for (auto const& init : core_ref_.states.init.initializers.data())
+        {
+            ++result[init.sim.weight];
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ImportanceBiasingTest, split)
+{
+    // Tracks start in the world with unit importance
+    this->init_tracks({-20, 0, 0});
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        EXPECT_EQ(2, sim.weight());
+        EXPECT_EQ(1, sim.importance());
+    }
+
+    // Move into the more important region, and have every other track emit
+    // a secondary before the split
+    this->move_tracks({0, 0, 0});
+    auto electron = this->particle()->find("electron");
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        if (tid.get() % 2 != 0)
+        {
+            continue;
+        }
+        auto phys = this->track(tid).make_physics_step_view();
+        Secondary* sec = phys.make_secondary_allocator()(1);
+        ASSERT_TRUE(sec);
+        sec->particle_id = electron;
+        sec->energy = MevEnergy{10};
+        sec->direction = {0, 0, 1};
+        phys.secondaries({sec, 1});
+    }
+    extend_from_secondaries(core_ref_);
+
+    // Each track is split into four that share its weight
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        EXPECT_EQ(TrackStatus::alive, sim.status());
+        EXPECT_EQ(0.5, sim.weight());
+        EXPECT_EQ(4, sim.importance());
+    }
+
+    std::map<std::pair<real_type, real_type>, size_type> counts;
+    for (auto const& init : core_ref_.states.init.initializers.data())
+    {
+        ++counts[{init.sim.weight, init.sim.importance}];
+    }
+    ASSERT_EQ(2, counts.size());
+    EXPECT_EQ(3 * num_tracks, (counts[{0.5, 4}]));
+    // Secondaries keep the parent's weight from before the split
+    EXPECT_EQ(num_tracks / 2, (counts[{2, 1}]));
+
+    // Moving within the region doesn't split again
+    initialize_tracks(core_ref_);
+    this->move_tracks({1, 1, 1});
+    extend_from_secondaries(core_ref_);
+    EXPECT_EQ(0, core_ref_.states.init.num_secondaries);
+}
+
+TEST_F(ImportanceBiasingTest, roulette)
+{
+    // Tracks start in the inner box
+    this->init_tracks({0, 0, 0});
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        EXPECT_EQ(4, this->track(tid).make_sim_view().importance());
+    }
+
+    // Move out to the less important region
+    this->move_tracks({-20, 0, 0});
+    extend_from_secondaries(core_ref_);
+    EXPECT_EQ(0, core_ref_.states.init.initializers.size());
+
+    size_type num_survivors = 0;
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        if (sim.status() == TrackStatus::inactive)
+        {
+            continue;
+        }
+        ++num_survivors;
+        EXPECT_EQ(TrackStatus::alive, sim.status());
+        EXPECT_EQ(8, sim.weight());
+        EXPECT_EQ(1, sim.importance());
+    }
+    // About a quarter of the tracks survive
+    EXPECT_EQ(22, num_survivors);
+}
+
+TEST_F(ImportanceBiasingTest, killed_parent)
+{
+    // Tracks start in the inner box
+    this->init_tracks({0, 0, 0});
+
+    // Move out to the less important region; every track emits two
+    // secondaries, and every other track is killed by its interaction
+    this->move_tracks({-20, 0, 0});
+    auto electron = this->particle()->find("electron");
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto phys = this->track(tid).make_physics_step_view();
+        Secondary* sec = phys.make_secondary_allocator()(2);
+        ASSERT_TRUE(sec);
+        for (auto i : range(2))
+        {
+            sec[i].particle_id = electron;
+            sec[i].energy = MevEnergy{10};
+            sec[i].direction = {0, 0, 1};
+        }
+        phys.secondaries({sec, 2});
+        if (tid.get() % 2 != 0)
+        {
+            this->track(tid).make_sim_view().status(TrackStatus::killed);
+        }
+    }
+    extend_from_secondaries(core_ref_);
+
+    // Slots hold either a surviving parent or a secondary initialized in
+    // place of a killed or rouletted parent
+    size_type num_survivors = 0;
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        ASSERT_EQ(TrackStatus::alive, sim.status());
+        if (sim.parent_id())
+        {
+            // Secondaries keep the parent's weight from before the roulette
+            EXPECT_EQ(2, sim.weight());
+            EXPECT_EQ(4, sim.importance());
+        }
+        else
+        {
+            ++num_survivors;
+            EXPECT_EQ(0, tid.get() % 2);
+            EXPECT_EQ(8, sim.weight());
+            EXPECT_EQ(1, sim.importance());
+        }
+    }
+    EXPECT_EQ(11, num_survivors);
+
+    // Secondaries of surviving parents are likewise unbiased
+    size_type num_secondaries = 2 * num_tracks - (num_tracks - num_survivors);
+    EXPECT_EQ(num_secondaries, core_ref_.states.init.initializers.size());
+    for (auto const& init : core_ref_.states.init.initializers.data())
+    {
+        EXPECT_EQ(2, init.sim.weight);
+        EXPECT_EQ(4, init.sim.importance);
+    }
+
+    // Secondaries in the slots play their own roulette on their next step
+    this->clear_secondaries();
+    extend_from_secondaries(core_ref_);
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto sim = this->track(tid).make_sim_view();
+        if (sim.status() == TrackStatus::alive)
+        {
+            EXPECT_EQ(8, sim.weight());
+            EXPECT_EQ(1, sim.importance());
+        }
+    }
+}
+
+TEST_F(ImportanceBiasingTest, on_boundary)
+{
+    this->init_tracks({-20, 0, 0});
+
+    // Move exactly to the inner box's surface
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        auto geo = this->track(tid).make_geo_view();
+        geo.find_next_step();
+        geo.move_to_boundary();
+        geo.cross_boundary();
+        ASSERT_TRUE(geo.is_on_boundary());
+    }
+
+    // Splitting waits until the track is inside the region
+    extend_from_secondaries(core_ref_);
+    EXPECT_EQ(0, core_ref_.states.init.initializers.size());
+    EXPECT_EQ(2, this->track(ThreadId{0}).make_sim_view().weight());
+}
+
+TEST_F(FractionalImportanceTest, split)
+{
+    this->init_tracks({-20, 0, 0});
+    this->move_tracks({0, 0, 0});
+    extend_from_secondaries(core_ref_);
+
+    // Each track makes one or two copies with 2/2.5 of the weight
+    size_type num_copies = num_tracks;
+    for (auto const& init : core_ref_.states.init.initializers.data())
+    {
+        EXPECT_SOFT_EQ(0.8, init.sim.weight);
+        ++num_copies;
+    }
+    EXPECT_EQ(313, num_copies);
+    for (auto tid : range(ThreadId{num_tracks}))
+    {
+        EXPECT_SOFT_EQ(0.8, this->track(tid).make_sim_view().weight());
+    }
+}
+
+TEST_F(EnergyRouletteTest, roulette)
+{
+    this->init_tracks({0, 0, 0});
+    this->emit_secondaries();
+    extend_from_secondaries(core_ref_);
+
+    auto weights = this->count_weights();
+    ASSERT_EQ(2, weights.size());
+    // High-energy secondaries are unchanged
+    EXPECT_EQ(num_tracks, weights[2.0]);
+    // Some low-energy secondaries survive the roulette with increased weight
+    EXPECT_EQ(22, weights[8.0]);
+}
+
+TEST_F(EnergyRouletteTest, other_region)
+{
+    this->init_tracks({-20, 0, 0});
+    this->emit_secondaries();
+    extend_from_secondaries(core_ref_);
+
+    auto weights = this->count_weights();
+    ASSERT_EQ(1, weights.size());
+    EXPECT_EQ(2 * num_tracks, weights[2.0]);
+}
+
+TEST_F(EnergyRouletteTest, invalid)
+{
+    TrackInitParams::Input input;
+    input.capacity = 4096;
+    input.max_events = 1;
+    input.region_roulette = {EnergyRoulette{MevEnergy{1}, 0}};
+    EXPECT_THROW(TrackInitParams{input}, RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,162 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/AsyncStepInterface.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/user/AsyncStepInterface.hh"
+
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/StepCollector.hh"
+#include "celeritas/user/StepData.hh"
+
+#include "../SimpleTestBase.hh"
+#include "ExampleMctruth.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Fail when processing the step data
+class FailingStepInterface final : public StepInterface
+{
+  public:
+    Filters filters() const final { return {}; }
+
+    StepSelection selection() const final
+    {
+        StepSelection result;
+        result.event_id = true;
+        return result;
+    }
+
+    void execute(StateHostRef const&) final
+    {
+        CELER_VALIDATE(false, << "failed to process steps");
+    }
+
+    void execute(StateDeviceRef const&) final
+    {
+        CELER_NOT_IMPLEMENTED("device failure");
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AsyncStepInterfaceTest : public SimpleTestBase
+{
+  protected:
+    using VecPrimary = std::vector<Primary>;
+    using VecInterface = StepCollector::VecInterface;
+
+    VecPrimary make_primaries(size_type count)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10.0};
+        p.track_id = TrackId{0};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+
+        VecPrimary result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    void run(VecInterface callbacks, size_type num_tracks, size_type num_steps)
+    {
+        StepCollector collector{std::move(callbacks),
+                                this->geometry(),
+                                /* num_streams = */ 1,
+                                this->action_reg().get()};
+
+        StepperInput step_inp;
+        step_inp.params = this->core();
+        step_inp.num_track_slots = num_tracks;
+        Stepper<MemSpace::host> step(step_inp);
+
+        auto primaries = this->make_primaries(num_tracks);
+        auto counts = step(make_span(primaries));
+        for (size_type i = 1; i < num_steps && counts; ++i)
+        {
+            counts = step();
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AsyncStepInterfaceTest, matches_synchronous)
+{
+    auto sync_mctruth = std::make_shared<ExampleMctruth>();
+    auto async_mctruth = std::make_shared<ExampleMctruth>();
+    auto async = std::make_shared<AsyncStepInterface>(async_mctruth, 2);
+
+    this->run({sync_mctruth, async}, 8, 2);
+    async->flush();
+
+    sync_mctruth->sort();
+    async_mctruth->sort();
+    auto expected = sync_mctruth->steps();
+    auto actual = async_mctruth->steps();
+    ASSERT_EQ(expected.size(), actual.size());
+    EXPECT_LT(8, actual.size());
+    for (auto i : range(expected.size()))
+    {
+        EXPECT_EQ(expected[i].event, actual[i].event);
+        EXPECT_EQ(expected[i].track, actual[i].track);
+        EXPECT_EQ(expected[i].step, actual[i].step);
+        EXPECT_EQ(expected[i].volume, actual[i].volume);
+        EXPECT_EQ(expected[i].pos[0], actual[i].pos[0]);
+        EXPECT_EQ(expected[i].dir[0], actual[i].dir[0]);
+    }
+}
+
+TEST_F(AsyncStepInterfaceTest, single_buffer)
+{
+    auto mctruth = std::make_shared<ExampleMctruth>();
+    auto async = std::make_shared<AsyncStepInterface>(mctruth, 1);
+
+    // Each step waits for the previous one to be processed
+    this->run({async}, 4, 2);
+    async->flush();
+    EXPECT_EQ(8, mctruth->steps().size());
+}
+
+TEST_F(AsyncStepInterfaceTest, error)
+{
+    EXPECT_THROW(AsyncStepInterface(std::make_shared<ExampleMctruth>(), 0),
+                 RuntimeError);
+
+    auto async = std::make_shared<AsyncStepInterface>(
+        std::make_shared<FailingStepInterface>(), 2);
+    this->run({async}, 4, 1);
+
+    // Exception from the consumer thread is rethrown once
+    EXPECT_THROW(async->flush(), RuntimeError);
+    EXPECT_NO_THROW(async->flush());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -53,13 +53,14 @@ auto ExampleCalorimeters::filters() const -> Filters
 
 //---------------------------------------------------------------------------//
 /*!
- * Gather event IDs and local energy deposition.
+ * Gather event IDs, track weights, and local energy deposition.
  */
 StepSelection ExampleCalorimeters::selection() const
 {
     StepSelection result;
     result.event_id = true;
     result.energy_deposition = true;
+    result.weight = true;
 
     return result;
 }
@@ -90,7 +91,7 @@ void ExampleCalorimeters::execute(StateHostRef const& data)
         real_type edep
             = value_as<units::MevEnergy>(data.energy_deposition[tid]);
         CELER_ASSERT(edep > 0);
-        deposition_[det.unchecked_get()] += edep;
+        deposition_[det.unchecked_get()] += data.weight[tid] * edep;
     }
 }
 
@@ -34,8 +34,10 @@ void MctruthTestBase::SetUp()
 
     StepCollector::VecInterface interfaces = {example_mctruth_};
 
-    collector_ = std::make_shared<StepCollector>(
-        std::move(interfaces), this->geometry(), this->action_reg().get());
+    collector_ = std::make_shared<StepCollector>(std::move(interfaces),
+                                                 this->geometry(),
+                                                 /* num_streams = */ 1,
+                                                 this->action_reg().get());
 }
 
 //---------------------------------------------------------------------------//
@@ -142,6 +142,7 @@ TEST_F(KnStepCollectorTestBase, mixing_types)
 
     EXPECT_THROW((StepCollector{std::move(interfaces),
                                 this->geometry(),
+                                /* num_streams = */ 1,
                                 this->action_reg().get()}),
                  celeritas::RuntimeError);
 }
@@ -151,8 +152,10 @@ TEST_F(KnStepCollectorTestBase, multiple_interfaces)
     // Add mctruth twice so each step is doubly written
     auto mctruth = std::make_shared<ExampleMctruth>();
     StepCollector::VecInterface interfaces = {mctruth, mctruth};
-    auto collector = std::make_shared<StepCollector>(
-        std::move(interfaces), this->geometry(), this->action_reg().get());
+    auto collector = std::make_shared<StepCollector>(std::move(interfaces),
+                                                     this->geometry(),
+                                                     /* num_streams = */ 1,
+                                                     this->action_reg().get());
 
     // Do one step with two tracks
     {
@@ -169,6 +172,38 @@ TEST_F(KnStepCollectorTestBase, multiple_interfaces)
     EXPECT_EQ(4, mctruth->steps().size());
 }
 
+TEST_F(KnStepCollectorTestBase, multiple_streams)
+{
+    auto mctruth = std::make_shared<ExampleMctruth>();
+    auto collector = std::make_shared<StepCollector>(
+        StepCollector::VecInterface{mctruth},
+        this->geometry(),
+        /* num_streams = */ 2,
+        this->action_reg().get());
+
+    // Steppers with different state sizes share the collector
+    StepperInput step_inp;
+    step_inp.params = this->core();
+    step_inp.num_track_slots = 2;
+    step_inp.stream_id = StreamId{0};
+    Stepper<MemSpace::host> step_a(step_inp);
+
+    step_inp.num_track_slots = 4;
+    step_inp.stream_id = StreamId{1};
+    Stepper<MemSpace::host> step_b(step_inp);
+
+    auto primaries = this->make_primaries(4);
+    step_a(make_span(primaries).first(2));
+    step_b(make_span(primaries));
+    step_a();
+    EXPECT_EQ(8, mctruth->steps().size());
+
+    // Stream that wasn't reserved by the collector
+    step_inp.stream_id = StreamId{2};
+    Stepper<MemSpace::host> step_c(step_inp);
+    EXPECT_THROW(step_c(make_span(primaries)), celeritas::RuntimeError);
+}
+
 //---------------------------------------------------------------------------//
 // KLEIN-NISHINA
 //---------------------------------------------------------------------------//
@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/StepDiagnostic.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/user/StepDiagnostic.hh"
+
+#include <memory>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/DiagnosticOutput.hh"
+#include "celeritas/user/EnergyDiagnostic.hh"
+#include "celeritas/user/ParticleProcessDiagnostic.hh"
+
+#include "../SimpleTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class StepDiagnosticTest : public SimpleTestBase
+{
+  protected:
+    static constexpr size_type num_streams = 2;
+
+    void SetUp() override
+    {
+        auto& action_reg = *this->action_reg();
+        step_ = std::make_shared<StepDiagnostic>(
+            action_reg.next_id(), this->particle(), 4, num_streams);
+        action_reg.insert(step_);
+        process_ = std::make_shared<ParticleProcessDiagnostic>(
+            action_reg.next_id(),
+            this->particle(),
+            this->physics(),
+            num_streams);
+        action_reg.insert(process_);
+        energy_ = std::make_shared<EnergyDiagnostic>(
+            action_reg.next_id(),
+            std::vector<real_type>{-50, 0, 50},
+            Axis::x,
+            num_streams);
+        action_reg.insert(energy_);
+    }
+
+    std::vector<Primary> make_primaries(size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find("gamma");
+        p.energy = units::MevEnergy{10};
+        p.position = {49, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = 0;
+        p.track_id = TrackId{0};
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+            if (i % 2 == 0)
+            {
+                // Start at the center of the inner box
+                result[i].position = {0, 0, 0};
+            }
+        }
+        return result;
+    }
+
+    //! Take a single step on host with the given stream
+    void run(StreamId stream)
+    {
+        StepperInput input;
+        input.params = this->core();
+        input.stream_id = stream;
+        input.num_track_slots = 32;
+        Stepper<MemSpace::host> step(std::move(input));
+
+        auto primaries = this->make_primaries(8);
+        step(make_span(primaries));
+    }
+
+    std::shared_ptr<StepDiagnostic> step_;
+    std::shared_ptr<ParticleProcessDiagnostic> process_;
+    std::shared_ptr<EnergyDiagnostic> energy_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(StepDiagnosticTest, host)
+{
+    // Half the photons start at the edge of the world and leave it on the
+    // first step; the rest may interact in the inner box
+    this->run(StreamId{0});
+    this->run(StreamId{1});
+
+    auto steps = step_->steps();
+    EXPECT_EQ(1, steps.size());
+    static size_type const expected_steps[] = {0u, 8u, 0u, 0u, 0u, 0u};
+    EXPECT_VEC_EQ(expected_steps, steps["gamma"]);
+
+    auto processes = process_->particle_processes();
+    EXPECT_EQ(1, processes.size());
+    EXPECT_EQ(2, processes["Compton scattering gamma"]);
+
+    // Compton scattering produces electrons rather than depositing energy
+    auto edep = energy_->energy_deposition();
+    EXPECT_EQ(2, edep.size());
+    EXPECT_SOFT_EQ(0, edep[0] + edep[1]);
+
+    DiagnosticOutput out({step_, process_, energy_});
+    EXPECT_EQ("diagnostics", out.label());
+    if (CELERITAS_USE_JSON)
+    {
+        EXPECT_EQ(
+            R"json({"edep":[0.0,0.0],"process":{"Compton scattering gamma":2},"steps":{"gamma":[0,8,0,0,0,0]}})json",
+            to_string(out));
+    }
+}
+
+TEST_F(StepDiagnosticTest, bad_stream)
+{
+    EXPECT_THROW(this->run(StreamId{num_streams}), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
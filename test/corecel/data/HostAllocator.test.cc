@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/HostAllocator.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/HostAllocator.hh"
+
+#include <cstdint>
+#include <vector>
+
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+template<class T>
+std::uintptr_t
+alignment_offset(T const* ptr,
+                 std::size_t align = HostAllocatorOptions::alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % align;
+}
+
+class HostAllocatorTest : public Test
+{
+  protected:
+    void SetUp() override { orig_ = host_allocator_options(); }
+    void TearDown() override { host_allocator_options(orig_); }
+
+    HostAllocatorOptions orig_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(HostAllocatorTest, collection)
+{
+    Collection<char, Ownership::value, MemSpace::host> chars;
+    make_builder(&chars).insert_back({'a', 'b', 'c'});
+    auto span = chars[AllItems<char>{}];
+    EXPECT_EQ(0, alignment_offset(span.data()));
+    EXPECT_EQ('c', span[2]);
+}
+
+TEST_F(HostAllocatorTest, large)
+{
+    HostAllocatorOptions opts;
+    opts.large_size = 1 << 16;
+    opts.huge_pages = true;
+    opts.first_touch = true;
+    host_allocator_options(opts);
+
+    std::vector<int, HostAllocator<int>> small(10, 3);
+    EXPECT_EQ(0, alignment_offset(small.data()));
+
+    std::vector<int, HostAllocator<int>> large(100000, 3);
+    EXPECT_EQ(0, alignment_offset(large.data(), opts.large_size));
+    EXPECT_EQ(3, large.front());
+    EXPECT_EQ(3, large.back());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
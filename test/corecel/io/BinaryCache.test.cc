@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/BinaryCache.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/io/BinaryCache.hh"
+
+#include <cstdio>
+#include <fstream>
+
+#include "corecel/OpaqueId.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionArchive.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class BinaryCacheTest : public Test
+{
+  protected:
+    template<class T>
+    using Items = Collection<T, Ownership::value, MemSpace::host>;
+
+    void SetUp() override
+    {
+        filename_ = this->make_unique_filename(".celercache");
+        std::remove(filename_.c_str());
+    }
+
+    void TearDown() override { std::remove(filename_.c_str()); }
+
+    std::string filename_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BinaryCacheTest, missing)
+{
+    BinaryCacheReader read_cache(filename_, 1234);
+    EXPECT_FALSE(read_cache);
+}
+
+TEST_F(BinaryCacheTest, round_trip)
+{
+    Items<char> chars;
+    Items<double> reals;
+    make_builder(&chars).insert_back({'a', 'b', 'c'});
+    make_builder(&reals).insert_back({1.5, 2.5, 3.5, 4.5});
+    {
+        BinaryCacheWriter write_cache(filename_, 1234);
+        auto& ar = write_cache.archive();
+        archive(ar, chars);
+        ar(std::string("hello"));
+        archive(ar, reals);
+        ar(OpaqueId<struct Foo_>{12});
+        write_cache.finalize();
+    }
+    {
+        BinaryCacheReader read_cache(filename_, 1234);
+        ASSERT_TRUE(read_cache);
+        auto& ar = read_cache.archive();
+
+        Items<char> loaded_chars;
+        unarchive(ar, &loaded_chars);
+        std::string str;
+        ar(&str);
+        Span<double const> loaded_reals = ar.read_span<double>();
+        OpaqueId<struct Foo_> id;
+        ar(&id);
+        EXPECT_EQ(0, ar.remaining());
+
+        EXPECT_VEC_EQ(chars[AllItems<char>{}],
+                      loaded_chars[AllItems<char>{}]);
+        EXPECT_EQ("hello", str);
+        EXPECT_VEC_EQ(reals[AllItems<double>{}], loaded_reals);
+        EXPECT_EQ(12, id.unchecked_get());
+
+        // Arrays are aligned in the file
+        EXPECT_EQ(0,
+                  reinterpret_cast<std::uintptr_t>(loaded_reals.data())
+                      % BinaryOutArchive::alignment);
+    }
+    {
+        // Stale key
+        BinaryCacheReader read_cache(filename_, 4321);
+        EXPECT_FALSE(read_cache);
+    }
+}
+
+TEST_F(BinaryCacheTest, unfinalized)
+{
+    {
+        BinaryCacheWriter write_cache(filename_, 1234);
+        write_cache.archive()(1.0);
+    }
+    BinaryCacheReader read_cache(filename_, 1234);
+    EXPECT_FALSE(read_cache);
+}
+
+TEST_F(BinaryCacheTest, truncated)
+{
+    {
+        BinaryCacheWriter write_cache(filename_, 1234);
+        write_cache.archive()(1.0);
+        write_cache.finalize();
+    }
+    BinaryCacheReader read_cache(filename_, 1234);
+    ASSERT_TRUE(read_cache);
+    double value;
+    read_cache.archive()(&value);
+    EXPECT_EQ(1.0, value);
+    EXPECT_THROW(read_cache.archive()(&value), RuntimeError);
+}
+
+TEST_F(BinaryCacheTest, corrupt_header)
+{
+    {
+        BinaryCacheWriter write_cache(filename_, 1234);
+        write_cache.finalize();
+    }
+    {
+        // Keep the magic and version but replace the code version string
+        std::fstream f(filename_,
+                       std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(16);
+        std::size_t const bad_size = 1ull << 40;
+        f.write(reinterpret_cast<char const*>(&bad_size), sizeof(bad_size));
+    }
+    BinaryCacheReader read_cache(filename_, 1234);
+    EXPECT_FALSE(read_cache);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
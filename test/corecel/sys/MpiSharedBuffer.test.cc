@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MpiSharedBuffer.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/MpiSharedBuffer.hh"
+
+#include <string>
+
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
+
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(MpiSharedBufferTest, null)
+{
+    MpiCommunicator comm;
+    int num_calls{0};
+    MpiSharedBuffer shared(comm, [&num_calls] {
+        ++num_calls;
+        return std::string("hello");
+    });
+    EXPECT_EQ(1, num_calls);
+    EXPECT_EQ(1, shared.num_sharing());
+    EXPECT_EQ("hello",
+              std::string(shared.data().data(), shared.data().size()));
+}
+
+TEST(MpiSharedBufferTest, TEST_IF_CELERITAS_MPI(world))
+{
+    MpiCommunicator comm = MpiCommunicator::comm_world();
+    int num_calls{0};
+    MpiSharedBuffer shared(comm, [&num_calls] {
+        ++num_calls;
+        return std::string("shared data");
+    });
+    EXPECT_EQ("shared data",
+              std::string(shared.data().data(), shared.data().size()));
+
+    // Only one process per node creates the data (assuming the same number
+    // of processes on each node)
+    int num_nodes = allreduce(comm, Operation::sum, num_calls);
+    EXPECT_EQ(comm.size(), num_nodes * shared.num_sharing());
+}
+
+TEST(MpiSharedBufferTest, TEST_IF_CELERITAS_MPI(outlives_mpi))
+{
+    // Destroyed at program exit, after MPI has been finalized
+    static MpiSharedBuffer const shared(MpiCommunicator::comm_world(), [] {
+        return std::string("persistent");
+    });
+    EXPECT_EQ("persistent",
+              std::string(shared.data().data(), shared.data().size()));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCounters.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/PerfCounters.hh"
+
+#include <thread>
+#include <vector>
+
+#include "corecel/sys/Environment.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Do some work that the compiler can't optimize away
+double do_work(int n)
+{
+    volatile double result = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        result = result + 1.0 / (i + 1);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(PerfCountersTest, environment)
+{
+    environment().insert({"CELER_PERF_COUNTERS", "cycles,,instructions"});
+    auto names = PerfCounters::names_from_environment();
+    static char const* const expected_names[] = {"cycles", "instructions"};
+    EXPECT_VEC_EQ(expected_names, names);
+}
+
+TEST(PerfCountersTest, errors)
+{
+    EXPECT_THROW(PerfCounters({"cycles", "flux-capacitance"}), RuntimeError);
+}
+
+TEST(PerfCountersTest, software)
+{
+    // Software events are available even without a hardware PMU
+    PerfCounters counters({"page-faults"});
+    counters.add_thread();
+    std::thread other([&counters] { counters.add_thread(); });
+    other.join();
+    if (!counters)
+    {
+        GTEST_SKIP() << "Performance counters are unavailable";
+    }
+    EXPECT_EQ(2, counters.num_threads());
+
+    PerfCounters::VecCount accum(1, 0);
+    counters.start();
+    std::vector<char> touched(1 << 24, 1);
+    counters.stop(&accum);
+    EXPECT_LT(1000, accum[0]);
+
+    // Counts are accumulated, and don't include work outside start/stop
+    auto first = accum;
+    std::vector<char> untouched(1 << 24, 1);
+    counters.start();
+    counters.stop(&accum);
+    EXPECT_GT(first[0] + 100, accum[0]);
+}
+
+TEST(PerfCountersTest, hardware)
+{
+    PerfCounters counters({"instructions", "branches"});
+    counters.add_thread();
+    PerfCounters::VecCount accum(2, 0);
+    counters.start();
+    do_work(100000);
+    counters.stop(&accum);
+    if (!counters)
+    {
+        // Kernel or hardware disallows access: counting is a null-op
+        EXPECT_EQ(0, accum[0]);
+        GTEST_SKIP() << "Hardware performance counters are unavailable";
+    }
+    EXPECT_LT(100000, accum[0]);
+    EXPECT_LT(100000, accum[1]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2023 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/TraceRecorder.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/TraceRecorder.hh"
+
+#include <sstream>
+#include <thread>
+
+#include "celeritas_config.h"
+#include "corecel/cont/Range.hh"
+
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TraceEvent make_event(char const* name, std::int64_t begin)
+{
+    TraceEvent result;
+    result.category = "test";
+    result.name = name;
+    result.begin = begin;
+    result.duration = 1500;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(TraceRecorderTest, threads)
+{
+    TraceRecorder recorder;
+    EXPECT_FALSE(recorder);
+    recorder.start();
+    EXPECT_TRUE(recorder);
+
+    auto event = make_event("foo \"quoted\"", 1234);
+    event.num_args = 1;
+    event.args[0] = {"active", 10};
+    recorder.record(std::move(event));
+    std::thread other(
+        [&recorder] { recorder.record(make_event("bar", 2000)); });
+    other.join();
+    EXPECT_EQ(2, recorder.size());
+
+    std::ostringstream os;
+    recorder.write(os);
+    std::string const expected = R"({"displayTimeUnit":"ms","traceEvents":[
+{"name":"thread_name","ph":"M","pid":0,"tid":0,"args":{"name":"thread 0"}},
+{"name":"foo \"quoted\"","cat":"test","ph":"X","pid":0,"tid":0,"ts":1.234,"dur":1.500,"args":{"active":10}},
+{"name":"thread_name","ph":"M","pid":0,"tid":1,"args":{"name":"thread 1"}},
+{"name":"bar","cat":"test","ph":"X","pid":0,"tid":1,"ts":2.000,"dur":1.500}
+]}
+)";
+    EXPECT_EQ(expected, os.str());
+
+#if CELERITAS_USE_JSON
+    auto j = nlohmann::json::parse(os.str());
+    EXPECT_EQ(4, j.at("traceEvents").size());
+#endif
+
+    recorder.clear();
+    EXPECT_EQ(0, recorder.size());
+}
+
+TEST(TraceRecorderTest, scoped)
+{
+    auto& recorder = trace_recorder();
+    recorder.clear();
+    {
+        ScopedTrace trace("test", "disabled");
+        trace.arg("ignored", 1);
+    }
+    EXPECT_EQ(0, recorder.size());
+
+    recorder.start();
+    {
+        ScopedTrace trace("test", "enabled");
+        for (auto i : range(TraceEvent::max_args + 1))
+        {
+            trace.arg("i", i);
+        }
+    }
+    recorder.stop();
+    EXPECT_EQ(1, recorder.size());
+
+    std::ostringstream os;
+    recorder.write(os);
+    EXPECT_NE(std::string::npos,
+              os.str().find(R"("args":{"i":0,"i":1,"i":2,"i":3}})"))
+        << os.str();
+    recorder.clear();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas